@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/Hashmap.h"
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <random>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+// n keys drawn from slots unique voxel coordinates.
+static Tensor RandomKeys(int64_t n, int64_t slots, const Device& device) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(slots) - 1);
+    std::vector<int> keys(n * 3);
+    for (int64_t i = 0; i < n; ++i) {
+        int v = dist(rng);
+        keys[3 * i + 0] = v % 1024;
+        keys[3 * i + 1] = (v / 1024) % 1024;
+        keys[3 * i + 2] = v / (1024 * 1024);
+    }
+    return Tensor(keys, {n, 3}, Dtype::Int32, device);
+}
+
+void HashInsert(benchmark::State& state,
+                int64_t n,
+                int64_t slots,
+                const HashmapBackend& backend,
+                const Device& device) {
+    Tensor keys = RandomKeys(n, slots, device);
+    Tensor values = Tensor::Ones({n}, Dtype::Int64, device);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(n, Dtype::Int32, Dtype::Int64, {3}, {1}, device,
+                        backend);
+        Tensor addrs, masks;
+        state.ResumeTiming();
+
+        hashmap.Insert(keys, values, addrs, masks);
+    }
+}
+
+void HashFind(benchmark::State& state,
+              int64_t n,
+              int64_t slots,
+              const HashmapBackend& backend,
+              const Device& device) {
+    Tensor keys = RandomKeys(n, slots, device);
+    Tensor values = Tensor::Ones({n}, Dtype::Int64, device);
+
+    Hashmap hashmap(n, Dtype::Int32, Dtype::Int64, {3}, {1}, device, backend);
+    Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+
+    for (auto _ : state) {
+        hashmap.Find(keys, addrs, masks);
+    }
+}
+
+void HashErase(benchmark::State& state,
+               int64_t n,
+               int64_t slots,
+               const HashmapBackend& backend,
+               const Device& device) {
+    Tensor keys = RandomKeys(n, slots, device);
+    Tensor values = Tensor::Ones({n}, Dtype::Int64, device);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(n, Dtype::Int32, Dtype::Int64, {3}, {1}, device,
+                        backend);
+        Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        state.ResumeTiming();
+
+        hashmap.Erase(keys, masks);
+    }
+}
+
+#define ENUM_BM_HASHMAP(FN, BACKEND)                                         \
+    BENCHMARK_CAPTURE(FN, BACKEND##_100k_1k, 100000, 1000,                   \
+                      HashmapBackend::BACKEND, Device("CPU:0"))              \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(FN, BACKEND##_1M_100k, 1000000, 100000,                \
+                      HashmapBackend::BACKEND, Device("CPU:0"))              \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(FN, BACKEND##_1M_1M, 1000000, 1000000,                 \
+                      HashmapBackend::BACKEND, Device("CPU:0"))              \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_HASHMAP(HashInsert, TBB)
+ENUM_BM_HASHMAP(HashInsert, OpenAddressing)
+ENUM_BM_HASHMAP(HashFind, TBB)
+ENUM_BM_HASHMAP(HashFind, OpenAddressing)
+ENUM_BM_HASHMAP(HashErase, TBB)
+ENUM_BM_HASHMAP(HashErase, OpenAddressing)
+
+}  // namespace core
+}  // namespace open3d
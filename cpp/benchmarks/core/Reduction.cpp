@@ -31,6 +31,7 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPUVectorization.h"
 #include "open3d/core/kernel/Kernel.h"
 
 namespace open3d {
@@ -55,5 +56,71 @@ BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+enum class ElementWiseOp { Add, Mul, AddScalar, Neg, Sqrt, Sum };
+
+/// Element-wise ops on Float32 tensors with 2^24 elements. If contiguous is
+/// false, the inputs are strided views, which bypass the vectorized kernels.
+/// If generic is true, the vectorized CPU kernels are restricted to the generic
+/// instruction set.
+void ElementWise(benchmark::State& state,
+                 const Device& device,
+                 ElementWiseOp op,
+                 bool contiguous,
+                 bool generic) {
+    int64_t num_elements = 1 << 24;
+    Tensor lhs = Tensor::Ones({num_elements, contiguous ? 1 : 2},
+                              Dtype::Float32, device)
+                         .Slice(1, 0, 1);
+    Tensor rhs = Tensor::Ones({num_elements, contiguous ? 1 : 2},
+                              Dtype::Float32, device)
+                         .Slice(1, 0, 1);
+
+    kernel::CPUInstructionSet isa = kernel::GetCPUInstructionSet();
+    if (generic) {
+        kernel::SetCPUInstructionSet(kernel::CPUInstructionSet::Generic);
+    }
+    auto run = [&]() {
+        switch (op) {
+            case ElementWiseOp::Add:
+                return lhs + rhs;
+            case ElementWiseOp::Mul:
+                return lhs * rhs;
+            case ElementWiseOp::AddScalar:
+                return lhs + 1.f;
+            case ElementWiseOp::Neg:
+                return lhs.Neg();
+            case ElementWiseOp::Sqrt:
+                return lhs.Sqrt();
+            case ElementWiseOp::Sum:
+            default:
+                return lhs.Sum({0, 1});
+        }
+    };
+    Tensor warm_up = run();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = run();
+    }
+    kernel::SetCPUInstructionSet(isa);
+}
+
+#define ENUM_ELEMENT_WISE_BENCHMARKS(OP)                                      \
+    BENCHMARK_CAPTURE(ElementWise, OP##_CPU, Device("CPU:0"),                 \
+                      ElementWiseOp::OP, true, false)                         \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(ElementWise, OP##_CPU_Generic, Device("CPU:0"),         \
+                      ElementWiseOp::OP, true, true)                          \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(ElementWise, OP##_CPU_Strided, Device("CPU:0"),         \
+                      ElementWiseOp::OP, false, false)                        \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_ELEMENT_WISE_BENCHMARKS(Add)
+ENUM_ELEMENT_WISE_BENCHMARKS(Mul)
+ENUM_ELEMENT_WISE_BENCHMARKS(AddScalar)
+ENUM_ELEMENT_WISE_BENCHMARKS(Neg)
+ENUM_ELEMENT_WISE_BENCHMARKS(Sqrt)
+ENUM_ELEMENT_WISE_BENCHMARKS(Sum)
+
 }  // namespace core
 }  // namespace open3d
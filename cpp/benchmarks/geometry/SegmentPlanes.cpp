@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/geometry/PointCloud.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// A room-like scan: 12 axis-aligned planes of 40000 down to 4000 points with
+// a little noise across them, and 5% of uniform clutter.
+static geometry::PointCloud MakeRoom() {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::uniform_real_distribution<double> noise(-0.003, 0.003);
+    geometry::PointCloud pcd;
+    for (int plane = 0; plane < 12; ++plane) {
+        const int axis = plane % 3;
+        const double offset = 0.25 * (plane / 3);
+        const int num_points = 40000 - 3000 * plane;
+        for (int i = 0; i < num_points; ++i) {
+            Eigen::Vector3d point(uniform(rng), uniform(rng), uniform(rng));
+            point(axis) = offset + noise(rng);
+            pcd.points_.push_back(point);
+        }
+    }
+    const size_t num_clutter = pcd.points_.size() / 20;
+    for (size_t i = 0; i < num_clutter; ++i) {
+        pcd.points_.emplace_back(uniform(rng), uniform(rng), uniform(rng));
+    }
+    return pcd;
+}
+
+static void SegmentPlanesRepeated(benchmark::State& state) {
+    const geometry::PointCloud room = MakeRoom();
+    for (auto _ : state) {
+        // One SegmentPlane call per plane on a copy of the points left.
+        auto pcd = std::make_shared<geometry::PointCloud>(room);
+        for (int plane = 0; plane < 12; ++plane) {
+            std::vector<size_t> inliers;
+            std::tie(std::ignore, inliers) = pcd->SegmentPlane(0.01, 3, 1000);
+            pcd = pcd->SelectByIndex(inliers, true);
+        }
+    }
+}
+
+static void SegmentPlanes(benchmark::State& state) {
+    const geometry::PointCloud room = MakeRoom();
+    for (auto _ : state) {
+        room.SegmentPlanes(0.01, 3, 1000, 12, 1000);
+    }
+}
+
+BENCHMARK(SegmentPlanesRepeated)->Unit(benchmark::kMillisecond);
+BENCHMARK(SegmentPlanes)->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
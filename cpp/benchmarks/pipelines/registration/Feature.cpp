@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/Feature.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Feature.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// 1M points on the unit sphere, with their normals. Each point has about 25
+// neighbors within kRadius.
+static constexpr double kRadius = 0.01;
+static constexpr int kMaxNN = 30;
+
+static geometry::PointCloud CreateSpherePointCloud() {
+    const int num_points = 1000000;
+    std::mt19937 generator(0);
+    std::normal_distribution<double> distribution;
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    for (Eigen::Vector3d &point : pcd.points_) {
+        point = Eigen::Vector3d(distribution(generator),
+                                distribution(generator),
+                                distribution(generator))
+                        .normalized();
+    }
+    pcd.normals_ = pcd.points_;
+    return pcd;
+}
+
+static void LegacyComputeFPFHFeature(benchmark::State &state,
+                                     const geometry::KDTreeSearchParam &param) {
+    geometry::PointCloud pcd = CreateSpherePointCloud();
+    for (auto _ : state) {
+        pipelines::registration::ComputeFPFHFeature(pcd, param);
+    }
+}
+
+static void ComputeFPFHFeature(benchmark::State &state,
+                               const core::Device &device,
+                               const utility::optional<int> max_nn,
+                               const utility::optional<double> radius) {
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            CreateSpherePointCloud(), core::Dtype::Float32, device);
+    // Warm up.
+    t::pipelines::registration::ComputeFPFHFeature(pcd, max_nn, radius);
+    for (auto _ : state) {
+        t::pipelines::registration::ComputeFPFHFeature(pcd, max_nn, radius);
+    }
+}
+
+BENCHMARK_CAPTURE(LegacyComputeFPFHFeature,
+                  Radius,
+                  geometry::KDTreeSearchParamRadius(kRadius))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LegacyComputeFPFHFeature,
+                  Hybrid,
+                  geometry::KDTreeSearchParamHybrid(kRadius, kMaxNN))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeFPFHFeature,
+                  Radius_CPU,
+                  core::Device("CPU:0"),
+                  utility::nullopt,
+                  kRadius)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeFPFHFeature,
+                  Hybrid_CPU,
+                  core::Device("CPU:0"),
+                  kMaxNN,
+                  kRadius)
+        ->Unit(benchmark::kMillisecond);
+
+// FPFH features of two independent random samplings of a bumpy height field,
+// 100K points each.
+struct MatchingFeatures {
+    pipelines::registration::Feature source_;
+    pipelines::registration::Feature target_;
+    // Exact mutual correspondences, to measure the recall.
+    pipelines::registration::CorrespondenceSet corres_;
+};
+
+static geometry::PointCloud CreateHeightFieldPointCloud(unsigned seed) {
+    const int num_points = 100000;
+    // z = a sin(f x) cos(1.3 f y) + 0.6 a sin(2.1 f x + 1.7 f y), with bumps
+    // about as large as the FPFH neighborhoods.
+    const double a = 0.03, f = 60.0;
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.normals_.resize(num_points);
+    for (int i = 0; i < num_points; i++) {
+        double x = distribution(generator), y = distribution(generator);
+        double z = a * std::sin(f * x) * std::cos(1.3 * f * y) +
+                   0.6 * a * std::sin(2.1 * f * x + 1.7 * f * y);
+        double dzdx = a * f * std::cos(f * x) * std::cos(1.3 * f * y) +
+                      1.26 * a * f * std::cos(2.1 * f * x + 1.7 * f * y);
+        double dzdy = -1.3 * a * f * std::sin(f * x) * std::sin(1.3 * f * y) +
+                      1.02 * a * f * std::cos(2.1 * f * x + 1.7 * f * y);
+        pcd.points_[i] = Eigen::Vector3d(x, y, z);
+        pcd.normals_[i] = Eigen::Vector3d(-dzdx, -dzdy, 1.0).normalized();
+    }
+    return pcd;
+}
+
+static const MatchingFeatures &GetMatchingFeatures() {
+    static const MatchingFeatures features = [] {
+        const geometry::KDTreeSearchParamHybrid param(0.02, 100);
+        MatchingFeatures result;
+        result.source_ = *pipelines::registration::ComputeFPFHFeature(
+                CreateHeightFieldPointCloud(0), param);
+        result.target_ = *pipelines::registration::ComputeFPFHFeature(
+                CreateHeightFieldPointCloud(1), param);
+        result.corres_ = pipelines::registration::CorrespondencesFromFeatures(
+                result.source_, result.target_, true);
+        return result;
+    }();
+    return features;
+}
+
+static void CorrespondencesFromFeatures(
+        benchmark::State &state,
+        const pipelines::registration::FeatureMatchingOption &option) {
+    const MatchingFeatures &features = GetMatchingFeatures();
+    pipelines::registration::CorrespondenceSet corres;
+    for (auto _ : state) {
+        corres = pipelines::registration::CorrespondencesFromFeatures(
+                features.source_, features.target_, true, option);
+    }
+    // Both sets are sorted by source index.
+    pipelines::registration::CorrespondenceSet common;
+    std::set_intersection(
+            corres.begin(), corres.end(), features.corres_.begin(),
+            features.corres_.end(), std::back_inserter(common),
+            [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+            });
+    state.counters["recall"] =
+            double(common.size()) / double(features.corres_.size());
+    state.counters["correspondences"] = double(corres.size());
+}
+
+using pipelines::registration::FeatureMatchingOption;
+using Method = FeatureMatchingOption::Method;
+
+BENCHMARK_CAPTURE(CorrespondencesFromFeatures,
+                  Exact,
+                  FeatureMatchingOption(Method::Exact))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CorrespondencesFromFeatures,
+                  KDForest_4_Trees_256_Checks,
+                  FeatureMatchingOption(Method::KDForest, 4, 256))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CorrespondencesFromFeatures,
+                  KDForest_4_Trees_1024_Checks,
+                  FeatureMatchingOption(Method::KDForest, 4, 1024))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CorrespondencesFromFeatures,
+                  KDForest_4_Trees_4096_Checks,
+                  FeatureMatchingOption(Method::KDForest, 4, 4096))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CorrespondencesFromFeatures,
+                  KDForest_8_Trees_1024_Checks,
+                  FeatureMatchingOption(Method::KDForest, 8, 1024))
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
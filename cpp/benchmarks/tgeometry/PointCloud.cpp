@@ -28,6 +28,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <random>
+
 #include "open3d/core/Tensor.h"
 
 namespace open3d {
@@ -70,12 +72,54 @@ void ToLegacyPointCloud(benchmark::State& state, const core::Device& device) {
     }
 }
 
+void VoxelDownSample(benchmark::State& state,
+                     const core::Device& device,
+                     VoxelDownSampleMode mode) {
+    int64_t num_points = 1000000;  // 1M
+    // Uniform in the unit cube, about 125K voxels of size 0.02.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<float> points(num_points * 3);
+    for (float& value : points) {
+        value = dist(rng);
+    }
+    PointCloud pcd(core::Tensor(points, {num_points, 3}, core::Dtype::Float32,
+                                device));
+    pcd.SetPointColors(pcd.GetPoints().Clone());
+
+    // Warm up.
+    PointCloud pcd_down = pcd.VoxelDownSample(0.02, mode);
+    (void)pcd_down;
+
+    for (auto _ : state) {
+        PointCloud pcd_down = pcd.VoxelDownSample(0.02, mode);
+    }
+}
+
 BENCHMARK_CAPTURE(FromLegacyPointCloud, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
 BENCHMARK_CAPTURE(ToLegacyPointCloud, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
+BENCHMARK_CAPTURE(VoxelDownSample,
+                  Mean / CPU,
+                  core::Device("CPU:0"),
+                  VoxelDownSampleMode::Mean)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(VoxelDownSample,
+                  First / CPU,
+                  core::Device("CPU:0"),
+                  VoxelDownSampleMode::First)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(VoxelDownSample,
+                  Center / CPU,
+                  core::Device("CPU:0"),
+                  VoxelDownSampleMode::Center)
+        ->Unit(benchmark::kMillisecond);
+
 #ifdef BUILD_CUDA_MODULE
 BENCHMARK_CAPTURE(FromLegacyPointCloud, CUDA, core::Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
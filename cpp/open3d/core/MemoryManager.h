@@ -88,6 +88,50 @@ public:
                 size_t num_bytes) override;
 };
 
+/// Allocation statistics of the CPUCachedMemoryManager.
+struct CPUCacheStatistics {
+    /// Number of Malloc calls served from the cache.
+    int64_t num_hits_ = 0;
+    /// Number of Malloc calls that had to allocate from the OS.
+    int64_t num_misses_ = 0;
+    /// Bytes currently held in the cache (not in use).
+    size_t cached_bytes_ = 0;
+    /// Bytes currently handed out to the user, rounded to size classes.
+    size_t allocated_bytes_ = 0;
+};
+
+/// Caching CPU memory manager.
+///
+/// Freed blocks are kept in size-class bins (per-thread bins for small blocks,
+/// a shared pool for large blocks) and reused by later Malloc calls, so loops
+/// that repeatedly create temporary tensors of the same shapes do not call
+/// std::malloc after the first iteration. Returned pointers are 64-byte
+/// aligned. The memory held by the cache is capped, see SetMaxCacheSize().
+class CPUCachedMemoryManager : public DeviceMemoryManager {
+public:
+    CPUCachedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Return all cached (unused) blocks of all threads to the OS.
+    static void ReleaseCache();
+
+    /// Set the maximum number of bytes kept in the cache. Blocks freed beyond
+    /// this limit are returned to the OS. Default is 1 GiB.
+    static void SetMaxCacheSize(size_t byte_size);
+    static size_t GetMaxCacheSize();
+
+    static CPUCacheStatistics GetStatistics();
+    /// Reset hit and miss counters.
+    static void ResetStatistics();
+};
+
 #ifdef BUILD_CUDA_MODULE
 class CUDASimpleMemoryManager : public DeviceMemoryManager {
 public:
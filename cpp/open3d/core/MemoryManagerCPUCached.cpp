@@ -0,0 +1,403 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+// Every block handed out by the cacher is preceded by a header of
+// kCPUBlockAlignment bytes, so the user pointer stays 64-byte aligned and Free
+// can recover the size class without a global lookup table.
+static constexpr size_t kCPUBlockAlignment = 64;
+static constexpr uint64_t kCPUBlockMagic = 0x4f33444350554d4dULL;
+
+// Blocks up to 1 MiB are kept in per-thread bins. Larger blocks always go
+// through the shared pool.
+static constexpr size_t kMaxThreadCachedBlockSize = 1048576;
+static constexpr size_t kMaxThreadCachedBlocksPerBin = 16;
+
+// Sizes up to 256 bytes use 64-byte steps, larger sizes use 4 classes per
+// power of two, i.e. at most 25% internal fragmentation.
+static constexpr int kNumSizeClasses = 4 + 4 * (64 - 8);
+
+struct CPUBlockHeader {
+    void* raw_ptr_;      // pointer returned by std::malloc
+    int64_t size_class_;  // size class index
+    uint64_t magic_;
+};
+static_assert(sizeof(CPUBlockHeader) <= kCPUBlockAlignment,
+              "CPUBlockHeader must fit in the alignment padding.");
+
+static inline int HighestBit(size_t value) {
+    int msb = 0;
+    while (value >>= 1) {
+        ++msb;
+    }
+    return msb;
+}
+
+static inline int SizeClassIndex(size_t byte_size) {
+    if (byte_size <= 256) {
+        return static_cast<int>((byte_size + 63) / 64) - 1;
+    }
+    int msb = HighestBit(byte_size - 1);
+    size_t spacing = size_t(1) << (msb - 2);
+    size_t offset = byte_size - (size_t(1) << msb);
+    int k = static_cast<int>((offset + spacing - 1) / spacing);
+    return 4 + (msb - 8) * 4 + (k - 1);
+}
+
+static inline size_t SizeClassBytes(int size_class) {
+    if (size_class < 4) {
+        return 64 * static_cast<size_t>(size_class + 1);
+    }
+    int msb = 8 + (size_class - 4) / 4;
+    size_t k = static_cast<size_t>((size_class - 4) % 4 + 1);
+    return (size_t(1) << msb) + k * (size_t(1) << (msb - 2));
+}
+
+static inline CPUBlockHeader* GetHeader(void* ptr) {
+    return reinterpret_cast<CPUBlockHeader*>(static_cast<char*>(ptr) -
+                                             kCPUBlockAlignment);
+}
+
+class CPUThreadCache;
+
+// Set once the calling thread's cache has been destroyed at thread exit, so
+// that frees from later thread_local destructors bypass it.
+static thread_local bool thread_cache_destroyed = false;
+
+// Singleton cacher.
+// Free() does not return memory to the OS. Instead, blocks are binned by size
+// class, first in a small per-thread cache (no contention between OpenMP
+// workers) and then in a shared pool. Malloc() serves requests from the bins
+// whenever possible. The total amount of cached memory is bounded by
+// SetMaxCacheSize(). To clear the cache, use
+// CPUCachedMemoryManager::ReleaseCache().
+class CPUCacher {
+public:
+    static CPUCacher& GetInstance() {
+        // Intentionally leaked: thread caches of worker threads may be
+        // destroyed after static destructors have run.
+        static CPUCacher* instance = new CPUCacher();
+        return *instance;
+    }
+
+    CPUCacher() : pool_(kNumSizeClasses) {}
+
+    void* Malloc(size_t byte_size);
+    void Free(void* ptr);
+    void ReleaseCache();
+
+    /// Return a block to the shared pool or to the OS if the cap is reached.
+    void Recycle(void* ptr, int size_class) {
+        size_t bytes = SizeClassBytes(size_class);
+        if (!ReserveCache(bytes)) {
+            FreeBlock(ptr);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        pool_[size_class].push_back(ptr);
+    }
+
+    bool ReserveCache(size_t bytes) {
+        size_t prev = cached_bytes_.fetch_add(bytes);
+        if (prev + bytes > max_cached_bytes_.load()) {
+            cached_bytes_.fetch_sub(bytes);
+            return false;
+        }
+        return true;
+    }
+
+    void* AllocateBlock(int size_class) {
+        size_t bytes = SizeClassBytes(size_class);
+        void* raw_ptr = std::malloc(bytes + 2 * kCPUBlockAlignment - 1);
+        if (!raw_ptr) {
+            // Give cached memory back to the OS and try once more.
+            ReleaseCache();
+            raw_ptr = std::malloc(bytes + 2 * kCPUBlockAlignment - 1);
+            if (!raw_ptr) {
+                utility::LogError("[CPUCacher] CPU malloc of {} bytes failed.",
+                                  bytes);
+            }
+        }
+        uintptr_t addr = reinterpret_cast<uintptr_t>(raw_ptr) +
+                         kCPUBlockAlignment + kCPUBlockAlignment - 1;
+        addr &= ~static_cast<uintptr_t>(kCPUBlockAlignment - 1);
+        void* ptr = reinterpret_cast<void*>(addr);
+        CPUBlockHeader* header = GetHeader(ptr);
+        header->raw_ptr_ = raw_ptr;
+        header->size_class_ = size_class;
+        header->magic_ = kCPUBlockMagic;
+        return ptr;
+    }
+
+    void FreeBlock(void* ptr) {
+        CPUBlockHeader* header = GetHeader(ptr);
+        header->magic_ = 0;
+        std::free(header->raw_ptr_);
+    }
+
+    void RegisterThreadCache(CPUThreadCache* cache) {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        thread_caches_.insert(cache);
+    }
+
+    void UnregisterThreadCache(CPUThreadCache* cache) {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        thread_caches_.erase(cache);
+    }
+
+public:
+    std::atomic<size_t> max_cached_bytes_{size_t(1) << 30};
+    std::atomic<size_t> cached_bytes_{0};
+    std::atomic<size_t> allocated_bytes_{0};
+    std::atomic<int64_t> num_hits_{0};
+    std::atomic<int64_t> num_misses_{0};
+
+private:
+    std::mutex pool_mutex_;
+    std::vector<std::vector<void*>> pool_;
+
+    std::mutex registry_mutex_;
+    std::unordered_set<CPUThreadCache*> thread_caches_;
+};
+
+// Per-thread bins for small blocks. The mutex is only contended when another
+// thread calls ReleaseCache().
+class CPUThreadCache {
+public:
+    CPUThreadCache() : bins_(kNumSizeClasses) {
+        CPUCacher::GetInstance().RegisterThreadCache(this);
+    }
+
+    ~CPUThreadCache() {
+        CPUCacher& cacher = CPUCacher::GetInstance();
+        cacher.UnregisterThreadCache(this);
+        Flush(/*release_to_os=*/false);
+        thread_cache_destroyed = true;
+    }
+
+    /// Returns nullptr if called during thread exit after the cache is gone.
+    static CPUThreadCache* GetInstance() {
+        if (thread_cache_destroyed) {
+            return nullptr;
+        }
+        static thread_local CPUThreadCache cache;
+        return &cache;
+    }
+
+    void* Pop(int size_class) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<void*>& bin = bins_[size_class];
+        if (bin.empty()) {
+            return nullptr;
+        }
+        void* ptr = bin.back();
+        bin.pop_back();
+        return ptr;
+    }
+
+    bool Push(void* ptr, int size_class) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<void*>& bin = bins_[size_class];
+        if (bin.size() >= kMaxThreadCachedBlocksPerBin) {
+            return false;
+        }
+        bin.push_back(ptr);
+        return true;
+    }
+
+    /// Move all cached blocks to the shared pool, or to the OS if
+    /// release_to_os is true. Cached byte counts stay consistent.
+    size_t Flush(bool release_to_os) {
+        CPUCacher& cacher = CPUCacher::GetInstance();
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t total_bytes = 0;
+        for (int size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+            std::vector<void*>& bin = bins_[size_class];
+            size_t bytes = SizeClassBytes(size_class);
+            for (void* ptr : bin) {
+                cacher.cached_bytes_.fetch_sub(bytes);
+                if (release_to_os) {
+                    cacher.FreeBlock(ptr);
+                    total_bytes += bytes;
+                } else {
+                    cacher.Recycle(ptr, size_class);
+                }
+            }
+            bin.clear();
+        }
+        return total_bytes;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::vector<void*>> bins_;
+};
+
+void* CPUCacher::Malloc(size_t byte_size) {
+    int size_class = SizeClassIndex(byte_size);
+    if (size_class >= kNumSizeClasses) {
+        utility::LogError("[CPUCacher] Allocation of {} bytes is too large.",
+                          byte_size);
+    }
+    size_t bytes = SizeClassBytes(size_class);
+
+    void* ptr = nullptr;
+    CPUThreadCache* thread_cache = CPUThreadCache::GetInstance();
+    if (thread_cache != nullptr && bytes <= kMaxThreadCachedBlockSize) {
+        ptr = thread_cache->Pop(size_class);
+    }
+    if (ptr == nullptr) {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        std::vector<void*>& bin = pool_[size_class];
+        if (!bin.empty()) {
+            ptr = bin.back();
+            bin.pop_back();
+        }
+    }
+
+    if (ptr != nullptr) {
+        cached_bytes_.fetch_sub(bytes);
+        num_hits_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        ptr = AllocateBlock(size_class);
+        num_misses_.fetch_add(1, std::memory_order_relaxed);
+    }
+    allocated_bytes_.fetch_add(bytes);
+    return ptr;
+}
+
+void CPUCacher::Free(void* ptr) {
+    CPUBlockHeader* header = GetHeader(ptr);
+    if (header->magic_ != kCPUBlockMagic) {
+        utility::LogError("[CPUCacher] Invalid pointer {}.", fmt::ptr(ptr));
+    }
+    int size_class = static_cast<int>(header->size_class_);
+    size_t bytes = SizeClassBytes(size_class);
+    allocated_bytes_.fetch_sub(bytes);
+
+    CPUThreadCache* thread_cache = CPUThreadCache::GetInstance();
+    if (thread_cache != nullptr && bytes <= kMaxThreadCachedBlockSize &&
+        ReserveCache(bytes)) {
+        if (thread_cache->Push(ptr, size_class)) {
+            return;
+        }
+        cached_bytes_.fetch_sub(bytes);
+    }
+    Recycle(ptr, size_class);
+}
+
+void CPUCacher::ReleaseCache() {
+    size_t total_bytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        for (CPUThreadCache* cache : thread_caches_) {
+            total_bytes += cache->Flush(/*release_to_os=*/true);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        for (int size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+            std::vector<void*>& bin = pool_[size_class];
+            size_t bytes = SizeClassBytes(size_class);
+            for (void* ptr : bin) {
+                FreeBlock(ptr);
+                cached_bytes_.fetch_sub(bytes);
+                total_bytes += bytes;
+            }
+            bin.clear();
+            bin.shrink_to_fit();
+        }
+    }
+    utility::LogDebug("[CPUCacher] {} bytes released.", total_bytes);
+}
+
+CPUCachedMemoryManager::CPUCachedMemoryManager() {}
+
+void* CPUCachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (byte_size == 0) return nullptr;
+    return CPUCacher::GetInstance().Malloc(byte_size);
+}
+
+void CPUCachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr == nullptr) return;
+    CPUCacher::GetInstance().Free(ptr);
+}
+
+void CPUCachedMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+void CPUCachedMemoryManager::ReleaseCache() {
+    CPUCacher::GetInstance().ReleaseCache();
+}
+
+void CPUCachedMemoryManager::SetMaxCacheSize(size_t byte_size) {
+    CPUCacher& cacher = CPUCacher::GetInstance();
+    cacher.max_cached_bytes_.store(byte_size);
+    if (cacher.cached_bytes_.load() > byte_size) {
+        cacher.ReleaseCache();
+    }
+}
+
+size_t CPUCachedMemoryManager::GetMaxCacheSize() {
+    return CPUCacher::GetInstance().max_cached_bytes_.load();
+}
+
+CPUCacheStatistics CPUCachedMemoryManager::GetStatistics() {
+    CPUCacher& cacher = CPUCacher::GetInstance();
+    CPUCacheStatistics stats;
+    stats.num_hits_ = cacher.num_hits_.load();
+    stats.num_misses_ = cacher.num_misses_.load();
+    stats.cached_bytes_ = cacher.cached_bytes_.load();
+    stats.allocated_bytes_ = cacher.allocated_bytes_.load();
+    return stats;
+}
+
+void CPUCachedMemoryManager::ResetStatistics() {
+    CPUCacher& cacher = CPUCacher::GetInstance();
+    cacher.num_hits_.store(0);
+    cacher.num_misses_.store(0);
+}
+
+}  // namespace core
+}  // namespace open3d
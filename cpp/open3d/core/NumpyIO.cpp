@@ -50,6 +50,10 @@
 
 #include "open3d/core/NumpyIO.h"
 
+#include <zlib.h>
+
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <regex>
@@ -60,6 +64,15 @@
 #include "open3d/core/Dispatch.h"
 #include "open3d/utility/Console.h"
 
+#ifdef WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace open3d {
 namespace core {
 
@@ -98,6 +111,13 @@ static std::string ToByteString(const T& rhs) {
     return ss.str();
 }
 
+template <typename T>
+static T ReadFromBytes(const char* bytes) {
+    T val;
+    std::memcpy(&val, bytes, sizeof(T));
+    return val;
+}
+
 static std::vector<char> CreateNumpyHeader(const SizeVector& shape,
                                            const Dtype& dtype) {
     // {}     -> "()"
@@ -150,19 +170,38 @@ static std::vector<char> CreateNumpyHeader(const SizeVector& shape,
     return std::vector<char>(s.begin(), s.end());
 }
 
-static std::tuple<char, int64_t, SizeVector, bool> ParseNumpyHeader(FILE* fp) {
+/// Parses the magic string, version and header length of a .npy file.
+/// Returns the offset and the size of the header dict.
+static std::pair<int64_t, int64_t> ParseNumpyPreamble(const char* preamble,
+                                                      int64_t size) {
+    if (size < 10 || preamble[0] != (char)0x93 ||
+        std::string(preamble + 1, 5) != "NUMPY") {
+        utility::LogError("ParseNumpyPreamble: not a Numpy file.");
+    }
+    const uint8_t major_version = static_cast<uint8_t>(preamble[6]);
+    if (major_version == 1) {
+        return std::make_pair(int64_t(10),
+                              int64_t(ReadFromBytes<uint16_t>(preamble + 8)));
+    } else if (major_version == 2 || major_version == 3) {
+        if (size < 12) {
+            utility::LogError("ParseNumpyPreamble: truncated header.");
+        }
+        return std::make_pair(int64_t(12),
+                              int64_t(ReadFromBytes<uint32_t>(preamble + 8)));
+    } else {
+        utility::LogError("ParseNumpyPreamble: unsupported version {}.",
+                          major_version);
+    }
+}
+
+static std::tuple<char, int64_t, SizeVector, bool> ParseNumpyHeader(
+        const std::string& header) {
     char type;
     int64_t word_size;
     SizeVector shape;
     bool fortran_order;
 
-    char buffer[256];
-    size_t res = fread(buffer, sizeof(char), 11, fp);
-    if (res != 11) {
-        utility::LogError("ParseNumpyHeader: failed fread");
-    }
-    std::string header = fgets(buffer, 256, fp);
-    if (header[header.size() - 1] != '\n') {
+    if (header.empty() || header[header.size() - 1] != '\n') {
         utility::LogError("ParseNumpyHeader: the last char must be '\n'");
     }
 
@@ -194,7 +233,7 @@ static std::tuple<char, int64_t, SizeVector, bool> ParseNumpyHeader(FILE* fp) {
 
     std::string str_shape = header.substr(loc1 + 1, loc2 - loc1 - 1);
     while (std::regex_search(str_shape, sm, num_regex)) {
-        shape.push_back(std::stoi(sm[0].str()));
+        shape.push_back(std::stoll(sm[0].str()));
         str_shape = sm.suffix().str();
     }
 
@@ -223,6 +262,135 @@ static std::tuple<char, int64_t, SizeVector, bool> ParseNumpyHeader(FILE* fp) {
     return std::make_tuple(type, word_size, shape, fortran_order);
 }
 
+/// Read-only or copy-on-write memory mapping of a whole file.
+class MappedFile {
+public:
+    MappedFile(const std::string& file_name, bool copy_on_write) {
+#ifdef WINDOWS
+        file_ = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            utility::LogError("MappedFile: Unable to open file {}.",
+                              file_name);
+        }
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_, &file_size)) {
+            CloseHandle(file_);
+            utility::LogError("MappedFile: Unable to get size of file {}.",
+                              file_name);
+        }
+        size_ = static_cast<int64_t>(file_size.QuadPart);
+        mapping_ = size_ == 0 ? nullptr
+                              : CreateFileMappingA(
+                                        file_, nullptr,
+                                        copy_on_write ? PAGE_WRITECOPY
+                                                      : PAGE_READONLY,
+                                        0, 0, nullptr);
+        if (mapping_ != nullptr) {
+            data_ = static_cast<char*>(MapViewOfFile(
+                    mapping_, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ,
+                    0, 0, 0));
+        }
+        if (data_ == nullptr) {
+            if (mapping_ != nullptr) {
+                CloseHandle(mapping_);
+            }
+            CloseHandle(file_);
+            utility::LogError("MappedFile: Unable to map file {}.", file_name);
+        }
+#else
+        int fd = open(file_name.c_str(), O_RDONLY);
+        if (fd < 0) {
+            utility::LogError("MappedFile: Unable to open file {}.",
+                              file_name);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            utility::LogError("MappedFile: Unable to get size of file {}.",
+                              file_name);
+        }
+        size_ = static_cast<int64_t>(info.st_size);
+        void* data = size_ == 0 ? MAP_FAILED
+                                : mmap(nullptr, static_cast<size_t>(size_),
+                                       copy_on_write ? PROT_READ | PROT_WRITE
+                                                     : PROT_READ,
+                                       copy_on_write ? MAP_PRIVATE : MAP_SHARED,
+                                       fd, 0);
+        // The mapping stays valid after the file descriptor is closed.
+        close(fd);
+        if (data == MAP_FAILED) {
+            utility::LogError("MappedFile: Unable to map file {}.", file_name);
+        }
+        data_ = static_cast<char*>(data);
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef WINDOWS
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_);
+        CloseHandle(file_);
+#else
+        munmap(data_, static_cast<size_t>(size_));
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    char* GetData() const { return data_; }
+
+    int64_t GetSize() const { return size_; }
+
+private:
+    char* data_ = nullptr;
+    int64_t size_ = 0;
+#ifdef WINDOWS
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#endif
+};
+
+/// Parses the .npy file in [data, data + size). If \p owner is set, the array
+/// refers to data directly and keeps \p owner alive, otherwise the data is
+/// copied. Misaligned data is always copied.
+static NumpyArray ParseNumpyBuffer(const char* data,
+                                   int64_t size,
+                                   const std::shared_ptr<void>& owner,
+                                   const std::string& name) {
+    int64_t header_offset, header_size;
+    std::tie(header_offset, header_size) = ParseNumpyPreamble(data, size);
+    if (header_offset + header_size > size) {
+        utility::LogError("{}: truncated Numpy header.", name);
+    }
+    SizeVector shape;
+    int64_t word_size;
+    bool fortran_order;
+    char type;
+    std::tie(type, word_size, shape, fortran_order) = ParseNumpyHeader(
+            std::string(data + header_offset, header_size));
+
+    const char* array_data = data + header_offset + header_size;
+    const int64_t num_bytes = shape.NumElements() * word_size;
+    if (num_bytes > size - header_offset - header_size) {
+        utility::LogError("{}: expected {} bytes of array data, but got {}.",
+                          name, num_bytes, size - header_offset - header_size);
+    }
+    if (owner != nullptr && word_size > 0 &&
+        reinterpret_cast<uintptr_t>(array_data) % word_size == 0) {
+        auto blob = std::make_shared<Blob>(Device("CPU:0"),
+                                           const_cast<char*>(array_data),
+                                           [owner](void*) {});
+        return NumpyArray(shape, type, word_size, fortran_order, blob);
+    }
+    NumpyArray arr(shape, type, word_size, fortran_order);
+    std::memcpy(arr.GetDataPtr<char>(), array_data,
+                static_cast<size_t>(num_bytes));
+    return arr;
+}
+
 NumpyArray::NumpyArray(const SizeVector& shape,
                        char type,
                        int64_t word_size,
@@ -238,6 +406,18 @@ NumpyArray::NumpyArray(const SizeVector& shape,
     blob_ = std::make_shared<Blob>(num_elements_ * word_size_, Device("CPU:0"));
 }
 
+NumpyArray::NumpyArray(const SizeVector& shape,
+                       char type,
+                       int64_t word_size,
+                       bool fortran_order,
+                       const std::shared_ptr<Blob>& blob)
+    : blob_(blob),
+      shape_(shape),
+      type_(type),
+      word_size_(word_size),
+      fortran_order_(fortran_order),
+      num_elements_(shape.NumElements()) {}
+
 NumpyArray::NumpyArray(const Tensor& t)
     : shape_(t.GetShape()),
       type_(DtypeToChar(t.GetDtype())),
@@ -288,23 +468,43 @@ NumpyArray NumpyArray::Load(const std::string& file_name) {
     if (!fp) {
         utility::LogError("NumpyLoad: Unable to open file {}.", file_name);
     }
+    char preamble[12];
+    size_t num_read = fread(preamble, sizeof(char), 12, fp);
+    int64_t header_offset, header_size;
+    std::tie(header_offset, header_size) =
+            ParseNumpyPreamble(preamble, static_cast<int64_t>(num_read));
+    std::string header(static_cast<size_t>(header_size), ' ');
+    fseek(fp, static_cast<long>(header_offset), SEEK_SET);
+    if (fread(&header[0], sizeof(char), header.size(), fp) != header.size()) {
+        fclose(fp);
+        utility::LogError("NumpyLoad: failed fread");
+    }
     SizeVector shape;
     int64_t word_size;
     bool fortran_order;
     char type;
-    std::tie(type, word_size, shape, fortran_order) = ParseNumpyHeader(fp);
+    std::tie(type, word_size, shape, fortran_order) = ParseNumpyHeader(header);
     NumpyArray arr(shape, type, word_size, fortran_order);
     size_t nread = fread(arr.GetDataPtr<char>(), 1,
                          static_cast<size_t>(arr.NumBytes()), fp);
+    fclose(fp);
     if (nread != static_cast<size_t>(arr.NumBytes())) {
         utility::LogError("LoadTheNumpyFile: failed fread");
     }
-    fclose(fp);
     return arr;
 }
 
+NumpyArray NumpyArray::LoadMmap(const std::string& file_name,
+                                bool copy_on_write) {
+    auto file = std::make_shared<MappedFile>(file_name, copy_on_write);
+    return ParseNumpyBuffer(file->GetData(), file->GetSize(), file, file_name);
+}
+
 void NumpyArray::Save(std::string file_name) const {
     FILE* fp = fopen(file_name.c_str(), "wb");
+    if (!fp) {
+        utility::LogError("NumpySave: Unable to open file {}.", file_name);
+    }
     std::vector<char> header = CreateNumpyHeader(shape_, GetDtype());
     fseek(fp, 0, SEEK_SET);
     fwrite(&header[0], sizeof(char), header.size(), fp);
@@ -314,5 +514,368 @@ void NumpyArray::Save(std::string file_name) const {
     fclose(fp);
 }
 
+// Zip archive records used by .npz files. All fields are little-endian.
+static constexpr uint32_t kZipLocalHeaderSignature = 0x04034b50;
+static constexpr uint32_t kZipCentralHeaderSignature = 0x02014b50;
+static constexpr uint32_t kZipEndOfCentralDirSignature = 0x06054b50;
+static constexpr uint32_t kZip64EndOfCentralDirSignature = 0x06064b50;
+static constexpr uint32_t kZip64EndOfCentralDirLocatorSignature = 0x07064b50;
+static constexpr uint16_t kZip64ExtraFieldId = 0x0001;
+static constexpr uint32_t kZip32Max = 0xffffffff;
+static constexpr uint16_t kZipStored = 0;
+static constexpr uint16_t kZipDeflated = 8;
+
+/// Alignment of the array entries written by WriteNpz().
+static constexpr int64_t kNpzEntryAlignment = 64;
+
+struct ZipEntry {
+    std::string name;
+    uint16_t compression;
+    int64_t compressed_size;
+    int64_t uncompressed_size;
+    int64_t local_header_offset;
+};
+
+/// Reads the central directory of the zip archive in [data, data + size).
+static std::vector<ZipEntry> ReadZipDirectory(const char* data,
+                                              int64_t size,
+                                              const std::string& file_name) {
+    auto check_range = [&](int64_t offset, int64_t length) {
+        if (offset < 0 || length < 0 || offset + length > size) {
+            utility::LogError("ReadNpz: {} is not a valid zip archive.",
+                              file_name);
+        }
+    };
+
+    // The end of central directory record is followed by a comment of at
+    // most 65535 bytes.
+    int64_t eocd = -1;
+    for (int64_t offset = size - 22;
+         offset >= std::max(int64_t(0), size - 22 - 65535); --offset) {
+        if (ReadFromBytes<uint32_t>(data + offset) ==
+            kZipEndOfCentralDirSignature) {
+            eocd = offset;
+            break;
+        }
+    }
+    check_range(eocd, 22);
+    int64_t num_entries = ReadFromBytes<uint16_t>(data + eocd + 10);
+    int64_t dir_size = ReadFromBytes<uint32_t>(data + eocd + 12);
+    int64_t dir_offset = ReadFromBytes<uint32_t>(data + eocd + 16);
+    if (num_entries == 0xffff || dir_size == kZip32Max ||
+        dir_offset == kZip32Max) {
+        const int64_t locator = eocd - 20;
+        check_range(locator, 20);
+        if (ReadFromBytes<uint32_t>(data + locator) !=
+            kZip64EndOfCentralDirLocatorSignature) {
+            utility::LogError("ReadNpz: {} is not a valid zip archive.",
+                              file_name);
+        }
+        const int64_t eocd64 = ReadFromBytes<uint64_t>(data + locator + 8);
+        check_range(eocd64, 56);
+        if (ReadFromBytes<uint32_t>(data + eocd64) !=
+            kZip64EndOfCentralDirSignature) {
+            utility::LogError("ReadNpz: {} is not a valid zip archive.",
+                              file_name);
+        }
+        num_entries = ReadFromBytes<uint64_t>(data + eocd64 + 32);
+        dir_size = ReadFromBytes<uint64_t>(data + eocd64 + 40);
+        dir_offset = ReadFromBytes<uint64_t>(data + eocd64 + 48);
+    }
+    check_range(dir_offset, dir_size);
+
+    std::vector<ZipEntry> entries;
+    int64_t offset = dir_offset;
+    for (int64_t i = 0; i < num_entries; ++i) {
+        check_range(offset, 46);
+        const char* header = data + offset;
+        if (ReadFromBytes<uint32_t>(header) != kZipCentralHeaderSignature) {
+            utility::LogError("ReadNpz: {} is not a valid zip archive.",
+                              file_name);
+        }
+        ZipEntry entry;
+        entry.compression = ReadFromBytes<uint16_t>(header + 10);
+        entry.compressed_size = ReadFromBytes<uint32_t>(header + 20);
+        entry.uncompressed_size = ReadFromBytes<uint32_t>(header + 24);
+        const int64_t name_size = ReadFromBytes<uint16_t>(header + 28);
+        const int64_t extra_size = ReadFromBytes<uint16_t>(header + 30);
+        const int64_t comment_size = ReadFromBytes<uint16_t>(header + 32);
+        entry.local_header_offset = ReadFromBytes<uint32_t>(header + 42);
+        check_range(offset + 46, name_size + extra_size + comment_size);
+        entry.name = std::string(header + 46, name_size);
+
+        // Sizes and offsets that do not fit into 32 bits are stored in the
+        // zip64 extra field, in this order.
+        const char* extra = header + 46 + name_size;
+        for (int64_t e = 0; e + 4 <= extra_size;) {
+            const uint16_t id = ReadFromBytes<uint16_t>(extra + e);
+            const int64_t field_size = ReadFromBytes<uint16_t>(extra + e + 2);
+            if (id == kZip64ExtraFieldId) {
+                const char* field = extra + e + 4;
+                const char* field_end = field + field_size;
+                for (int64_t* value :
+                     {&entry.uncompressed_size, &entry.compressed_size,
+                      &entry.local_header_offset}) {
+                    if (*value == kZip32Max && field + 8 <= field_end) {
+                        *value = ReadFromBytes<uint64_t>(field);
+                        field += 8;
+                    }
+                }
+            }
+            e += 4 + field_size;
+        }
+        entries.push_back(entry);
+        offset += 46 + name_size + extra_size + comment_size;
+    }
+    return entries;
+}
+
+/// Decompresses a raw deflate stream of known decompressed size.
+static std::shared_ptr<std::vector<char>> Inflate(const char* src,
+                                                  int64_t src_size,
+                                                  int64_t dst_size,
+                                                  const std::string& name) {
+    auto dst = std::make_shared<std::vector<char>>(dst_size);
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        utility::LogError("ReadNpz: failed to initialize zlib.");
+    }
+    // avail_in and avail_out are 32-bit, feed large buffers in chunks.
+    const int64_t max_chunk = std::numeric_limits<uInt>::max();
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(src));
+    stream.next_out = reinterpret_cast<Bytef*>(dst->data());
+    int64_t src_left = src_size;
+    int64_t dst_left = dst_size;
+    int ret = Z_OK;
+    while (ret == Z_OK) {
+        if (stream.avail_in == 0) {
+            stream.avail_in = static_cast<uInt>(std::min(src_left, max_chunk));
+            src_left -= stream.avail_in;
+        }
+        if (stream.avail_out == 0) {
+            stream.avail_out = static_cast<uInt>(std::min(dst_left, max_chunk));
+            dst_left -= stream.avail_out;
+        }
+        ret = inflate(&stream, Z_NO_FLUSH);
+    }
+    const bool is_complete =
+            ret == Z_STREAM_END && dst_left == 0 && stream.avail_out == 0;
+    inflateEnd(&stream);
+    if (!is_complete) {
+        utility::LogError("ReadNpz: failed to decompress {}.", name);
+    }
+    return dst;
+}
+
+static std::unordered_map<std::string, Tensor> ReadNpzFromMappedFile(
+        const std::string& file_name,
+        const std::shared_ptr<MappedFile>& file,
+        bool keep_mapping) {
+    const char* data = file->GetData();
+    const int64_t size = file->GetSize();
+    std::unordered_map<std::string, Tensor> tensor_map;
+    for (const ZipEntry& entry : ReadZipDirectory(data, size, file_name)) {
+        const int64_t local = entry.local_header_offset;
+        if (local < 0 || local + 30 > size ||
+            ReadFromBytes<uint32_t>(data + local) != kZipLocalHeaderSignature) {
+            utility::LogError("ReadNpz: {} is not a valid zip archive.",
+                              file_name);
+        }
+        const int64_t entry_offset =
+                local + 30 + ReadFromBytes<uint16_t>(data + local + 26) +
+                ReadFromBytes<uint16_t>(data + local + 28);
+        if (entry_offset + entry.compressed_size > size) {
+            utility::LogError("ReadNpz: {} in {} is truncated.", entry.name,
+                              file_name);
+        }
+
+        std::string name = entry.name;
+        if (name.size() >= 4 && name.substr(name.size() - 4) == ".npy") {
+            name = name.substr(0, name.size() - 4);
+        }
+        if (entry.compression == kZipStored) {
+            tensor_map[name] =
+                    ParseNumpyBuffer(data + entry_offset,
+                                     entry.uncompressed_size,
+                                     keep_mapping ? file : nullptr, entry.name)
+                            .ToTensor();
+        } else if (entry.compression == kZipDeflated) {
+            std::shared_ptr<std::vector<char>> buffer =
+                    Inflate(data + entry_offset, entry.compressed_size,
+                            entry.uncompressed_size, entry.name);
+            tensor_map[name] =
+                    ParseNumpyBuffer(buffer->data(),
+                                     static_cast<int64_t>(buffer->size()),
+                                     buffer, entry.name)
+                            .ToTensor();
+        } else {
+            utility::LogError(
+                    "ReadNpz: unsupported compression method {} for {}.",
+                    entry.compression, entry.name);
+        }
+    }
+    return tensor_map;
+}
+
+std::unordered_map<std::string, Tensor> ReadNpz(const std::string& file_name) {
+    return ReadNpzFromMappedFile(
+            file_name, std::make_shared<MappedFile>(file_name, false), false);
+}
+
+std::unordered_map<std::string, Tensor> ReadNpzMmap(
+        const std::string& file_name, bool copy_on_write) {
+    return ReadNpzFromMappedFile(
+            file_name, std::make_shared<MappedFile>(file_name, copy_on_write),
+            true);
+}
+
+void WriteNpz(const std::string& file_name,
+              const std::unordered_map<std::string, Tensor>& tensor_map) {
+    FILE* fp = fopen(file_name.c_str(), "wb");
+    if (!fp) {
+        utility::LogError("WriteNpz: Unable to open file {}.", file_name);
+    }
+    auto write_string = [&](const std::string& str) {
+        fwrite(str.data(), sizeof(char), str.size(), fp);
+    };
+
+    std::string central_dir;
+    int64_t offset = 0;
+    for (const auto& kv : tensor_map) {
+        const NumpyArray arr(kv.second);
+        const std::vector<char> header =
+                CreateNumpyHeader(arr.GetShape(), arr.GetDtype());
+        const std::string name = kv.first + ".npy";
+        const int64_t entry_size =
+                static_cast<int64_t>(header.size()) + arr.NumBytes();
+
+        uLong crc = crc32(0L, Z_NULL, 0);
+        crc = crc32(crc, reinterpret_cast<const Bytef*>(header.data()),
+                    static_cast<uInt>(header.size()));
+        const int64_t max_chunk = std::numeric_limits<uInt>::max();
+        for (int64_t i = 0; i < arr.NumBytes(); i += max_chunk) {
+            crc = crc32(crc, arr.GetDataPtr<Bytef>() + i,
+                        static_cast<uInt>(
+                                std::min(max_chunk, arr.NumBytes() - i)));
+        }
+
+        // Sizes and offsets beyond 32 bits go to the zip64 extra field.
+        const bool is_large_entry = entry_size >= kZip32Max;
+        const bool is_large_offset = offset >= kZip32Max;
+        const uint16_t version = is_large_entry || is_large_offset ? 45 : 20;
+        std::string local_extra;
+        if (is_large_entry) {
+            local_extra += ToByteString(kZip64ExtraFieldId);
+            local_extra += ToByteString(uint16_t(16));
+            local_extra += ToByteString(uint64_t(entry_size));
+            local_extra += ToByteString(uint64_t(entry_size));
+        }
+        // Pad the extra field so that the array data is aligned.
+        int64_t padding = (kNpzEntryAlignment -
+                           (offset + 30 + static_cast<int64_t>(name.size()) +
+                            static_cast<int64_t>(local_extra.size())) %
+                                   kNpzEntryAlignment) %
+                          kNpzEntryAlignment;
+        if (padding > 0 && padding < 4) {
+            padding += kNpzEntryAlignment;
+        }
+        if (padding > 0) {
+            local_extra += ToByteString(uint16_t(0x4f33));
+            local_extra += ToByteString(uint16_t(padding - 4));
+            local_extra += std::string(padding - 4, '\0');
+        }
+
+        const uint32_t size32 =
+                is_large_entry ? kZip32Max : static_cast<uint32_t>(entry_size);
+        std::string local_header;
+        local_header += ToByteString(kZipLocalHeaderSignature);
+        local_header += ToByteString(version);
+        local_header += ToByteString(uint16_t(0));  // Flags.
+        local_header += ToByteString(kZipStored);
+        local_header += ToByteString(uint16_t(0));     // Time.
+        local_header += ToByteString(uint16_t(0x21));  // Date: 1980-01-01.
+        local_header += ToByteString(static_cast<uint32_t>(crc));
+        local_header += ToByteString(size32);
+        local_header += ToByteString(size32);
+        local_header += ToByteString(static_cast<uint16_t>(name.size()));
+        local_header += ToByteString(static_cast<uint16_t>(local_extra.size()));
+        write_string(local_header + name + local_extra);
+        fwrite(header.data(), sizeof(char), header.size(), fp);
+        fwrite(arr.GetDataPtr<char>(), sizeof(char),
+               static_cast<size_t>(arr.NumBytes()), fp);
+
+        std::string central_extra;
+        if (is_large_entry || is_large_offset) {
+            central_extra += ToByteString(kZip64ExtraFieldId);
+            central_extra += ToByteString(static_cast<uint16_t>(
+                    (is_large_entry ? 16 : 0) + (is_large_offset ? 8 : 0)));
+            if (is_large_entry) {
+                central_extra += ToByteString(uint64_t(entry_size));
+                central_extra += ToByteString(uint64_t(entry_size));
+            }
+            if (is_large_offset) {
+                central_extra += ToByteString(uint64_t(offset));
+            }
+        }
+        central_dir += ToByteString(kZipCentralHeaderSignature);
+        central_dir += ToByteString(version);  // Version made by.
+        // Version needed, flags, method, time, date, CRC, sizes, name size.
+        central_dir += local_header.substr(4, 24);
+        central_dir +=
+                ToByteString(static_cast<uint16_t>(central_extra.size()));
+        central_dir += ToByteString(uint16_t(0));  // Comment size.
+        central_dir += ToByteString(uint16_t(0));  // Disk number.
+        central_dir += ToByteString(uint16_t(0));  // Internal attributes.
+        central_dir += ToByteString(uint32_t(0));  // External attributes.
+        central_dir += ToByteString(
+                is_large_offset ? kZip32Max : static_cast<uint32_t>(offset));
+        central_dir += name + central_extra;
+
+        offset += static_cast<int64_t>(local_header.size() + name.size() +
+                                       local_extra.size()) +
+                  entry_size;
+    }
+
+    const int64_t num_entries = static_cast<int64_t>(tensor_map.size());
+    const int64_t dir_size = static_cast<int64_t>(central_dir.size());
+    write_string(central_dir);
+    const bool is_zip64 = num_entries >= 0xffff || dir_size >= kZip32Max ||
+                          offset >= kZip32Max;
+    if (is_zip64) {
+        const int64_t eocd64 = offset + dir_size;
+        std::string record;
+        record += ToByteString(kZip64EndOfCentralDirSignature);
+        record += ToByteString(uint64_t(44));  // Size of remaining record.
+        record += ToByteString(uint16_t(45));  // Version made by.
+        record += ToByteString(uint16_t(45));  // Version needed.
+        record += ToByteString(uint32_t(0));   // Disk number.
+        record += ToByteString(uint32_t(0));   // Disk with central directory.
+        record += ToByteString(uint64_t(num_entries));
+        record += ToByteString(uint64_t(num_entries));
+        record += ToByteString(uint64_t(dir_size));
+        record += ToByteString(uint64_t(offset));
+        record += ToByteString(kZip64EndOfCentralDirLocatorSignature);
+        record += ToByteString(uint32_t(0));  // Disk with zip64 record.
+        record += ToByteString(uint64_t(eocd64));
+        record += ToByteString(uint32_t(1));  // Number of disks.
+        write_string(record);
+    }
+    const uint16_t num_entries16 =
+            is_zip64 ? 0xffff : static_cast<uint16_t>(num_entries);
+    std::string eocd;
+    eocd += ToByteString(kZipEndOfCentralDirSignature);
+    eocd += ToByteString(uint16_t(0));  // Disk number.
+    eocd += ToByteString(uint16_t(0));  // Disk with central directory.
+    eocd += ToByteString(num_entries16);
+    eocd += ToByteString(num_entries16);
+    eocd += ToByteString(is_zip64 ? kZip32Max
+                                  : static_cast<uint32_t>(dir_size));
+    eocd += ToByteString(is_zip64 ? kZip32Max : static_cast<uint32_t>(offset));
+    eocd += ToByteString(uint16_t(0));  // Comment size.
+    write_string(eocd);
+    fclose(fp);
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include "open3d/core/Blob.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -45,6 +48,14 @@ public:
                int64_t word_size,
                bool fortran_order);
 
+    /// Constructs an array referring to existing data. The array data starts
+    /// at blob->GetDataPtr().
+    NumpyArray(const SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<Blob>& blob);
+
     template <typename T>
     T* GetDataPtr() {
         return reinterpret_cast<T*>(blob_->GetDataPtr());
@@ -67,6 +78,17 @@ public:
 
     static NumpyArray Load(const std::string& file_name);
 
+    /// Memory-maps a .npy file. The array data refers to the mapping, which is
+    /// released when the last Tensor referring to it is destroyed. Pages are
+    /// read from disk on first access.
+    ///
+    /// \param file_name Path to the .npy file.
+    /// \param copy_on_write If false, the mapping is read-only and writing to
+    /// the array is undefined behavior. If true, writes go to private copies of
+    /// the touched pages and are not written back to the file.
+    static NumpyArray LoadMmap(const std::string& file_name,
+                               bool copy_on_write = false);
+
     void Save(std::string file_name) const;
 
 private:
@@ -78,5 +100,21 @@ private:
     int64_t num_elements_;
 };
 
+/// Reads all arrays of a NumPy .npz archive, as written by numpy.savez() or
+/// numpy.savez_compressed(). Keys are the array names without the ".npy"
+/// extension.
+std::unordered_map<std::string, Tensor> ReadNpz(const std::string& file_name);
+
+/// Memory-maps a NumPy .npz archive. Arrays stored without compression refer
+/// to the mapping directly, compressed arrays are decompressed into memory.
+/// See NumpyArray::LoadMmap() for \p copy_on_write.
+std::unordered_map<std::string, Tensor> ReadNpzMmap(
+        const std::string& file_name, bool copy_on_write = false);
+
+/// Writes tensors to an uncompressed NumPy .npz archive. Arrays are aligned in
+/// the archive so that they can be memory-mapped with ReadNpzMmap().
+void WriteNpz(const std::string& file_name,
+              const std::unordered_map<std::string, Tensor>& tensor_map);
+
 }  // namespace core
 }  // namespace open3d
@@ -240,6 +240,58 @@ Tensor Tensor::Arange(Scalar start,
     return kernel::Arange(t_start, t_stop, t_step);
 }
 
+Tensor Tensor::Concatenate(const std::vector<Tensor>& tensors, int64_t axis) {
+    if (tensors.empty()) {
+        utility::LogError("Need at least one tensor to concatenate.");
+    }
+    const Tensor& first = tensors[0];
+    if (first.NumDims() == 0) {
+        utility::LogError("Cannot concatenate 0-dim tensors.");
+    }
+    axis = shape_util::WrapDim(axis, first.NumDims());
+
+    SizeVector dst_shape = first.GetShape();
+    dst_shape[axis] = 0;
+    for (const Tensor& t : tensors) {
+        if (t.GetDtype() != first.GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              t.GetDtype().ToString(),
+                              first.GetDtype().ToString());
+        }
+        if (t.GetDevice() != first.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              t.GetDevice().ToString(),
+                              first.GetDevice().ToString());
+        }
+        if (t.NumDims() != first.NumDims()) {
+            utility::LogError(
+                    "Cannot concatenate tensors of shape {} and {}.",
+                    t.GetShape().ToString(), first.GetShape().ToString());
+        }
+        for (int64_t d = 0; d < first.NumDims(); ++d) {
+            if (d != axis && t.GetShape(d) != first.GetShape(d)) {
+                utility::LogError(
+                        "Cannot concatenate tensors of shape {} and {} along "
+                        "axis {}.",
+                        t.GetShape().ToString(), first.GetShape().ToString(),
+                        axis);
+            }
+        }
+        dst_shape[axis] += t.GetShape(axis);
+    }
+
+    Tensor dst(dst_shape, first.GetDtype(), first.GetDevice());
+    int64_t offset = 0;
+    for (const Tensor& t : tensors) {
+        const int64_t length = t.GetShape(axis);
+        if (length > 0) {
+            dst.Slice(axis, offset, offset + length).AsRvalue() = t;
+        }
+        offset += length;
+    }
+    return dst;
+}
+
 Tensor Tensor::GetItem(const TensorKey& tk) const {
     if (tk.GetMode() == TensorKey::TensorKeyMode::Index) {
         return IndexExtract(0, tk.GetIndex());
@@ -335,7 +387,16 @@ Tensor Tensor::SetItem(const Tensor& value) {
 
 Tensor Tensor::SetItem(const TensorKey& tk, const Tensor& value) {
     if (tk.GetMode() == TensorKey::TensorKeyMode::IndexTensor) {
-        IndexSet({tk.GetIndexTensor()}, value);
+        const Tensor& index_tensor = tk.GetIndexTensor();
+        if (index_tensor.GetDtype() == Dtype::Bool &&
+            index_tensor.GetShape() == shape_ && value.NumElements() == 1 &&
+            GetDevice().GetType() == Device::DeviceType::CPU) {
+            // Full boolean mask with a single value, no need to convert the
+            // mask to indices.
+            MaskedFill_(index_tensor, value);
+        } else {
+            IndexSet({index_tensor}, value);
+        }
     } else {
         this->GetItem(tk) = value;
     }
@@ -654,6 +715,25 @@ void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                      aip.GetIndexedShape(), aip.GetIndexedStrides());
 }
 
+Tensor Tensor::Gather(const Tensor& indices) const {
+    return kernel::Gather(*this, indices);
+}
+
+Tensor Tensor::ScatterAdd_(const Tensor& indices, const Tensor& src) {
+    kernel::Scatter(src, indices, *this, kernel::ScatterOpCode::Add);
+    return *this;
+}
+
+Tensor Tensor::ScatterMax_(const Tensor& indices, const Tensor& src) {
+    kernel::Scatter(src, indices, *this, kernel::ScatterOpCode::Max);
+    return *this;
+}
+
+Tensor Tensor::MaskedFill_(const Tensor& mask, const Tensor& value) {
+    kernel::MaskedFill(*this, mask, value);
+    return *this;
+}
+
 Tensor Tensor::Permute(const SizeVector& dims) const {
     // Check dimension size
     if (static_cast<int64_t>(dims.size()) != NumDims()) {
@@ -1067,6 +1147,51 @@ std::vector<Tensor> Tensor::NonZeroNumpy() const {
 
 Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
 
+Tensor Tensor::ArgSort() const { return kernel::ArgSort(*this); }
+
+Tensor Tensor::Sort() const {
+    return Reshape({NumElements()}).IndexGet({ArgSort()});
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique(bool return_inverse,
+                                                  bool return_counts) const {
+    return kernel::Unique(*this, return_inverse, return_counts);
+}
+
+Tensor Tensor::CumSum(int64_t dim) const { return kernel::CumSum(*this, dim); }
+
+/// The number of segments of sorted segment ids is the last id + 1.
+static int64_t InferNumSegments(const Tensor& segment_ids) {
+    if (segment_ids.NumElements() == 0) {
+        return 0;
+    }
+    return segment_ids[segment_ids.GetLength() - 1].Item<int64_t>() + 1;
+}
+
+Tensor Tensor::SegmentSum(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return kernel::SegmentReduce(
+            *this, segment_ids,
+            num_segments < 0 ? InferNumSegments(segment_ids) : num_segments,
+            kernel::SegmentReduceOpCode::Sum);
+}
+
+Tensor Tensor::SegmentMean(const Tensor& segment_ids,
+                           int64_t num_segments) const {
+    return kernel::SegmentReduce(
+            *this, segment_ids,
+            num_segments < 0 ? InferNumSegments(segment_ids) : num_segments,
+            kernel::SegmentReduceOpCode::Mean);
+}
+
+Tensor Tensor::SegmentMax(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return kernel::SegmentReduce(
+            *this, segment_ids,
+            num_segments < 0 ? InferNumSegments(segment_ids) : num_segments,
+            kernel::SegmentReduceOpCode::Max);
+}
+
 bool Tensor::IsNonZero() const {
     if (shape_.NumElements() != 1) {
         utility::LogError(
@@ -1198,6 +1323,10 @@ Tensor Tensor::Load(const std::string& file_name) {
     return NumpyArray::Load(file_name).ToTensor();
 }
 
+Tensor Tensor::LoadMmap(const std::string& file_name, bool copy_on_write) {
+    return NumpyArray::LoadMmap(file_name, copy_on_write).ToTensor();
+}
+
 bool Tensor::AllClose(const Tensor& other, double rtol, double atol) const {
     // TODO: support nan;
     return IsClose(other, rtol, atol).All();
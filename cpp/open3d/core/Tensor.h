@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <type_traits>
 
 #include "open3d/core/Blob.h"
@@ -340,6 +341,13 @@ public:
                          Dtype dtype = Dtype::Int64,
                          const Device& device = core::Device("CPU:0"));
 
+    /// Concatenate tensors along \p axis into a new tensor. All tensors must
+    /// have the same dtype, device and number of dimensions, and the same
+    /// shape except in \p axis. Each tensor is copied directly into its slice
+    /// of the result.
+    static Tensor Concatenate(const std::vector<Tensor>& tensors,
+                              int64_t axis = 0);
+
     /// Pythonic __getitem__ for tensor.
     ///
     /// Returns a view of the original tensor, if TensorKey is
@@ -536,6 +544,39 @@ public:
     void IndexSet(const std::vector<Tensor>& index_tensors,
                   const Tensor& src_tensor);
 
+    /// Gathers rows along dim 0, i.e. dst[i] = this[indices[i]]. Equivalent
+    /// to IndexGet({indices}), but copies whole rows.
+    ///
+    /// \param indices Int64 tensor of shape {M}.
+    /// \return Tensor of shape {M, ...}.
+    Tensor Gather(const Tensor& indices) const;
+
+    /// In-place scatter-add of rows along dim 0, i.e.
+    /// this[indices[i]] += src[i]. Unlike IndexSet(), repeated indices are
+    /// accumulated.
+    ///
+    /// \param indices Int64 tensor of shape {N}.
+    /// \param src Tensor of shape {N, ...} with the same dtype and the same
+    /// row shape as this tensor.
+    Tensor ScatterAdd_(const Tensor& indices, const Tensor& src);
+
+    /// In-place scatter-max of rows along dim 0, i.e.
+    /// this[indices[i]] = max(this[indices[i]], src[i]). See ScatterAdd_().
+    Tensor ScatterMax_(const Tensor& indices, const Tensor& src);
+
+    /// In-place masked assignment, i.e. this[mask] = value, without
+    /// materializing the indices of the mask.
+    ///
+    /// \param mask Bool tensor broadcastable to the shape of this tensor.
+    /// \param value Single-element tensor, converted to the dtype of this
+    /// tensor.
+    Tensor MaskedFill_(const Tensor& mask, const Tensor& value);
+    template <typename T>
+    Tensor MaskedFill_(const Tensor& mask, T scalar_value) {
+        return MaskedFill_(mask,
+                           Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+    }
+
     /// \brief Permute (dimension shuffle) the Tensor, returns a view.
     ///
     /// \param dims The desired ordering of dimensions.
@@ -962,6 +1003,48 @@ public:
     /// tensor.
     Tensor NonZero() const;
 
+    /// Returns the int64 indices that sort the flattened tensor in ascending
+    /// order. The sort is stable. All dtypes are radix sorted in O(n) passes.
+    Tensor ArgSort() const;
+
+    /// Returns the flattened tensor sorted in ascending order.
+    Tensor Sort() const;
+
+    /// Returns the sorted unique values of the flattened tensor, as a tuple
+    /// (unique, inverse, counts).
+    ///
+    /// \param return_inverse If true, inverse is an int64 tensor with the
+    /// shape of this tensor, holding the index of each element in unique.
+    /// Otherwise inverse is empty.
+    /// \param return_counts If true, counts is an int64 tensor with the
+    /// number of occurrences of each unique value. Otherwise counts is empty.
+    std::tuple<Tensor, Tensor, Tensor> Unique(bool return_inverse = false,
+                                              bool return_counts = false) const;
+
+    /// Inclusive prefix sum along \p dim. The result has the same dtype.
+    Tensor CumSum(int64_t dim) const;
+
+    /// Sums the rows of this tensor with the same segment id, i.e.
+    /// dst[segment_ids[i]] += this[i].
+    ///
+    /// \param segment_ids Int64 tensor of shape {N}, where N is the length of
+    /// this tensor. The ids must be sorted, e.g. the inverse of Unique()
+    /// indexed by ArgSort().
+    /// \param num_segments Length of the result. If negative, the last
+    /// segment id + 1 is used. Empty segments are 0.
+    Tensor SegmentSum(const Tensor& segment_ids,
+                      int64_t num_segments = -1) const;
+
+    /// Mean of the rows of this tensor with the same segment id. For integer
+    /// dtypes the mean is truncated. See SegmentSum() for the arguments.
+    Tensor SegmentMean(const Tensor& segment_ids,
+                       int64_t num_segments = -1) const;
+
+    /// Maximum of the rows of this tensor with the same segment id. See
+    /// SegmentSum() for the arguments.
+    Tensor SegmentMax(const Tensor& segment_ids,
+                      int64_t num_segments = -1) const;
+
     /// Evaluate a single-element Tensor as a boolean value. This can be used to
     /// implement Tensor.__bool__() in Python, e.g.
     /// ```python
@@ -1132,6 +1215,15 @@ public:
     /// Load tensor from numpy's npy format.
     static Tensor Load(const std::string& file_name);
 
+    /// Memory-map a tensor from numpy's npy format. The data is read from disk
+    /// lazily and is shared with the page cache, see NumpyArray::LoadMmap().
+    ///
+    /// \param file_name Path to the .npy file.
+    /// \param copy_on_write If false, the tensor must not be modified. If
+    /// true, modifications are private to the tensor.
+    static Tensor LoadMmap(const std::string& file_name,
+                           bool copy_on_write = false);
+
     /// Assert that the Tensor has the specified shape.
     void AssertShape(const SizeVector& expected_shape,
                      const std::string& error_msg = "") const;
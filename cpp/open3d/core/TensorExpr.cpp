@@ -0,0 +1,187 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+TensorExpr::TensorExpr(const Tensor& tensor)
+    : inputs_({tensor}),
+      program_({{kernel::FusedEWOpCode::Input, 0}}),
+      shape_(tensor.GetShape()),
+      dtype_(tensor.GetDtype()),
+      device_(tensor.GetDevice()) {}
+
+TensorExpr TensorExpr::Add(const TensorExpr& value) const {
+    return Binary(value, kernel::FusedEWOpCode::Add);
+}
+
+TensorExpr TensorExpr::Sub(const TensorExpr& value) const {
+    return Binary(value, kernel::FusedEWOpCode::Sub);
+}
+
+TensorExpr TensorExpr::Mul(const TensorExpr& value) const {
+    return Binary(value, kernel::FusedEWOpCode::Mul);
+}
+
+TensorExpr TensorExpr::Div(const TensorExpr& value) const {
+    return Binary(value, kernel::FusedEWOpCode::Div);
+}
+
+TensorExpr TensorExpr::Neg() const {
+    return Unary(kernel::FusedEWOpCode::Neg);
+}
+
+TensorExpr TensorExpr::Abs() const {
+    return Unary(kernel::FusedEWOpCode::Abs);
+}
+
+TensorExpr TensorExpr::Sqrt() const {
+    return Unary(kernel::FusedEWOpCode::Sqrt);
+}
+
+TensorExpr TensorExpr::Square() const {
+    return Unary(kernel::FusedEWOpCode::Square);
+}
+
+TensorExpr TensorExpr::Exp() const {
+    return Unary(kernel::FusedEWOpCode::Exp);
+}
+
+TensorExpr TensorExpr::Sin() const {
+    return Unary(kernel::FusedEWOpCode::Sin);
+}
+
+TensorExpr TensorExpr::Cos() const {
+    return Unary(kernel::FusedEWOpCode::Cos);
+}
+
+Tensor TensorExpr::Eval() const {
+    Tensor dst(shape_, dtype_, device_);
+    kernel::FusedEW(GetExpandedInputs(), program_, dst);
+    return dst;
+}
+
+Tensor TensorExpr::Sum() const { return Reduce(kernel::ReductionOpCode::Sum); }
+
+Tensor TensorExpr::Prod() const {
+    return Reduce(kernel::ReductionOpCode::Prod);
+}
+
+Tensor TensorExpr::Min() const { return Reduce(kernel::ReductionOpCode::Min); }
+
+Tensor TensorExpr::Max() const { return Reduce(kernel::ReductionOpCode::Max); }
+
+TensorExpr TensorExpr::ScalarExpr(double value) const {
+    TensorExpr expr;
+    kernel::FusedEWInstruction ins{kernel::FusedEWOpCode::Scalar};
+    ins.scalar_ = value;
+    expr.program_ = {ins};
+    expr.shape_ = {};
+    expr.dtype_ = dtype_;
+    expr.device_ = device_;
+    return expr;
+}
+
+TensorExpr TensorExpr::Unary(kernel::FusedEWOpCode op_code) const {
+    TensorExpr expr = *this;
+    expr.program_.push_back(
+            {op_code, static_cast<int64_t>(program_.size()) - 1});
+    return expr;
+}
+
+TensorExpr TensorExpr::Binary(const TensorExpr& value,
+                              kernel::FusedEWOpCode op_code) const {
+    if (value.device_ != device_) {
+        utility::LogError("Device mismatch {} != {}.", device_.ToString(),
+                          value.device_.ToString());
+    }
+    if (value.dtype_ != dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.", dtype_.ToString(),
+                          value.dtype_.ToString());
+    }
+
+    TensorExpr expr = *this;
+    expr.shape_ = shape_util::BroadcastedShape(shape_, value.shape_);
+
+    // Append the operand's inputs, sharing the ones that are already used.
+    std::vector<int64_t> input_map;
+    for (const Tensor& input : value.inputs_) {
+        int64_t index = -1;
+        for (size_t i = 0; i < expr.inputs_.size(); ++i) {
+            if (expr.inputs_[i].IsSame(input)) {
+                index = static_cast<int64_t>(i);
+                break;
+            }
+        }
+        if (index < 0) {
+            index = static_cast<int64_t>(expr.inputs_.size());
+            expr.inputs_.push_back(input);
+        }
+        input_map.push_back(index);
+    }
+
+    // Append the operand's program, relocating its references.
+    const int64_t offset = static_cast<int64_t>(program_.size());
+    for (kernel::FusedEWInstruction ins : value.program_) {
+        if (ins.op_code_ == kernel::FusedEWOpCode::Input) {
+            ins.lhs_ = input_map[ins.lhs_];
+        } else if (ins.op_code_ != kernel::FusedEWOpCode::Scalar) {
+            ins.lhs_ += offset;
+            if (ins.rhs_ >= 0) {
+                ins.rhs_ += offset;
+            }
+        }
+        expr.program_.push_back(ins);
+    }
+    expr.program_.push_back(
+            {op_code, offset - 1,
+             static_cast<int64_t>(expr.program_.size()) - 1});
+    return expr;
+}
+
+std::vector<Tensor> TensorExpr::GetExpandedInputs() const {
+    std::vector<Tensor> expanded_inputs;
+    for (const Tensor& input : inputs_) {
+        expanded_inputs.push_back(input.GetShape() == shape_
+                                          ? input
+                                          : input.Expand(shape_));
+    }
+    return expanded_inputs;
+}
+
+Tensor TensorExpr::Reduce(kernel::ReductionOpCode op_code) const {
+    Tensor dst({}, dtype_, device_);
+    kernel::FusedEWReduction(GetExpandedInputs(), program_, dst, op_code);
+    return dst;
+}
+
+}  // namespace core
+}  // namespace open3d
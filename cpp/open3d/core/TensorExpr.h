@@ -0,0 +1,174 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+
+namespace open3d {
+namespace core {
+
+/// A lazily evaluated chain of element-wise Tensor ops.
+///
+/// Building a TensorExpr only records the ops. Eval() and the reductions then
+/// compute the whole expression in a single pass over the inputs without
+/// allocating intermediate Tensors, e.g.
+///
+///     // Three passes and two temporaries:
+///     Tensor err = ((a - b) * c).Sum({0, 1});
+///     // One pass, no temporaries:
+///     Tensor err = ((TensorExpr(a) - b) * c).Sum();
+///
+/// Inputs are broadcasted as in the Tensor ops and must share the same dtype
+/// and device. Fused evaluation runs on CPU; other devices fall back to one
+/// Tensor op per expression node.
+///
+/// Note that the left operand of the arithmetic operators must be a
+/// TensorExpr, since `Tensor + TensorExpr` resolves to the Tensor operators.
+class TensorExpr {
+public:
+    TensorExpr(const Tensor& tensor);
+
+    TensorExpr Add(const TensorExpr& value) const;
+    TensorExpr Sub(const TensorExpr& value) const;
+    TensorExpr Mul(const TensorExpr& value) const;
+    TensorExpr Div(const TensorExpr& value) const;
+
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Add(T scalar_value) const {
+        return Add(ScalarExpr(static_cast<double>(scalar_value)));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Sub(T scalar_value) const {
+        return Sub(ScalarExpr(static_cast<double>(scalar_value)));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Mul(T scalar_value) const {
+        return Mul(ScalarExpr(static_cast<double>(scalar_value)));
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr Div(T scalar_value) const {
+        return Div(ScalarExpr(static_cast<double>(scalar_value)));
+    }
+
+    TensorExpr Neg() const;
+    TensorExpr Abs() const;
+    TensorExpr Sqrt() const;
+    TensorExpr Square() const;
+    TensorExpr Exp() const;
+    TensorExpr Sin() const;
+    TensorExpr Cos() const;
+
+    TensorExpr operator+(const TensorExpr& value) const { return Add(value); }
+    TensorExpr operator-(const TensorExpr& value) const { return Sub(value); }
+    TensorExpr operator*(const TensorExpr& value) const { return Mul(value); }
+    TensorExpr operator/(const TensorExpr& value) const { return Div(value); }
+    TensorExpr operator-() const { return Neg(); }
+
+    // Exact matches for Tensor operands, which would otherwise resolve to the
+    // scalar-lhs Tensor operators.
+    TensorExpr operator+(const Tensor& value) const { return Add(value); }
+    TensorExpr operator-(const Tensor& value) const { return Sub(value); }
+    TensorExpr operator*(const Tensor& value) const { return Mul(value); }
+    TensorExpr operator/(const Tensor& value) const { return Div(value); }
+
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator+(T scalar_value) const {
+        return Add(scalar_value);
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator-(T scalar_value) const {
+        return Sub(scalar_value);
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator*(T scalar_value) const {
+        return Mul(scalar_value);
+    }
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value,
+                                      int>::type = 0>
+    TensorExpr operator/(T scalar_value) const {
+        return Div(scalar_value);
+    }
+
+    /// Evaluates the expression into a new contiguous Tensor of the
+    /// broadcasted shape.
+    Tensor Eval() const;
+
+    /// Evaluates the expression and reduces all elements into a 0-dim Tensor.
+    Tensor Sum() const;
+    Tensor Prod() const;
+    Tensor Min() const;
+    Tensor Max() const;
+
+    SizeVector GetShape() const { return shape_; }
+    Dtype GetDtype() const { return dtype_; }
+    Device GetDevice() const { return device_; }
+
+protected:
+    TensorExpr() {}
+
+    /// Expression of a constant, inheriting dtype and device from this.
+    TensorExpr ScalarExpr(double value) const;
+
+    TensorExpr Unary(kernel::FusedEWOpCode op_code) const;
+    TensorExpr Binary(const TensorExpr& value,
+                      kernel::FusedEWOpCode op_code) const;
+
+    /// Broadcasted views of the inputs.
+    std::vector<Tensor> GetExpandedInputs() const;
+
+    Tensor Reduce(kernel::ReductionOpCode op_code) const;
+
+private:
+    std::vector<Tensor> inputs_;
+    std::vector<kernel::FusedEWInstruction> program_;
+
+    SizeVector shape_;
+    Dtype dtype_ = Dtype::Undefined;
+    Device device_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -34,10 +34,12 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCPUHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
-        int64_t dsize_value,
-        const Device& device) {
-    return std::make_shared<CPUHashmap<DefaultHash, DefaultKeyEq>>(
-            init_buckets, init_capacity, dsize_key, dsize_value, device);
+        const std::vector<int64_t>& dsize_values,
+        const Device& device,
+        const HashmapBackend& backend) {
+    return CreateTemplateCPUHashmap<DefaultHash, DefaultKeyEq>(
+            init_buckets, init_capacity, dsize_key, dsize_values, device,
+            backend);
 }
 
 }  // namespace core
@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "open3d/core/hashmap/HashmapBuffer.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 
 namespace open3d {
 namespace core {
@@ -43,17 +44,22 @@ class CPUHashmapBufferContext {
 public:
     CPUHashmapBufferContext(int64_t capacity,
                             int64_t dsize_key,
-                            int64_t dsize_value,
+                            const std::vector<int64_t> &dsize_values,
                             Tensor &keys,
-                            Tensor &values,
+                            std::vector<Tensor> &values,
                             Tensor &heap)
         : capacity_(capacity),
           dsize_key_(dsize_key),
-          dsize_value_(dsize_value),
+          dsize_value_(dsize_values.at(0)),
+          dsize_values_(dsize_values),
           keys_(static_cast<uint8_t *>(keys.GetDataPtr())),
-          values_(static_cast<uint8_t *>(values.GetDataPtr())),
+          values_(static_cast<uint8_t *>(values.at(0).GetDataPtr())),
           heap_(static_cast<addr_t *>(heap.GetDataPtr())) {
-        std::memset(values_, 0, capacity_ * dsize_value_);
+        for (size_t i = 0; i < values.size(); ++i) {
+            value_ptrs_.push_back(
+                    static_cast<uint8_t *>(values[i].GetDataPtr()));
+            std::memset(value_ptrs_[i], 0, capacity_ * dsize_values_[i]);
+        }
     }
 
     void Reset() {
@@ -76,16 +82,113 @@ public:
                               values_ + ptr * dsize_value_);
     }
 
+    /// Zero the entry at \p ptr in every value buffer.
+    void ResetValues(addr_t ptr) {
+        for (size_t i = 0; i < value_ptrs_.size(); ++i) {
+            std::memset(value_ptrs_[i] + ptr * dsize_values_[i], 0,
+                        dsize_values_[i]);
+        }
+    }
+
+    /// Parallel collect the addresses of all allocated entries, i.e. the
+    /// complement of the free addresses heap_[heap_counter_, capacity_).
+    /// Addresses are written in increasing order. The buffer is only read, so
+    /// concurrent calls are safe.
+    int64_t GetActiveIndices(addr_t *output_indices) const {
+        const int64_t heap_counter = heap_counter_.load();
+        std::vector<uint8_t> active_mask(capacity_, 1);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = heap_counter; i < capacity_; ++i) {
+            active_mask[heap_[i]] = 0;
+        }
+
+        // Count active entries per chunk, then scatter with an exclusive
+        // prefix sum of the counts.
+        const int64_t num_chunks = std::max(
+                int64_t(1),
+                std::min(capacity_, int64_t(kernel::GetMaxThreads()) * 8));
+        const int64_t chunk_size = (capacity_ + num_chunks - 1) / num_chunks;
+        std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+#pragma omp parallel for schedule(static)
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            int64_t end = std::min(capacity_, (c + 1) * chunk_size);
+            int64_t n = 0;
+            for (int64_t i = c * chunk_size; i < end; ++i) {
+                n += active_mask[i];
+            }
+            chunk_offsets[c + 1] = n;
+        }
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            chunk_offsets[c + 1] += chunk_offsets[c];
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            int64_t end = std::min(capacity_, (c + 1) * chunk_size);
+            int64_t offset = chunk_offsets[c];
+            for (int64_t i = c * chunk_size; i < end; ++i) {
+                if (active_mask[i]) {
+                    output_indices[offset++] = static_cast<addr_t>(i);
+                }
+            }
+        }
+        return chunk_offsets[num_chunks];
+    }
+
 public:
     int64_t capacity_;
     int64_t dsize_key_;
     int64_t dsize_value_;
+    std::vector<int64_t> dsize_values_;
 
-    uint8_t *keys_;                 /* [N] * sizeof(Key) */
-    uint8_t *values_;               /* [N] * sizeof(Value) */
-    addr_t *heap_;                  /* [N] */
-    std::atomic<int> heap_counter_; /* [1] */
+    uint8_t *keys_;                     /* [N] * sizeof(Key) */
+    uint8_t *values_;                   /* [N] * sizeof(Value_0) */
+    std::vector<uint8_t *> value_ptrs_; /* [M] x [N] * sizeof(Value_m) */
+    addr_t *heap_;                      /* [N] */
+    std::atomic<int> heap_counter_;     /* [1] */
 };
 
+/// Grow the buffer to new_capacity instead of a rehash-by-reinsertion.
+/// Existing entries keep their addresses: keys, values and the heap are copied
+/// into a larger buffer with one memcpy each, and the new addresses
+/// [capacity, new_capacity) are appended to the free part of the heap. Hash
+/// tables indexing the buffer only need to rebuild their index afterwards.
+/// The copy is still proportional to the old capacity, since the key and value
+/// buffers are exposed as contiguous tensors indexed by address.
+inline void GrowCPUHashmapBuffer(
+        std::shared_ptr<HashmapBuffer> &buffer,
+        std::shared_ptr<CPUHashmapBufferContext> &buffer_ctx,
+        int64_t new_capacity,
+        const Device &device) {
+    const int64_t capacity = buffer_ctx->capacity_;
+    const int64_t dsize_key = buffer_ctx->dsize_key_;
+    const std::vector<int64_t> &dsize_values = buffer_ctx->dsize_values_;
+    if (new_capacity <= capacity) {
+        return;
+    }
+
+    auto new_buffer = std::make_shared<HashmapBuffer>(new_capacity, dsize_key,
+                                                      dsize_values, device);
+    auto new_buffer_ctx = std::make_shared<CPUHashmapBufferContext>(
+            new_capacity, dsize_key, dsize_values, new_buffer->GetKeyBuffer(),
+            new_buffer->GetValueBuffers(), new_buffer->GetHeap());
+
+    std::memcpy(new_buffer_ctx->keys_, buffer_ctx->keys_,
+                capacity * dsize_key);
+    for (size_t i = 0; i < dsize_values.size(); ++i) {
+        std::memcpy(new_buffer_ctx->value_ptrs_[i], buffer_ctx->value_ptrs_[i],
+                    capacity * dsize_values[i]);
+    }
+    std::memcpy(new_buffer_ctx->heap_, buffer_ctx->heap_,
+                capacity * sizeof(addr_t));
+#pragma omp parallel for schedule(static)
+    for (int64_t i = capacity; i < new_capacity; ++i) {
+        new_buffer_ctx->heap_[i] = static_cast<addr_t>(i);
+    }
+    new_buffer_ctx->heap_counter_ = buffer_ctx->heap_counter_.load();
+
+    buffer = new_buffer;
+    buffer_ctx = new_buffer_ctx;
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -41,7 +41,7 @@ public:
     CPUHashmap(int64_t init_buckets,
                int64_t init_capacity,
                int64_t dsize_key,
-               int64_t dsize_value,
+               const std::vector<int64_t>& dsize_values,
                const Device& device);
 
     ~CPUHashmap();
@@ -94,14 +94,14 @@ template <typename Hash, typename KeyEq>
 CPUHashmap<Hash, KeyEq>::CPUHashmap(int64_t init_buckets,
                                     int64_t init_capacity,
                                     int64_t dsize_key,
-                                    int64_t dsize_value,
+                                    const std::vector<int64_t>& dsize_values,
                                     const Device& device)
     : DeviceHashmap<Hash, KeyEq>(
               init_buckets,
               init_capacity,  /// Dummy for std unordered_map, reserved for.
                               /// other hashmaps.
               dsize_key,
-              dsize_value,
+              dsize_values,
               device) {
     Allocate(init_capacity, init_buckets);
 }
@@ -187,49 +187,40 @@ void CPUHashmap<Hash, KeyEq>::Erase(const void* input_keys,
 
 template <typename Hash, typename KeyEq>
 int64_t CPUHashmap<Hash, KeyEq>::GetActiveIndices(addr_t* output_indices) {
-    int64_t count = impl_->size();
-    int64_t i = 0;
-    for (auto iter = impl_->begin(); iter != impl_->end(); ++iter, ++i) {
-        output_indices[i] = static_cast<int64_t>(iter->second);
-    }
-
-    return count;
+    // Derived from the buffer's free list, which avoids a serial traversal of
+    // the map.
+    return buffer_ctx_->GetActiveIndices(output_indices);
 }
 
 template <typename Hash, typename KeyEq>
 void CPUHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
-    int64_t iterator_count = Size();
-
-    Tensor active_keys;
-    Tensor active_values;
-
-    if (iterator_count > 0) {
-        Tensor active_addrs({iterator_count}, Dtype::Int32, this->device_);
-        GetActiveIndices(static_cast<addr_t*>(active_addrs.GetDataPtr()));
-
-        Tensor active_indices = active_addrs.To(Dtype::Int64);
-        active_keys = this->GetKeyBuffer().IndexGet({active_indices});
-        active_values = this->GetValueBuffer().IndexGet({active_indices});
-    }
-
     float avg_capacity_per_bucket =
             float(this->capacity_) / float(this->bucket_count_);
-
     int64_t new_capacity =
             int64_t(std::ceil(buckets * avg_capacity_per_bucket));
-    Allocate(new_capacity, buckets);
 
-    if (iterator_count > 0) {
-        Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
-        Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
+    if (new_capacity > this->capacity_) {
+        // Entries keep their addresses in the grown buffer, but the map
+        // stores pointers to the keys, so it is rebuilt over the new buffer.
+        GrowCPUHashmapBuffer(this->buffer_, buffer_ctx_, new_capacity,
+                             this->device_);
+        this->capacity_ = new_capacity;
 
-        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
-                   static_cast<addr_t*>(output_addrs.GetDataPtr()),
-                   static_cast<bool*>(output_masks.GetDataPtr()),
-                   iterator_count);
-    }
+        int64_t iterator_count = Size();
+        std::vector<addr_t> active_addrs(iterator_count);
+        buffer_ctx_->GetActiveIndices(active_addrs.data());
 
-    impl_->rehash(buckets);
+        impl_ = std::make_shared<
+                tbb::concurrent_unordered_map<void*, addr_t, Hash, KeyEq>>(
+                buckets, Hash(this->dsize_key_), KeyEq(this->dsize_key_));
+#pragma omp parallel for
+        for (int64_t i = 0; i < iterator_count; ++i) {
+            addr_t addr = active_addrs[i];
+            impl_->insert({buffer_ctx_->ExtractIterator(addr).first, addr});
+        }
+    } else {
+        impl_->rehash(buckets);
+    }
     this->bucket_count_ = impl_->unsafe_bucket_count();
 }
 
@@ -272,7 +263,7 @@ void CPUHashmap<Hash, KeyEq>::InsertImpl(const void* input_keys,
                     this->dsize_value_ * i;
             std::memcpy(dst_value, src_value, this->dsize_value_);
         } else {
-            std::memset(dst_value, 0, this->dsize_value_);
+            buffer_ctx_->ResetValues(dst_kv_addr);
         }
 
         // Try insertion.
@@ -298,11 +289,11 @@ void CPUHashmap<Hash, KeyEq>::Allocate(int64_t capacity, int64_t buckets) {
 
     this->buffer_ =
             std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
-                                            this->dsize_value_, this->device_);
+                                            this->dsize_values_, this->device_);
 
     buffer_ctx_ = std::make_shared<CPUHashmapBufferContext>(
-            this->capacity_, this->dsize_key_, this->dsize_value_,
-            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->capacity_, this->dsize_key_, this->dsize_values_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffers(),
             this->buffer_->GetHeap());
     buffer_ctx_->Reset();
 
@@ -0,0 +1,484 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/hashmap/CPU/HashmapBufferCPU.hpp"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+
+namespace open3d {
+namespace core {
+
+/// Lock-free open-addressing hash table with linear probing.
+///
+/// Keys and values live in the same HashmapBuffer as in CPUHashmap, the table
+/// itself is a flat power-of-two array of 64-bit slots. Each occupied slot
+/// stores the upper 32 bits of the key hash as a tag and the buffer address in
+/// the lower 32 bits, so most probes are resolved without touching the key
+/// buffer. Insertion claims empty slots with a CAS, erasure replaces slots
+/// with tombstones, so all batched operations run in parallel. Tombstones are
+/// dropped on the next rehash. Rehashing grows the buffer without reinsertion
+/// (see GrowCPUHashmapBuffer) and only rebuilds the slot array.
+///
+/// The number of slots (bucket_count_) is kept at least twice the buffer
+/// capacity, i.e. the load factor never exceeds 0.5.
+template <typename Hash, typename KeyEq>
+class CPUOpenAddressingHashmap : public DeviceHashmap<Hash, KeyEq> {
+public:
+    CPUOpenAddressingHashmap(int64_t init_buckets,
+                             int64_t init_capacity,
+                             int64_t dsize_key,
+                             const std::vector<int64_t>& dsize_values,
+                             const Device& device);
+
+    ~CPUOpenAddressingHashmap();
+
+    void Rehash(int64_t buckets) override;
+
+    void Insert(const void* input_keys,
+                const void* input_values,
+                addr_t* output_addrs,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Activate(const void* input_keys,
+                  addr_t* output_addrs,
+                  bool* output_masks,
+                  int64_t count) override;
+
+    void Find(const void* input_keys,
+              addr_t* output_addrs,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(addr_t* output_indices) override;
+
+    int64_t Size() const override;
+
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+protected:
+    static constexpr uint64_t kEmptySlot = ~uint64_t(0);
+    static constexpr uint64_t kTombstoneSlot = ~uint64_t(0) - 1;
+
+    std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+    std::atomic<int64_t> size_;
+    std::atomic<int64_t> tombstone_count_;
+
+    Hash hash_fn_;
+    KeyEq eq_fn_;
+
+    std::shared_ptr<CPUHashmapBufferContext> buffer_ctx_;
+
+    /// Mix the user hash so that both the probe start (low bits) and the tag
+    /// (high bits) are well distributed, even for small integer coordinates.
+    static inline uint64_t Mix(uint64_t h) {
+        h ^= h >> 33;
+        h *= UINT64_C(0xff51afd7ed558ccd);
+        h ^= h >> 33;
+        h *= UINT64_C(0xc4ceb9fe1a85ec53);
+        h ^= h >> 33;
+        return h;
+    }
+
+    static inline int64_t NextPowerOfTwo(int64_t n) {
+        int64_t p = 1;
+        while (p < n) {
+            p <<= 1;
+        }
+        return p;
+    }
+
+    /// Return the slot index holding key, or -1 if it is not present.
+    int64_t FindSlot(const void* key, uint64_t h) const;
+
+    void InsertImpl(const void* input_keys,
+                    const void* input_values,
+                    addr_t* output_addrs,
+                    bool* output_masks,
+                    int64_t count);
+
+    /// Grow the buffer (and the table) if count more keys may not fit, or
+    /// rebuild the table in place if tombstones fill it up.
+    void Reserve(int64_t count);
+
+    /// Rebuild the slot array from the currently active buffer entries.
+    void RebuildSlots(int64_t slot_count);
+
+    void Allocate(int64_t capacity, int64_t slot_count);
+};
+
+template <typename Hash, typename KeyEq>
+CPUOpenAddressingHashmap<Hash, KeyEq>::CPUOpenAddressingHashmap(
+        int64_t init_buckets,
+        int64_t init_capacity,
+        int64_t dsize_key,
+        const std::vector<int64_t>& dsize_values,
+        const Device& device)
+    : DeviceHashmap<Hash, KeyEq>(init_buckets,
+                                 init_capacity,
+                                 dsize_key,
+                                 dsize_values,
+                                 device),
+      size_(0),
+      tombstone_count_(0),
+      hash_fn_(dsize_key),
+      eq_fn_(dsize_key) {
+    // init_buckets is sized for chaining hashmaps, open addressing needs at
+    // least one slot per element.
+    Allocate(init_capacity, NextPowerOfTwo(std::max(init_capacity * 2,
+                                                    int64_t(2))));
+}
+
+template <typename Hash, typename KeyEq>
+CPUOpenAddressingHashmap<Hash, KeyEq>::~CPUOpenAddressingHashmap() {}
+
+template <typename Hash, typename KeyEq>
+int64_t CPUOpenAddressingHashmap<Hash, KeyEq>::Size() const {
+    return size_.load();
+}
+
+template <typename Hash, typename KeyEq>
+void CPUOpenAddressingHashmap<Hash, KeyEq>::Insert(const void* input_keys,
+                                                   const void* input_values,
+                                                   addr_t* output_addrs,
+                                                   bool* output_masks,
+                                                   int64_t count) {
+    Reserve(count);
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
+}
+
+template <typename Hash, typename KeyEq>
+void CPUOpenAddressingHashmap<Hash, KeyEq>::Activate(const void* input_keys,
+                                                     addr_t* output_addrs,
+                                                     bool* output_masks,
+                                                     int64_t count) {
+    Reserve(count);
+    InsertImpl(input_keys, nullptr, output_addrs, output_masks, count);
+}
+
+template <typename Hash, typename KeyEq>
+int64_t CPUOpenAddressingHashmap<Hash, KeyEq>::FindSlot(const void* key,
+                                                        uint64_t h) const {
+    const uint64_t mask = static_cast<uint64_t>(this->bucket_count_ - 1);
+    const uint64_t tag = h >> 32;
+    uint64_t idx = h & mask;
+    while (true) {
+        uint64_t slot = slots_[idx].load(std::memory_order_acquire);
+        if (slot == kEmptySlot) {
+            return -1;
+        }
+        if (slot != kTombstoneSlot && (slot >> 32) == tag) {
+            addr_t addr = static_cast<addr_t>(slot & 0xFFFFFFFF);
+            if (eq_fn_(buffer_ctx_->ExtractIterator(addr).first, key)) {
+                return static_cast<int64_t>(idx);
+            }
+        }
+        idx = (idx + 1) & mask;
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPUOpenAddressingHashmap<Hash, KeyEq>::Find(const void* input_keys,
+                                                 addr_t* output_addrs,
+                                                 bool* output_masks,
+                                                 int64_t count) {
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        const uint8_t* key =
+                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
+        int64_t idx = FindSlot(key, Mix(hash_fn_(key)));
+        bool flag = (idx >= 0);
+        output_masks[i] = flag;
+        output_addrs[i] =
+                flag ? static_cast<addr_t>(slots_[idx].load() & 0xFFFFFFFF)
+                     : 0;
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPUOpenAddressingHashmap<Hash, KeyEq>::Erase(const void* input_keys,
+                                                  bool* output_masks,
+                                                  int64_t count) {
+    int64_t erased = 0;
+#pragma omp parallel for reduction(+ : erased)
+    for (int64_t i = 0; i < count; ++i) {
+        const uint8_t* key =
+                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
+        int64_t idx = FindSlot(key, Mix(hash_fn_(key)));
+        bool flag = false;
+        if (idx >= 0) {
+            // Duplicated keys in the same batch race here, only one wins.
+            uint64_t slot = slots_[idx].load();
+            if (slot != kTombstoneSlot &&
+                slots_[idx].compare_exchange_strong(slot, kTombstoneSlot)) {
+                buffer_ctx_->DeviceFree(static_cast<addr_t>(slot & 0xFFFFFFFF));
+                flag = true;
+                erased += 1;
+            }
+        }
+        output_masks[i] = flag;
+    }
+    size_ -= erased;
+    tombstone_count_ += erased;
+}
+
+template <typename Hash, typename KeyEq>
+int64_t CPUOpenAddressingHashmap<Hash, KeyEq>::GetActiveIndices(
+        addr_t* output_indices) {
+    // Count occupied slots per chunk, then scatter with an exclusive prefix
+    // sum of the counts.
+    const int64_t slot_count = this->bucket_count_;
+    const int64_t num_chunks =
+            std::min(slot_count, int64_t(kernel::GetMaxThreads()) * 8);
+    const int64_t chunk_size = (slot_count + num_chunks - 1) / num_chunks;
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
+
+#pragma omp parallel for schedule(static)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t end = std::min(slot_count, (c + 1) * chunk_size);
+        int64_t n = 0;
+        for (int64_t idx = c * chunk_size; idx < end; ++idx) {
+            uint64_t slot = slots_[idx].load(std::memory_order_relaxed);
+            n += (slot != kEmptySlot && slot != kTombstoneSlot);
+        }
+        offsets[c + 1] = n;
+    }
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        offsets[c + 1] += offsets[c];
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t end = std::min(slot_count, (c + 1) * chunk_size);
+        int64_t offset = offsets[c];
+        for (int64_t idx = c * chunk_size; idx < end; ++idx) {
+            uint64_t slot = slots_[idx].load(std::memory_order_relaxed);
+            if (slot != kEmptySlot && slot != kTombstoneSlot) {
+                output_indices[offset++] =
+                        static_cast<addr_t>(slot & 0xFFFFFFFF);
+            }
+        }
+    }
+
+    return offsets[num_chunks];
+}
+
+template <typename Hash, typename KeyEq>
+void CPUOpenAddressingHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
+    float avg_capacity_per_bucket =
+            float(this->capacity_) / float(this->bucket_count_);
+    int64_t slot_count = NextPowerOfTwo(std::max(buckets, Size() * 2));
+    int64_t new_capacity =
+            int64_t(std::ceil(slot_count * avg_capacity_per_bucket));
+
+    // Entries keep their addresses in the grown buffer, only the slot array
+    // is rebuilt.
+    if (new_capacity > this->capacity_) {
+        GrowCPUHashmapBuffer(this->buffer_, buffer_ctx_, new_capacity,
+                             this->device_);
+        this->capacity_ = new_capacity;
+    }
+    RebuildSlots(std::max(slot_count, NextPowerOfTwo(this->capacity_ * 2)));
+}
+
+template <typename Hash, typename KeyEq>
+std::vector<int64_t> CPUOpenAddressingHashmap<Hash, KeyEq>::BucketSizes()
+        const {
+    // Every slot is a bucket of size 0 or 1.
+    std::vector<int64_t> ret(this->bucket_count_);
+    for (int64_t i = 0; i < this->bucket_count_; ++i) {
+        uint64_t slot = slots_[i].load();
+        ret[i] = (slot != kEmptySlot && slot != kTombstoneSlot) ? 1 : 0;
+    }
+    return ret;
+}
+
+template <typename Hash, typename KeyEq>
+float CPUOpenAddressingHashmap<Hash, KeyEq>::LoadFactor() const {
+    return float(Size()) / float(this->bucket_count_);
+}
+
+template <typename Hash, typename KeyEq>
+void CPUOpenAddressingHashmap<Hash, KeyEq>::InsertImpl(const void* input_keys,
+                                                       const void* input_values,
+                                                       addr_t* output_addrs,
+                                                       bool* output_masks,
+                                                       int64_t count) {
+    const uint64_t mask = static_cast<uint64_t>(this->bucket_count_ - 1);
+    int64_t inserted = 0;
+
+#pragma omp parallel for reduction(+ : inserted)
+    for (int64_t i = 0; i < count; ++i) {
+        const uint8_t* src_key =
+                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
+
+        // Publish key and value before the slot becomes visible.
+        addr_t dst_kv_addr = buffer_ctx_->DeviceAllocate();
+        auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
+
+        uint8_t* dst_key = static_cast<uint8_t*>(dst_kv_iter.first);
+        uint8_t* dst_value = static_cast<uint8_t*>(dst_kv_iter.second);
+        std::memcpy(dst_key, src_key, this->dsize_key_);
+
+        if (input_values != nullptr) {
+            const uint8_t* src_value =
+                    static_cast<const uint8_t*>(input_values) +
+                    this->dsize_value_ * i;
+            std::memcpy(dst_value, src_value, this->dsize_value_);
+        } else {
+            buffer_ctx_->ResetValues(dst_kv_addr);
+        }
+
+        uint64_t h = Mix(hash_fn_(src_key));
+        uint64_t tag = h >> 32;
+        uint64_t new_slot = (tag << 32) | static_cast<uint64_t>(dst_kv_addr);
+        uint64_t idx = h & mask;
+
+        bool success = false;
+        while (true) {
+            uint64_t slot = slots_[idx].load(std::memory_order_acquire);
+            if (slot == kEmptySlot) {
+                if (slots_[idx].compare_exchange_strong(
+                            slot, new_slot, std::memory_order_acq_rel)) {
+                    success = true;
+                    break;
+                }
+                // Lost the race: re-examine the same slot, it may now hold
+                // the same key.
+                continue;
+            }
+            if (slot != kTombstoneSlot && (slot >> 32) == tag) {
+                addr_t addr = static_cast<addr_t>(slot & 0xFFFFFFFF);
+                if (eq_fn_(buffer_ctx_->ExtractIterator(addr).first,
+                           src_key)) {
+                    break;
+                }
+            }
+            idx = (idx + 1) & mask;
+        }
+
+        output_addrs[i] = dst_kv_addr;
+        output_masks[i] = success;
+        inserted += success;
+    }
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        if (!output_masks[i]) {
+            buffer_ctx_->DeviceFree(output_addrs[i]);
+        }
+    }
+
+    size_ += inserted;
+}
+
+template <typename Hash, typename KeyEq>
+void CPUOpenAddressingHashmap<Hash, KeyEq>::Reserve(int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        float avg_capacity_per_bucket =
+                float(this->capacity_) / float(this->bucket_count_);
+        int64_t expected_buckets = std::max(
+                this->bucket_count_ * 2,
+                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
+        Rehash(expected_buckets);
+    } else if (new_size + tombstone_count_.load() >
+               this->bucket_count_ * 3 / 4) {
+        RebuildSlots(this->bucket_count_);
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPUOpenAddressingHashmap<Hash, KeyEq>::RebuildSlots(int64_t slot_count) {
+    int64_t size = Size();
+    std::vector<addr_t> active_addrs(size);
+    buffer_ctx_->GetActiveIndices(active_addrs.data());
+
+    this->bucket_count_ = slot_count;
+    slots_.reset(new std::atomic<uint64_t>[slot_count]);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < slot_count; ++i) {
+        slots_[i].store(kEmptySlot, std::memory_order_relaxed);
+    }
+
+    // Keys are unique, so no key comparison is needed.
+    const uint64_t mask = static_cast<uint64_t>(slot_count - 1);
+#pragma omp parallel for
+    for (int64_t i = 0; i < size; ++i) {
+        addr_t addr = active_addrs[i];
+        uint64_t h = Mix(hash_fn_(buffer_ctx_->ExtractIterator(addr).first));
+        uint64_t new_slot = ((h >> 32) << 32) | static_cast<uint64_t>(addr);
+        uint64_t idx = h & mask;
+        while (true) {
+            uint64_t slot = kEmptySlot;
+            if (slots_[idx].compare_exchange_strong(slot, new_slot)) {
+                break;
+            }
+            idx = (idx + 1) & mask;
+        }
+    }
+    tombstone_count_ = 0;
+}
+
+template <typename Hash, typename KeyEq>
+void CPUOpenAddressingHashmap<Hash, KeyEq>::Allocate(int64_t capacity,
+                                                     int64_t slot_count) {
+    this->capacity_ = capacity;
+    this->bucket_count_ = slot_count;
+
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
+                                            this->dsize_values_, this->device_);
+
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferContext>(
+            this->capacity_, this->dsize_key_, this->dsize_values_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffers(),
+            this->buffer_->GetHeap());
+    buffer_ctx_->Reset();
+
+    slots_.reset(new std::atomic<uint64_t>[slot_count]);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < slot_count; ++i) {
+        slots_[i].store(kEmptySlot, std::memory_order_relaxed);
+    }
+    size_ = 0;
+    tombstone_count_ = 0;
+}
+
+}  // namespace core
+}  // namespace open3d
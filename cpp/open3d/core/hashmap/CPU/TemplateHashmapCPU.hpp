@@ -27,20 +27,26 @@
 #pragma once
 
 #include "open3d/core/hashmap/CPU/HashmapCPU.h"
+#include "open3d/core/hashmap/CPU/OpenAddressingHashmapCPU.h"
 
 namespace open3d {
 namespace core {
 
 /// Templated factory.
 template <typename Hash, typename KeyEq>
-std::shared_ptr<CPUHashmap<Hash, KeyEq>> CreateTemplateCPUHashmap(
+std::shared_ptr<DeviceHashmap<Hash, KeyEq>> CreateTemplateCPUHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
-        int64_t dsize_value,
-        const Device& device) {
+        const std::vector<int64_t>& dsize_values,
+        const Device& device,
+        const HashmapBackend& backend = HashmapBackend::Default) {
+    if (backend == HashmapBackend::OpenAddressing) {
+        return std::make_shared<CPUOpenAddressingHashmap<Hash, KeyEq>>(
+                init_buckets, init_capacity, dsize_key, dsize_values, device);
+    }
     return std::make_shared<CPUHashmap<Hash, KeyEq>>(
-            init_buckets, init_capacity, dsize_key, dsize_value, device);
+            init_buckets, init_capacity, dsize_key, dsize_values, device);
 }
 }  // namespace core
 }  // namespace open3d
@@ -56,15 +56,19 @@ public:
                         int64_t dsize_key,
                         int64_t dsize_value,
                         Tensor &keys,
-                        Tensor &values,
+                        std::vector<Tensor> &values,
                         Tensor &heap) {
         capacity_ = capacity;
         dsize_key_ = dsize_key;
         dsize_value_ = dsize_value;
         keys_ = static_cast<uint8_t *>(keys.GetDataPtr());
-        values_ = static_cast<uint8_t *>(values.GetDataPtr());
+        values_ = static_cast<uint8_t *>(values.at(0).GetDataPtr());
         heap_ = static_cast<addr_t *>(heap.GetDataPtr());
-        OPEN3D_CUDA_CHECK(cudaMemset(values_, 0, capacity_ * dsize_value_));
+        for (auto &value : values) {
+            OPEN3D_CUDA_CHECK(cudaMemset(
+                    value.GetDataPtr(), 0,
+                    capacity_ * value.GetDtype().ByteSize()));
+        }
     }
 
     __host__ void Reset(const Device &device) {
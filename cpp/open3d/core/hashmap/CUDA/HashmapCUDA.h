@@ -55,7 +55,7 @@ public:
     CUDAHashmap(int64_t init_buckets,
                 int64_t init_capacity,
                 int64_t dsize_key,
-                int64_t dsize_value,
+                const std::vector<int64_t>& dsize_values,
                 const Device& device);
 
     ~CUDAHashmap();
@@ -113,10 +113,10 @@ template <typename Hash, typename KeyEq>
 CUDAHashmap<Hash, KeyEq>::CUDAHashmap(int64_t init_buckets,
                                       int64_t init_capacity,
                                       int64_t dsize_key,
-                                      int64_t dsize_value,
+                                      const std::vector<int64_t>& dsize_values,
                                       const Device& device)
     : DeviceHashmap<Hash, KeyEq>(
-              init_buckets, init_capacity, dsize_key, dsize_value, device) {
+              init_buckets, init_capacity, dsize_key, dsize_values, device) {
     Allocate(init_buckets, init_capacity);
 }
 
@@ -130,7 +130,7 @@ void CUDAHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
     int64_t iterator_count = Size();
 
     Tensor active_keys;
-    Tensor active_values;
+    std::vector<Tensor> active_values;
 
     if (iterator_count > 0) {
         Tensor active_addrs =
@@ -139,8 +139,9 @@ void CUDAHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
 
         Tensor active_indices = active_addrs.To(Dtype::Int64);
         active_keys = this->buffer_->GetKeyBuffer().IndexGet({active_indices});
-        active_values =
-                this->buffer_->GetValueBuffer().IndexGet({active_indices});
+        for (auto& value_buffer : this->buffer_->GetValueBuffers()) {
+            active_values.push_back(value_buffer.IndexGet({active_indices}));
+        }
     }
 
     float avg_capacity_per_bucket =
@@ -155,10 +156,17 @@ void CUDAHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
         Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
         Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
 
-        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
+        InsertImpl(active_keys.GetDataPtr(), active_values[0].GetDataPtr(),
                    static_cast<addr_t*>(output_addrs.GetDataPtr()),
                    static_cast<bool*>(output_masks.GetDataPtr()),
                    iterator_count);
+
+        // Remaining value buffers are not handled by the insertion kernel.
+        Tensor output_indices = output_addrs.To(Dtype::Int64);
+        for (size_t i = 1; i < active_values.size(); ++i) {
+            this->buffer_->GetValueBuffer(i).IndexSet({output_indices},
+                                                      active_values[i]);
+        }
     }
     CUDACachedMemoryManager::ReleaseCache();
 }
@@ -324,11 +332,11 @@ void CUDAHashmap<Hash, KeyEq>::Allocate(int64_t bucket_count,
     // Allocate buffer for key values.
     this->buffer_ =
             std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
-                                            this->dsize_value_, this->device_);
+                                            this->dsize_values_, this->device_);
     buffer_ctx_.HostAllocate(this->device_);
     buffer_ctx_.Setup(this->capacity_, this->dsize_key_, this->dsize_value_,
                       this->buffer_->GetKeyBuffer(),
-                      this->buffer_->GetValueBuffer(),
+                      this->buffer_->GetValueBuffers(),
                       this->buffer_->GetHeap());
     buffer_ctx_.Reset(this->device_);
 
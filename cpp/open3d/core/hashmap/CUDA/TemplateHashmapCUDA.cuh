@@ -51,10 +51,10 @@ std::shared_ptr<CUDAHashmap<Hash, KeyEq>> CreateTemplateCUDAHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
-        int64_t dsize_value,
+        const std::vector<int64_t>& dsize_values,
         const Device& device) {
     return std::make_shared<CUDAHashmap<Hash, KeyEq>>(
-            init_buckets, init_capacity, dsize_key, dsize_value, device);
+            init_buckets, init_capacity, dsize_key, dsize_values, device);
 }
 
 }  // namespace core
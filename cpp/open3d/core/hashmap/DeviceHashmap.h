@@ -29,6 +29,7 @@
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
 
 namespace open3d {
@@ -101,15 +102,17 @@ template <typename Hash, typename KeyEq>
 class DeviceHashmap {
 public:
     /// Comprehensive constructor for the developer.
+    /// \p dsize_values holds the element byte size of each value buffer.
     DeviceHashmap(int64_t init_buckets,
                   int64_t init_capacity,
                   int64_t dsize_key,
-                  int64_t dsize_value,
+                  const std::vector<int64_t>& dsize_values,
                   const Device& device)
         : bucket_count_(init_buckets),
           capacity_(init_capacity),
           dsize_key_(dsize_key),
-          dsize_value_(dsize_value),
+          dsize_value_(dsize_values.at(0)),
+          dsize_values_(dsize_values),
           device_(device) {}
     virtual ~DeviceHashmap() {}
 
@@ -122,6 +125,9 @@ public:
     virtual void Rehash(int64_t buckets) = 0;
 
     /// Parallel insert contiguous arrays of keys and values.
+    /// \p input_values fills the first value buffer. Other value buffers, if
+    /// any, are zero initialized on CPU and filled by the caller through the
+    /// returned addresses.
     virtual void Insert(const void* input_keys,
                         const void* input_values,
                         addr_t* output_iterators,
@@ -157,9 +163,13 @@ public:
     Device GetDevice() const { return device_; }
     int64_t GetKeyBytesize() const { return dsize_key_; }
     int64_t GetValueBytesize() const { return dsize_value_; }
+    std::vector<int64_t> GetValueBytesizes() const { return dsize_values_; }
 
     Tensor& GetKeyBuffer() { return buffer_->GetKeyBuffer(); }
-    Tensor& GetValueBuffer() { return buffer_->GetValueBuffer(); }
+    Tensor& GetValueBuffer(size_t i = 0) { return buffer_->GetValueBuffer(i); }
+    std::vector<Tensor>& GetValueBuffers() {
+        return buffer_->GetValueBuffers();
+    }
 
     /// Return number of elems per bucket.
     /// High performance not required, so directly returns a vector.
@@ -172,7 +182,9 @@ public:
     int64_t bucket_count_;
     int64_t capacity_;
     int64_t dsize_key_;
+    /// Byte size of the first value buffer.
     int64_t dsize_value_;
+    std::vector<int64_t> dsize_values_;
 
     Device device_;
 
@@ -197,21 +209,23 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultDeviceHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
-        int64_t dsize_value,
-        const Device& device);
+        const std::vector<int64_t>& dsize_values,
+        const Device& device,
+        const HashmapBackend& backend = HashmapBackend::Default);
 
 std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCPUHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
-        int64_t dsize_value,
-        const Device& device);
+        const std::vector<int64_t>& dsize_values,
+        const Device& device,
+        const HashmapBackend& backend = HashmapBackend::Default);
 
 std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCUDAHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
-        int64_t dsize_value,
+        const std::vector<int64_t>& dsize_values,
         const Device& device);
 
 }  // namespace core
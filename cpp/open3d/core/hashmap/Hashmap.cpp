@@ -32,6 +32,8 @@
 
 #include "open3d/core/hashmap/Hashmap.h"
 
+#include <algorithm>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/DeviceHashmap.h"
 #include "open3d/utility/Console.h"
@@ -45,30 +47,101 @@ Hashmap::Hashmap(int64_t init_capacity,
                  const Dtype& dtype_value,
                  const SizeVector& element_shape_key,
                  const SizeVector& element_shape_value,
-                 const Device& device)
+                 const Device& device,
+                 const HashmapBackend& backend)
+    : Hashmap(init_capacity,
+              dtype_key,
+              element_shape_key,
+              std::vector<Dtype>{dtype_value},
+              std::vector<SizeVector>{element_shape_value},
+              device,
+              backend) {}
+
+Hashmap::Hashmap(int64_t init_capacity,
+                 const Dtype& dtype_key,
+                 const SizeVector& element_shape_key,
+                 const std::vector<Dtype>& dtypes_value,
+                 const std::vector<SizeVector>& element_shapes_value,
+                 const Device& device,
+                 const HashmapBackend& backend)
+    : Hashmap(init_capacity,
+              dtype_key,
+              element_shape_key,
+              dtypes_value,
+              element_shapes_value,
+              std::vector<std::string>{},
+              device,
+              backend) {}
+
+Hashmap::Hashmap(int64_t init_capacity,
+                 const Dtype& dtype_key,
+                 const SizeVector& element_shape_key,
+                 const std::vector<Dtype>& dtypes_value,
+                 const std::vector<SizeVector>& element_shapes_value,
+                 const std::vector<std::string>& value_names,
+                 const Device& device,
+                 const HashmapBackend& backend)
     : dtype_key_(dtype_key),
-      dtype_value_(dtype_value),
+      dtypes_value_(dtypes_value),
       element_shape_key_(element_shape_key),
-      element_shape_value_(element_shape_value) {
-    if (dtype_key_.GetDtypeCode() == Dtype::DtypeCode::Undefined ||
-        dtype_key_.GetDtypeCode() == Dtype::DtypeCode::Undefined) {
+      element_shapes_value_(element_shapes_value),
+      value_names_(value_names),
+      backend_(backend) {
+    if (dtypes_value_.size() == 0 ||
+        dtypes_value_.size() != element_shapes_value_.size()) {
+        utility::LogError(
+                "[Hashmap] Expected the same non-zero number of value dtypes "
+                "and element shapes, but got {} and {}.",
+                dtypes_value_.size(), element_shapes_value_.size());
+    }
+    if (!value_names_.empty()) {
+        if (value_names_.size() != dtypes_value_.size()) {
+            utility::LogError("[Hashmap] Expected {} value names, but got {}.",
+                              dtypes_value_.size(), value_names_.size());
+        }
+        for (size_t i = 0; i < value_names_.size(); ++i) {
+            if (value_names_[i].empty() ||
+                std::count(value_names_.begin(), value_names_.end(),
+                           value_names_[i]) > 1) {
+                utility::LogError(
+                        "[Hashmap] Value names must be non-empty and unique, "
+                        "but got \"{}\".",
+                        value_names_[i]);
+            }
+        }
+    }
+    if (dtype_key_.GetDtypeCode() == Dtype::DtypeCode::Undefined) {
         utility::LogError(
                 "[Hashmap] DtypeCore::Undefined is not supported for input "
                 "key/value.");
     }
-    if (element_shape_key_.NumElements() == 0 ||
-        element_shape_value_.NumElements() == 0) {
+    if (element_shape_key_.NumElements() == 0) {
         utility::LogError(
                 "[Hashmap] element shape 0 is not supported for input "
                 "key/value.");
     }
 
+    std::vector<int64_t> dsize_values;
+    for (size_t i = 0; i < dtypes_value_.size(); ++i) {
+        if (dtypes_value_[i].GetDtypeCode() == Dtype::DtypeCode::Undefined) {
+            utility::LogError(
+                    "[Hashmap] DtypeCore::Undefined is not supported for "
+                    "input key/value.");
+        }
+        if (element_shapes_value_[i].NumElements() == 0) {
+            utility::LogError(
+                    "[Hashmap] element shape 0 is not supported for input "
+                    "key/value.");
+        }
+        dsize_values.push_back(dtypes_value_[i].ByteSize() *
+                               element_shapes_value_[i].NumElements());
+    }
+
     device_hashmap_ = CreateDefaultDeviceHashmap(
             std::max(init_capacity / kDefaultElemsPerBucket, int64_t(1)),
             init_capacity,
             dtype_key.ByteSize() * element_shape_key_.NumElements(),
-            dtype_value.ByteSize() * element_shape_value_.NumElements(),
-            device);
+            dsize_values, device, backend);
 }
 
 void Hashmap::Rehash(int64_t buckets) {
@@ -79,14 +152,18 @@ void Hashmap::Insert(const Tensor& input_keys,
                      const Tensor& input_values,
                      Tensor& output_addrs,
                      Tensor& output_masks) {
+    Insert(input_keys, std::vector<Tensor>{input_values}, output_addrs,
+           output_masks);
+}
+
+void Hashmap::Insert(const Tensor& input_keys,
+                     const std::vector<Tensor>& input_values_soa,
+                     Tensor& output_addrs,
+                     Tensor& output_masks) {
     SizeVector input_key_elem_shape(input_keys.GetShape());
     input_key_elem_shape.erase(input_key_elem_shape.begin());
     AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
 
-    SizeVector input_value_elem_shape(input_values.GetShape());
-    input_value_elem_shape.erase(input_value_elem_shape.begin());
-    AssertValueDtype(input_values.GetDtype(), input_value_elem_shape);
-
     SizeVector shape = input_keys.GetShape();
     if (shape.size() == 0 || shape[0] == 0) {
         utility::LogError("[Hashmap]: Invalid key tensor shape");
@@ -97,24 +174,53 @@ void Hashmap::Insert(const Tensor& input_keys,
                 GetDevice().ToString(), input_keys.GetDevice().ToString());
     }
 
-    SizeVector value_shape = input_values.GetShape();
-    if (value_shape.size() == 0 || value_shape[0] != shape[0]) {
-        utility::LogError("[Hashmap]: Invalid value tensor shape");
-    }
-    if (input_values.GetDevice() != GetDevice()) {
+    if (input_values_soa.size() != dtypes_value_.size()) {
         utility::LogError(
-                "[Hashmap]: Incompatible value device, expected {}, but got {}",
-                GetDevice().ToString(), input_values.GetDevice().ToString());
+                "[Hashmap]: Expected {} value tensors, but got {}",
+                dtypes_value_.size(), input_values_soa.size());
+    }
+    for (size_t i = 0; i < input_values_soa.size(); ++i) {
+        const Tensor& input_values = input_values_soa[i];
+        SizeVector input_value_elem_shape(input_values.GetShape());
+        input_value_elem_shape.erase(input_value_elem_shape.begin());
+        AssertValueDtype(input_values.GetDtype(), input_value_elem_shape, i);
+
+        SizeVector value_shape = input_values.GetShape();
+        if (value_shape.size() == 0 || value_shape[0] != shape[0]) {
+            utility::LogError("[Hashmap]: Invalid value tensor shape");
+        }
+        if (input_values.GetDevice() != GetDevice()) {
+            utility::LogError(
+                    "[Hashmap]: Incompatible value device, expected {}, but "
+                    "got {}",
+                    GetDevice().ToString(),
+                    input_values.GetDevice().ToString());
+        }
     }
 
     int64_t count = shape[0];
     output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
 
-    device_hashmap_->Insert(input_keys.GetDataPtr(), input_values.GetDataPtr(),
+    // The device hashmap copies the first value buffer along with the keys.
+    device_hashmap_->Insert(input_keys.GetDataPtr(),
+                            input_values_soa[0].GetDataPtr(),
                             static_cast<addr_t*>(output_addrs.GetDataPtr()),
                             static_cast<bool*>(output_masks.GetDataPtr()),
                             count);
+
+    // Remaining buffers are scattered to the successfully inserted addresses.
+    if (input_values_soa.size() > 1) {
+        Tensor inserted_indices =
+                output_addrs.IndexGet({output_masks}).To(Dtype::Int64);
+        if (inserted_indices.GetLength() > 0) {
+            for (size_t i = 1; i < input_values_soa.size(); ++i) {
+                GetValueTensor(i).IndexSet(
+                        {inserted_indices},
+                        input_values_soa[i].IndexGet({output_masks}));
+            }
+        }
+    }
 }
 
 void Hashmap::Activate(const Tensor& input_keys,
@@ -210,19 +316,22 @@ Hashmap Hashmap::To(const Device& device, bool copy) const {
         return *this;
     }
 
-    Hashmap new_hashmap(GetCapacity(), dtype_key_, dtype_value_,
-                        element_shape_key_, element_shape_value_, device);
-
-    Tensor keys = GetKeyTensor().To(device, /*copy=*/true);
-    Tensor values = GetValueTensor().To(device, /*copy=*/true);
+    Hashmap new_hashmap(GetCapacity(), dtype_key_, element_shape_key_,
+                        dtypes_value_, element_shapes_value_, value_names_,
+                        device, backend_);
 
     core::Tensor active_addrs;
     GetActiveIndices(active_addrs);
     core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
 
+    Tensor keys = GetKeyTensor().IndexGet({active_indices}).To(device);
+    std::vector<Tensor> values_soa;
+    for (const Tensor& values : GetValueTensors()) {
+        values_soa.push_back(values.IndexGet({active_indices}).To(device));
+    }
+
     core::Tensor addrs, masks;
-    new_hashmap.Insert(keys.IndexGet({active_indices}),
-                       values.IndexGet({active_indices}), addrs, masks);
+    new_hashmap.Insert(keys, values_soa, addrs, masks);
 
     return new_hashmap;
 }
@@ -246,12 +355,21 @@ int64_t Hashmap::GetKeyBytesize() const {
 int64_t Hashmap::GetValueBytesize() const {
     return device_hashmap_->GetValueBytesize();
 }
+std::vector<int64_t> Hashmap::GetValueBytesizes() const {
+    return device_hashmap_->GetValueBytesizes();
+}
 
 Tensor& Hashmap::GetKeyBuffer() const {
     return device_hashmap_->GetKeyBuffer();
 }
-Tensor& Hashmap::GetValueBuffer() const {
-    return device_hashmap_->GetValueBuffer();
+Tensor& Hashmap::GetValueBuffer(size_t i) const {
+    return device_hashmap_->GetValueBuffer(i);
+}
+Tensor& Hashmap::GetValueBuffer(const std::string& name) const {
+    return GetValueBuffer(GetValueBufferIndex(name));
+}
+std::vector<Tensor>& Hashmap::GetValueBuffers() const {
+    return device_hashmap_->GetValueBuffers();
 }
 
 Tensor Hashmap::GetKeyTensor() const {
@@ -263,13 +381,33 @@ Tensor Hashmap::GetKeyTensor() const {
                   GetKeyBuffer().GetBlob());
 }
 
-Tensor Hashmap::GetValueTensor() const {
+Tensor Hashmap::GetValueTensor(size_t i) const {
     int64_t capacity = GetCapacity();
-    SizeVector value_shape = element_shape_value_;
+    SizeVector value_shape = element_shapes_value_.at(i);
     value_shape.insert(value_shape.begin(), capacity);
     return Tensor(value_shape, shape_util::DefaultStrides(value_shape),
-                  GetValueBuffer().GetDataPtr(), dtype_value_,
-                  GetValueBuffer().GetBlob());
+                  GetValueBuffer(i).GetDataPtr(), dtypes_value_[i],
+                  GetValueBuffer(i).GetBlob());
+}
+
+Tensor Hashmap::GetValueTensor(const std::string& name) const {
+    return GetValueTensor(GetValueBufferIndex(name));
+}
+
+std::vector<Tensor> Hashmap::GetValueTensors() const {
+    std::vector<Tensor> value_tensors;
+    for (size_t i = 0; i < dtypes_value_.size(); ++i) {
+        value_tensors.push_back(GetValueTensor(i));
+    }
+    return value_tensors;
+}
+
+size_t Hashmap::GetValueBufferIndex(const std::string& name) const {
+    auto it = std::find(value_names_.begin(), value_names_.end(), name);
+    if (it == value_names_.end()) {
+        utility::LogError("[Hashmap] Unknown value buffer \"{}\".", name);
+    }
+    return static_cast<size_t>(it - value_names_.begin());
 }
 
 /// Return number of elems per bucket.
@@ -296,11 +434,13 @@ void Hashmap::AssertKeyDtype(const Dtype& dtype_key,
 }
 
 void Hashmap::AssertValueDtype(const Dtype& dtype_value,
-                               const SizeVector& element_shape_value) const {
+                               const SizeVector& element_shape_value,
+                               size_t i) const {
     int64_t elem_byte_size =
             dtype_value.ByteSize() * element_shape_value.NumElements();
     int64_t stored_elem_byte_size =
-            dtype_value_.ByteSize() * element_shape_value_.NumElements();
+            dtypes_value_.at(i).ByteSize() *
+            element_shapes_value_.at(i).NumElements();
     if (elem_byte_size != stored_elem_byte_size) {
         utility::LogError(
                 "[Hashmap] Inconsistent element-wise value byte size, expected "
@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#pragma once
+
+#include <string>
+#include <vector>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
@@ -39,6 +44,14 @@ template <typename Hash, typename KeyEq>
 class DeviceHashmap;
 typedef DeviceHashmap<DefaultHash, DefaultKeyEq> DefaultDeviceHashmap;
 
+/// Hash table implementation used on CPU devices. CUDA devices always use the
+/// slab hash table.
+/// - TBB: tbb::concurrent_unordered_map, chaining with per-node allocation.
+/// - OpenAddressing: flat linear-probing table with parallel batched
+/// insertion, lookup and erasure.
+/// - Default: TBB.
+enum class HashmapBackend { Default, TBB, OpenAddressing };
+
 class Hashmap {
 public:
     static constexpr int64_t kDefaultElemsPerBucket = 4;
@@ -62,15 +75,51 @@ public:
             const Dtype& dtype_value,
             const SizeVector& element_shape_key,
             const SizeVector& element_shape_value,
-            const Device& device);
+            const Device& device,
+            const HashmapBackend& backend = HashmapBackend::Default);
+
+    /// Constructor for multi-valued hashmaps. Values are stored as a struct of
+    /// arrays: every (dtype, element shape) pair in \p dtypes_value and
+    /// \p element_shapes_value gets its own buffer, and all buffers are
+    /// indexed by the same address. Kernels can then read or write a single
+    /// attribute (e.g. tsdf) without touching the others (e.g. color).
+    /// Example:
+    /// Key is int<3> coordinate, values are float tsdf, float weight and
+    /// uint8<3> color:
+    /// - dtype_key = Dtype::Int32, element_shape_key = {3}
+    /// - dtypes_value = {Dtype::Float32, Dtype::Float32, Dtype::UInt8}
+    /// - element_shapes_value = {{1}, {1}, {3}}
+    Hashmap(int64_t init_capacity,
+            const Dtype& dtype_key,
+            const SizeVector& element_shape_key,
+            const std::vector<Dtype>& dtypes_value,
+            const std::vector<SizeVector>& element_shapes_value,
+            const Device& device,
+            const HashmapBackend& backend = HashmapBackend::Default);
+
+    /// Constructor for multi-valued hashmaps with named value buffers, e.g.
+    /// value_names = {"tsdf", "weight", "color"} for the example above.
+    /// Buffers can then be accessed by name as well as by index.
+    Hashmap(int64_t init_capacity,
+            const Dtype& dtype_key,
+            const SizeVector& element_shape_key,
+            const std::vector<Dtype>& dtypes_value,
+            const std::vector<SizeVector>& element_shapes_value,
+            const std::vector<std::string>& value_names,
+            const Device& device,
+            const HashmapBackend& backend = HashmapBackend::Default);
 
     ~Hashmap(){};
 
-    /// Rehash expects extra memory space at runtime, since it consists of
+    /// Rehash expects extra memory space at runtime.
+    /// On CUDA it consists of
     /// 1) dumping all key value pairs to a buffer
     /// 2) deallocate old hash table
     /// 3) create a new hash table
     /// 4) parallel insert dumped key value pairs
+    /// On CPU the key/value buffers are copied into larger ones with one
+    /// memcpy each, without reinsertion, and existing entries keep their
+    /// addresses. Only the index is rebuilt.
     void Rehash(int64_t buckets);
 
     /// Parallel insert arrays of keys and values in Tensors.
@@ -83,6 +132,13 @@ public:
                 Tensor& output_addrs,
                 Tensor& output_masks);
 
+    /// Parallel insert arrays of keys and values for multi-valued hashmaps,
+    /// with one value Tensor per value buffer, in construction order.
+    void Insert(const Tensor& input_keys,
+                const std::vector<Tensor>& input_values_soa,
+                Tensor& output_addrs,
+                Tensor& output_masks);
+
     /// Parallel activate arrays of keys in Tensor.
     /// Specifically useful for large value elements (e.g., a tensor), where we
     /// can do in-place management after activation.
@@ -124,14 +180,31 @@ public:
     int64_t GetCapacity() const;
     int64_t GetBucketCount() const;
     Device GetDevice() const;
+    HashmapBackend GetBackend() const { return backend_; }
     int64_t GetKeyBytesize() const;
     int64_t GetValueBytesize() const;
+    std::vector<int64_t> GetValueBytesizes() const;
+    int64_t GetValueBufferCount() const {
+        return static_cast<int64_t>(dtypes_value_.size());
+    }
+    /// Return the value buffer names, empty for unnamed value buffers.
+    const std::vector<std::string>& GetValueNames() const {
+        return value_names_;
+    }
+    /// Return the index of the value buffer named \p name.
+    size_t GetValueBufferIndex(const std::string& name) const;
 
     Tensor& GetKeyBuffer() const;
-    Tensor& GetValueBuffer() const;
+    Tensor& GetValueBuffer(size_t i = 0) const;
+    Tensor& GetValueBuffer(const std::string& name) const;
+    std::vector<Tensor>& GetValueBuffers() const;
 
     Tensor GetKeyTensor() const;
-    Tensor GetValueTensor() const;
+    /// Return the i-th value buffer as a Tensor of shape
+    /// {capacity, element_shapes_value[i]...}.
+    Tensor GetValueTensor(size_t i = 0) const;
+    Tensor GetValueTensor(const std::string& name) const;
+    std::vector<Tensor> GetValueTensors() const;
 
     /// Return number of elems per bucket.
     /// High performance not required, so directly returns a vector.
@@ -144,19 +217,23 @@ protected:
     void AssertKeyDtype(const Dtype& dtype_key,
                         const SizeVector& elem_shape) const;
     void AssertValueDtype(const Dtype& dtype_val,
-                          const SizeVector& elem_shape) const;
+                          const SizeVector& elem_shape,
+                          size_t i = 0) const;
 
     Dtype GetKeyDtype() const { return dtype_key_; }
-    Dtype GetValueDtype() const { return dtype_value_; }
+    Dtype GetValueDtype(size_t i = 0) const { return dtypes_value_.at(i); }
 
 private:
     std::shared_ptr<DefaultDeviceHashmap> device_hashmap_;
 
     Dtype dtype_key_ = Dtype::Undefined;
-    Dtype dtype_value_ = Dtype::Undefined;
+    std::vector<Dtype> dtypes_value_;
 
     SizeVector element_shape_key_;
-    SizeVector element_shape_value_;
+    std::vector<SizeVector> element_shapes_value_;
+    std::vector<std::string> value_names_;
+
+    HashmapBackend backend_ = HashmapBackend::Default;
 };
 
 }  // namespace core
@@ -59,36 +59,41 @@ typedef uint32_t addr_t;
 
 class HashmapBuffer {
 public:
+    /// Struct-of-arrays layout: one value buffer per entry of \p dsize_values,
+    /// all indexed by the same address.
     HashmapBuffer(int64_t capacity,
                   int64_t dsize_key,
-                  int64_t dsize_value,
+                  const std::vector<int64_t> &dsize_values,
                   const Device &device)
         : capacity_(capacity),
           dsize_key_(dsize_key),
-          dsize_value_(dsize_value),
+          dsize_values_(dsize_values),
           device_(device) {
         key_buffer_ =
                 Tensor({capacity_},
                        Dtype(Dtype::DtypeCode::Object, dsize_key_, "_hash_k"),
                        device_);
-        value_buffer_ =
-                Tensor({capacity_},
-                       Dtype(Dtype::DtypeCode::Object, dsize_value_, "_hash_v"),
-                       device_);
+        for (int64_t dsize_value : dsize_values_) {
+            value_buffers_.push_back(Tensor(
+                    {capacity_},
+                    Dtype(Dtype::DtypeCode::Object, dsize_value, "_hash_v"),
+                    device_));
+        }
         heap_ = Tensor({capacity_}, Dtype::Int32, device_);
     }
 
     Tensor &GetKeyBuffer() { return key_buffer_; }
-    Tensor &GetValueBuffer() { return value_buffer_; }
+    Tensor &GetValueBuffer(size_t i = 0) { return value_buffers_.at(i); }
+    std::vector<Tensor> &GetValueBuffers() { return value_buffers_; }
     Tensor &GetHeap() { return heap_; }
 
 protected:
     int64_t capacity_;
     int64_t dsize_key_;
-    int64_t dsize_value_;
+    std::vector<int64_t> dsize_values_;
 
     Tensor key_buffer_;
-    Tensor value_buffer_;
+    std::vector<Tensor> value_buffers_;
     Tensor heap_;
 
     Device device_;
@@ -57,16 +57,19 @@ std::shared_ptr<DeviceHashmap<Hash, KeyEq>> CreateTemplateDeviceHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
-        int64_t dsize_value,
-        const Device &device) {
+        const std::vector<int64_t> &dsize_values,
+        const Device &device,
+        const HashmapBackend &backend = HashmapBackend::Default) {
     if (device.GetType() == Device::DeviceType::CPU) {
-        return CreateTemplateCPUHashmap<Hash, KeyEq>(
-                init_buckets, init_capacity, dsize_key, dsize_value, device);
+        return CreateTemplateCPUHashmap<Hash, KeyEq>(init_buckets,
+                                                     init_capacity, dsize_key,
+                                                     dsize_values, device,
+                                                     backend);
     }
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
     else if (device.GetType() == Device::DeviceType::CUDA) {
         return CreateTemplateCUDAHashmap<Hash, KeyEq>(
-                init_buckets, init_capacity, dsize_key, dsize_value, device);
+                init_buckets, init_capacity, dsize_key, dsize_values, device);
     }
 #endif
     else {
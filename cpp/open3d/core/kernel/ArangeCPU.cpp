@@ -43,10 +43,14 @@ void ArangeCPU(const Tensor& start,
         scalar_t sstep = step.Item<scalar_t>();
         scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
         int64_t n = dst.GetLength();
-        CPULauncher::LaunchGeneralKernel(n, [&](int64_t workload_idx) {
-            dst_ptr[workload_idx] =
-                    sstart + static_cast<scalar_t>(sstep * workload_idx);
-        });
+        CPULauncher::LaunchGeneralKernel(
+                n,
+                [&](int64_t workload_idx) {
+                    dst_ptr[workload_idx] =
+                            sstart +
+                            static_cast<scalar_t>(sstep * workload_idx);
+                },
+                kDefaultGrainSize);
     });
 }
 
@@ -61,6 +61,81 @@ static void CPUDivElementKernel(const void* lhs, const void* rhs, void* dst) {
                                    *static_cast<const scalar_t*>(rhs);
 }
 
+/// Returns true if \p src can be read linearly (or as a single broadcasted
+/// value) while writing the contiguous \p dst.
+static bool IsContiguousOperand(const Tensor& src, const Tensor& dst) {
+    return src.GetDtype() == dst.GetDtype() &&
+           (src.NumElements() == 1 ||
+            (src.IsContiguous() && src.GetShape() == dst.GetShape()));
+}
+
+/// Vectorized binary kernel for contiguous operands. Either input may be a
+/// single value broadcasted to the shape of dst.
+template <typename scalar_t, typename func_t>
+static void LaunchContiguousBinaryEWKernel(const Tensor& lhs,
+                                           const Tensor& rhs,
+                                           Tensor& dst,
+                                           func_t element_kernel) {
+    const scalar_t* lhs_ptr = static_cast<const scalar_t*>(lhs.GetDataPtr());
+    const scalar_t* rhs_ptr = static_cast<const scalar_t*>(rhs.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+    bool lhs_is_scalar = lhs.NumElements() == 1;
+    bool rhs_is_scalar = rhs.NumElements() == 1;
+
+    CPULauncher::LaunchVectorizedKernel(
+            dst.NumElements(), [&](int64_t start, int64_t end) {
+                if (rhs_is_scalar) {
+                    const scalar_t rhs_val = *rhs_ptr;
+                    OPEN3D_SIMD_LOOP
+                    for (int64_t i = start; i < end; ++i) {
+                        dst_ptr[i] = element_kernel(lhs_ptr[i], rhs_val);
+                    }
+                } else if (lhs_is_scalar) {
+                    const scalar_t lhs_val = *lhs_ptr;
+                    OPEN3D_SIMD_LOOP
+                    for (int64_t i = start; i < end; ++i) {
+                        dst_ptr[i] = element_kernel(lhs_val, rhs_ptr[i]);
+                    }
+                } else {
+                    OPEN3D_SIMD_LOOP
+                    for (int64_t i = start; i < end; ++i) {
+                        dst_ptr[i] = element_kernel(lhs_ptr[i], rhs_ptr[i]);
+                    }
+                }
+            });
+}
+
+template <typename scalar_t>
+static void LaunchContiguousArithmeticKernel(const Tensor& lhs,
+                                             const Tensor& rhs,
+                                             Tensor& dst,
+                                             BinaryEWOpCode op_code) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            LaunchContiguousBinaryEWKernel<scalar_t>(
+                    lhs, rhs, dst,
+                    [](scalar_t a, scalar_t b) -> scalar_t { return a + b; });
+            break;
+        case BinaryEWOpCode::Sub:
+            LaunchContiguousBinaryEWKernel<scalar_t>(
+                    lhs, rhs, dst,
+                    [](scalar_t a, scalar_t b) -> scalar_t { return a - b; });
+            break;
+        case BinaryEWOpCode::Mul:
+            LaunchContiguousBinaryEWKernel<scalar_t>(
+                    lhs, rhs, dst,
+                    [](scalar_t a, scalar_t b) -> scalar_t { return a * b; });
+            break;
+        case BinaryEWOpCode::Div:
+            LaunchContiguousBinaryEWKernel<scalar_t>(
+                    lhs, rhs, dst,
+                    [](scalar_t a, scalar_t b) -> scalar_t { return a / b; });
+            break;
+        default:
+            break;
+    }
+}
+
 template <typename src_t, typename dst_t>
 static void CPULogicalAndElementKernel(const void* lhs,
                                        const void* rhs,
@@ -201,6 +276,11 @@ void BinaryEWCPU(const Tensor& lhs,
                         "same type as the input.");
             }
         });
+    } else if (dst.IsContiguous() && IsContiguousOperand(lhs, dst) &&
+               IsContiguousOperand(rhs, dst)) {
+        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+            LaunchContiguousArithmeticKernel<scalar_t>(lhs, rhs, dst, op_code);
+        });
     } else {
         Indexer indexer({lhs, rhs}, dst, DtypePolicy::ALL_SAME);
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
@@ -32,7 +32,8 @@
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/Tensor.h"
-#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/kernel/CPUVectorization.h"
+#include "open3d/core/kernel/ParallelFor.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -51,45 +52,78 @@ public:
     template <typename func_t>
     static void LaunchIndexFillKernel(const Indexer& indexer,
                                       func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx), workload_idx);
-        }
+        ParallelFor(indexer.NumWorkloads(), kDefaultGrainSize,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t workload_idx = start; workload_idx < end;
+                             ++workload_idx) {
+                            element_kernel(
+                                    indexer.GetInputPtr(0, workload_idx),
+                                    workload_idx);
+                        }
+                    });
     }
 
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        ParallelFor(indexer.NumWorkloads(), kDefaultGrainSize,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t workload_idx = start; workload_idx < end;
+                             ++workload_idx) {
+                            element_kernel(
+                                    indexer.GetInputPtr(0, workload_idx),
+                                    indexer.GetOutputPtr(workload_idx));
+                        }
+                    });
     }
 
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        ParallelFor(indexer.NumWorkloads(), kDefaultGrainSize,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t workload_idx = start; workload_idx < end;
+                             ++workload_idx) {
+                            element_kernel(
+                                    indexer.GetInputPtr(0, workload_idx),
+                                    indexer.GetInputPtr(1, workload_idx),
+                                    indexer.GetOutputPtr(workload_idx));
+                        }
+                    });
+    }
+
+    /// Splits [0, n) into ranges of at least kDefaultGrainSize elements,
+    /// except for the last one, and calls range_kernel(start, end) on each
+    /// range. range_kernel is compiled for and dispatched to the widest SIMD
+    /// instruction set of the running CPU, see LaunchVectorized(). This is
+    /// used by the fast paths for contiguous tensors, where the per-element
+    /// Indexer offset computation is avoided.
+    template <typename func_t>
+    static void LaunchVectorizedKernel(int64_t n, func_t range_kernel) {
+        // Ranges are aligned to 64 elements so that threads do not share
+        // cache lines of the output.
+        static constexpr int64_t kAlignment = 64;
+        int64_t num_blocks = (n + kAlignment - 1) / kAlignment;
+        ParallelFor(num_blocks, kDefaultGrainSize / kAlignment,
+                    [&](int64_t block_start, int64_t block_end) {
+                        int64_t start = block_start * kAlignment;
+                        int64_t end = std::min(block_end * kAlignment, n);
+                        LaunchVectorized(
+                                [&]() { range_kernel(start, end); });
+                    });
     }
 
     template <typename func_t>
     static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                             func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        ParallelFor(indexer.NumWorkloads(), kDefaultGrainSize,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t workload_idx = start; workload_idx < end;
+                             ++workload_idx) {
+                            element_kernel(indexer.GetInputPtr(workload_idx),
+                                           indexer.GetOutputPtr(workload_idx));
+                        }
+                    });
     }
 
     template <typename scalar_t, typename func_t>
@@ -102,8 +136,10 @@ public:
         }
     }
 
-    /// Create num_threads workers to compute partial reductions and then reduce
-    /// to the final results. This only applies to reduction op with one output.
+    /// Computes partial reductions of chunks of kDefaultGrainSize workloads
+    /// and then reduces them to the final result. The chunking does not
+    /// depend on the number of threads, so results are reproducible. This only
+    /// applies to reduction op with one output.
     template <typename scalar_t, typename func_t>
     static void LaunchReductionKernelTwoPass(const Indexer& indexer,
                                              func_t element_kernel,
@@ -114,24 +150,26 @@ public:
                     "single-output reduction ops.");
         }
         int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = GetMaxThreads();
-        int64_t workload_per_thread =
-                (num_workloads + num_threads - 1) / num_threads;
-        std::vector<scalar_t> thread_results(num_threads, identity);
-
-#pragma omp parallel for schedule(static)
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                element_kernel(indexer.GetInputPtr(0, workload_idx),
-                               &thread_results[thread_idx]);
+        int64_t num_chunks =
+                (num_workloads + kDefaultGrainSize - 1) / kDefaultGrainSize;
+        std::vector<scalar_t> chunk_results(num_chunks, identity);
+
+        ParallelFor(num_chunks, 1, [&](int64_t chunk_start, int64_t chunk_end) {
+            for (int64_t chunk_idx = chunk_start; chunk_idx < chunk_end;
+                 ++chunk_idx) {
+                int64_t start = chunk_idx * kDefaultGrainSize;
+                int64_t end =
+                        std::min(start + kDefaultGrainSize, num_workloads);
+                for (int64_t workload_idx = start; workload_idx < end;
+                     ++workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   &chunk_results[chunk_idx]);
+                }
             }
-        }
+        });
         void* output_ptr = indexer.GetOutputPtr(0);
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            element_kernel(&thread_results[thread_idx], output_ptr);
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            element_kernel(&chunk_results[chunk_idx], output_ptr);
         }
     }
 
@@ -141,7 +179,7 @@ public:
         // Prefers outer dimension >= num_threads.
         const int64_t* indexer_shape = indexer.GetMasterShape();
         const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = GetMaxThreads();
+        int64_t num_threads = GetParallelForNumThreads();
 
         // Init best_dim as the outer-most non-reduction dim.
         int64_t best_dim = num_dims - 1;
@@ -163,21 +201,38 @@ public:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        int64_t workloads_per_slice =
+                indexer.NumWorkloads() / std::max(indexer_shape[best_dim],
+                                                  int64_t(1));
+        int64_t grain_size =
+                kDefaultGrainSize / std::max(workloads_per_slice, int64_t(1));
+        ParallelFor(indexer_shape[best_dim], grain_size,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t i = start; i < end; ++i) {
+                            Indexer sub_indexer(indexer);
+                            sub_indexer.ShrinkDim(best_dim, i, 1);
+                            LaunchReductionKernelSerial<scalar_t>(
+                                    sub_indexer, element_kernel);
+                        }
+                    });
     }
 
-    /// General kernels with non-conventional indexers
+    /// General kernels with non-conventional indexers.
+    ///
+    /// \param grain_size Minimum number of workloads per task. The default
+    /// of 1 suits kernels with expensive workloads, e.g. one voxel block per
+    /// workload. Cheap per-element kernels should pass a larger value, such as
+    /// kDefaultGrainSize, so that small inputs are processed serially.
     template <typename func_t>
-    static void LaunchGeneralKernel(int64_t n, func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
-            element_kernel(workload_idx);
-        }
+    static void LaunchGeneralKernel(int64_t n,
+                                    func_t element_kernel,
+                                    int64_t grain_size = 1) {
+        ParallelFor(n, grain_size, [&](int64_t start, int64_t end) {
+            for (int64_t workload_idx = start; workload_idx < end;
+                 ++workload_idx) {
+                element_kernel(workload_idx);
+            }
+        });
     }
 };
 
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPUVectorization.h"
+
+#include <atomic>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static CPUInstructionSet DetectCPUInstructionSet() {
+#if defined(OPEN3D_CPU_X86_SIMD)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512dq")) {
+        return CPUInstructionSet::AVX512;
+    } else if (__builtin_cpu_supports("avx2")) {
+        return CPUInstructionSet::AVX2;
+    } else {
+        return CPUInstructionSet::Generic;
+    }
+#elif defined(OPEN3D_CPU_NEON_SIMD)
+    return CPUInstructionSet::NEON;
+#else
+    return CPUInstructionSet::Generic;
+#endif
+}
+
+static std::atomic<int>& ActiveCPUInstructionSet() {
+    static std::atomic<int> isa(static_cast<int>(DetectCPUInstructionSet()));
+    return isa;
+}
+
+CPUInstructionSet GetSupportedCPUInstructionSet() {
+    static const CPUInstructionSet isa = DetectCPUInstructionSet();
+    return isa;
+}
+
+CPUInstructionSet GetCPUInstructionSet() {
+    return static_cast<CPUInstructionSet>(
+            ActiveCPUInstructionSet().load(std::memory_order_relaxed));
+}
+
+void SetCPUInstructionSet(CPUInstructionSet isa) {
+    CPUInstructionSet supported = GetSupportedCPUInstructionSet();
+    bool is_supported = isa == CPUInstructionSet::Generic || isa == supported ||
+                        (isa == CPUInstructionSet::AVX2 &&
+                         supported == CPUInstructionSet::AVX512);
+    if (!is_supported) {
+        utility::LogError("CPU instruction set {} is not supported, the {} "
+                          "instruction set is available.",
+                          CPUInstructionSetToString(isa),
+                          CPUInstructionSetToString(supported));
+    }
+    ActiveCPUInstructionSet().store(static_cast<int>(isa));
+}
+
+std::string CPUInstructionSetToString(CPUInstructionSet isa) {
+    switch (isa) {
+        case CPUInstructionSet::Generic:
+            return "Generic";
+        case CPUInstructionSet::NEON:
+            return "NEON";
+        case CPUInstructionSet::AVX2:
+            return "AVX2";
+        case CPUInstructionSet::AVX512:
+            return "AVX512";
+        default:
+            return "Unknown";
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Contiguous CPU kernels are written as plain loops annotated with
+// OPEN3D_SIMD_LOOP and compiled once per instruction set. On x86 the AVX2 and
+// AVX-512 variants are generated with GCC/Clang target attributes and selected
+// at runtime, so the binary still runs on CPUs without these extensions. On
+// AArch64, NEON is part of the baseline ISA and the generic variant is used.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define OPEN3D_CPU_X86_SIMD
+#define OPEN3D_CPU_TARGET_AVX2 __attribute__((target("avx2"), flatten))
+#define OPEN3D_CPU_TARGET_AVX512 \
+    __attribute__((target("avx512f,avx512dq,avx2"), flatten))
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#define OPEN3D_CPU_NEON_SIMD
+#endif
+
+#define OPEN3D_CPU_PRAGMA(x) _Pragma(#x)
+#if defined(_OPENMP) && !defined(_MSC_VER)
+// Reductions are allowed to be reassociated within a SIMD lane group, the same
+// way the two-pass reduction already reassociates across threads.
+#define OPEN3D_SIMD_LOOP OPEN3D_CPU_PRAGMA(omp simd)
+#define OPEN3D_SIMD_REDUCTION_LOOP(op, var) \
+    OPEN3D_CPU_PRAGMA(omp simd reduction(op : var))
+#elif defined(__clang__)
+#define OPEN3D_SIMD_LOOP OPEN3D_CPU_PRAGMA(clang loop vectorize(enable))
+#define OPEN3D_SIMD_REDUCTION_LOOP(op, var)
+#elif defined(__GNUC__)
+#define OPEN3D_SIMD_LOOP OPEN3D_CPU_PRAGMA(GCC ivdep)
+#define OPEN3D_SIMD_REDUCTION_LOOP(op, var)
+#else
+#define OPEN3D_SIMD_LOOP
+#define OPEN3D_SIMD_REDUCTION_LOOP(op, var)
+#endif
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class CPUInstructionSet { Generic = 0, NEON = 1, AVX2 = 2, AVX512 = 3 };
+
+/// Returns the widest instruction set supported by both the running CPU and
+/// the compiler that built Open3D.
+CPUInstructionSet GetSupportedCPUInstructionSet();
+
+/// Returns the instruction set used by the vectorized CPU kernels. Defaults to
+/// GetSupportedCPUInstructionSet().
+CPUInstructionSet GetCPUInstructionSet();
+
+/// Restricts the vectorized CPU kernels to \p isa, e.g. to compare against the
+/// generic code path. Throws if \p isa is not supported by the running CPU.
+void SetCPUInstructionSet(CPUInstructionSet isa);
+
+std::string CPUInstructionSetToString(CPUInstructionSet isa);
+
+namespace detail {
+
+#ifdef OPEN3D_CPU_X86_SIMD
+template <typename func_t>
+OPEN3D_CPU_TARGET_AVX2 void RunAVX2(const func_t& func) {
+    func();
+}
+
+template <typename func_t>
+OPEN3D_CPU_TARGET_AVX512 void RunAVX512(const func_t& func) {
+    func();
+}
+#endif
+
+}  // namespace detail
+
+/// Runs \p func compiled for the instruction set returned by
+/// GetCPUInstructionSet(). \p func is inlined into an instruction-set specific
+/// wrapper, so loops inside it marked with OPEN3D_SIMD_LOOP are vectorized
+/// with the corresponding register width.
+template <typename func_t>
+void LaunchVectorized(const func_t& func) {
+#ifdef OPEN3D_CPU_X86_SIMD
+    switch (GetCPUInstructionSet()) {
+        case CPUInstructionSet::AVX512:
+            detail::RunAVX512(func);
+            return;
+        case CPUInstructionSet::AVX2:
+            detail::RunAVX2(func);
+            return;
+        default:
+            break;
+    }
+#endif
+    func();
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
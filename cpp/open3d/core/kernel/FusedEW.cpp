@@ -0,0 +1,229 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include <numeric>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static void CheckFusedEWArguments(
+        const std::vector<Tensor>& inputs,
+        const std::vector<FusedEWInstruction>& program,
+        const SizeVector& shape,
+        const Dtype& dtype,
+        const Device& device) {
+    if (program.empty()) {
+        utility::LogError("Empty fused element-wise program.");
+    }
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != device) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(), device.ToString());
+        }
+        if (input.GetDtype() != dtype) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              input.GetDtype().ToString(), dtype.ToString());
+        }
+        if (input.GetShape() != shape) {
+            utility::LogError("Input shape {} does not match {}.",
+                              input.GetShape(), shape);
+        }
+    }
+    for (size_t i = 0; i < program.size(); ++i) {
+        const FusedEWInstruction& ins = program[i];
+        switch (ins.op_code_) {
+            case FusedEWOpCode::Input:
+                if (ins.lhs_ < 0 ||
+                    ins.lhs_ >= static_cast<int64_t>(inputs.size())) {
+                    utility::LogError("Invalid input index {}.", ins.lhs_);
+                }
+                break;
+            case FusedEWOpCode::Scalar:
+                break;
+            case FusedEWOpCode::Add:
+            case FusedEWOpCode::Sub:
+            case FusedEWOpCode::Mul:
+            case FusedEWOpCode::Div:
+                if (ins.rhs_ < 0 || ins.rhs_ >= static_cast<int64_t>(i)) {
+                    utility::LogError("Invalid operand {} for instruction {}.",
+                                      ins.rhs_, i);
+                }
+                // fall through
+            default:
+                if (ins.lhs_ < 0 || ins.lhs_ >= static_cast<int64_t>(i)) {
+                    utility::LogError("Invalid operand {} for instruction {}.",
+                                      ins.lhs_, i);
+                }
+                break;
+        }
+    }
+}
+
+#ifdef BUILD_CUDA_MODULE
+/// Reference evaluation with one Tensor op per instruction, used on devices
+/// without a fused kernel.
+static Tensor FusedEWUnfused(const std::vector<Tensor>& inputs,
+                             const std::vector<FusedEWInstruction>& program,
+                             const Dtype& dtype,
+                             const Device& device) {
+    std::vector<Tensor> results;
+    for (const FusedEWInstruction& ins : program) {
+        switch (ins.op_code_) {
+            case FusedEWOpCode::Input:
+                results.push_back(inputs[ins.lhs_]);
+                break;
+            case FusedEWOpCode::Scalar:
+                results.push_back(Tensor::Full({}, ins.scalar_, dtype, device));
+                break;
+            case FusedEWOpCode::Add:
+                results.push_back(results[ins.lhs_] + results[ins.rhs_]);
+                break;
+            case FusedEWOpCode::Sub:
+                results.push_back(results[ins.lhs_] - results[ins.rhs_]);
+                break;
+            case FusedEWOpCode::Mul:
+                results.push_back(results[ins.lhs_] * results[ins.rhs_]);
+                break;
+            case FusedEWOpCode::Div:
+                results.push_back(results[ins.lhs_] / results[ins.rhs_]);
+                break;
+            case FusedEWOpCode::Neg:
+                results.push_back(results[ins.lhs_].Neg());
+                break;
+            case FusedEWOpCode::Abs:
+                results.push_back(results[ins.lhs_].Abs());
+                break;
+            case FusedEWOpCode::Sqrt:
+                results.push_back(results[ins.lhs_].Sqrt());
+                break;
+            case FusedEWOpCode::Square:
+                results.push_back(results[ins.lhs_] * results[ins.lhs_]);
+                break;
+            case FusedEWOpCode::Exp:
+                results.push_back(results[ins.lhs_].Exp());
+                break;
+            case FusedEWOpCode::Sin:
+                results.push_back(results[ins.lhs_].Sin());
+                break;
+            case FusedEWOpCode::Cos:
+                results.push_back(results[ins.lhs_].Cos());
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    }
+    return results.back();
+}
+#endif
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst) {
+    CheckFusedEWArguments(inputs, program, dst.GetShape(), dst.GetDtype(),
+                          dst.GetDevice());
+    if (!dst.IsContiguous()) {
+        utility::LogError("Fused element-wise output must be contiguous.");
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        dst.AsRvalue() = FusedEWUnfused(inputs, program, dst.GetDtype(),
+                                        dst.GetDevice())
+                                 .Expand(dst.GetShape());
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+void FusedEWReduction(const std::vector<Tensor>& inputs,
+                      const std::vector<FusedEWInstruction>& program,
+                      Tensor& dst,
+                      ReductionOpCode op_code) {
+    if (s_regular_reduce_ops.find(op_code) == s_regular_reduce_ops.end()) {
+        utility::LogError("Unsupported op code.");
+    }
+    if (dst.NumDims() != 0) {
+        utility::LogError("Fused reduction output must be a 0-dim Tensor.");
+    }
+    const SizeVector shape =
+            inputs.empty() ? SizeVector{} : inputs[0].GetShape();
+    CheckFusedEWArguments(inputs, program, shape, dst.GetDtype(),
+                          dst.GetDevice());
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWReductionCPU(inputs, program, dst, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        Tensor result = FusedEWUnfused(inputs, program, dst.GetDtype(),
+                                       dst.GetDevice())
+                                .Expand(shape);
+        SizeVector dims(shape.size());
+        std::iota(dims.begin(), dims.end(), 0);
+        Tensor reduced;
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                reduced = result.Sum(dims);
+                break;
+            case ReductionOpCode::Prod:
+                reduced = result.Prod(dims);
+                break;
+            case ReductionOpCode::Min:
+                reduced = result.Min(dims);
+                break;
+            case ReductionOpCode::Max:
+                reduced = result.Max(dims);
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+        dst.AsRvalue() = reduced;
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEWReduction: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Reduction.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class FusedEWOpCode {
+    Input,   // Load element from inputs[lhs_].
+    Scalar,  // Constant scalar_.
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Abs,
+    Sqrt,
+    Square,
+    Exp,
+    Sin,
+    Cos,
+};
+
+/// One node of a fused element-wise program. Programs are in topological
+/// order: the result of instruction i is referred to by index i, and lhs_ /
+/// rhs_ may only refer to earlier instructions. The last instruction is the
+/// result of the program.
+struct FusedEWInstruction {
+    FusedEWOpCode op_code_;
+    int64_t lhs_ = -1;
+    int64_t rhs_ = -1;
+    double scalar_ = 0;
+};
+
+/// Evaluates \p program element-wise into \p dst in a single pass, without
+/// materializing intermediate results. All \p inputs must have the same dtype
+/// as \p dst and the shape of \p dst (e.g. broadcasted with Tensor::Expand).
+/// \p dst must be contiguous.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst);
+
+/// Evaluates \p program element-wise and reduces the result over all elements
+/// into the 0-dim Tensor \p dst. \p op_code must be one of Sum, Prod, Min and
+/// Max.
+void FusedEWReduction(const std::vector<Tensor>& inputs,
+                      const std::vector<FusedEWInstruction>& program,
+                      Tensor& dst,
+                      ReductionOpCode op_code);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst);
+
+void FusedEWReductionCPU(const std::vector<Tensor>& inputs,
+                         const std::vector<FusedEWInstruction>& program,
+                         Tensor& dst,
+                         ReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
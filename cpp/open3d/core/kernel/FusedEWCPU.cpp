@@ -0,0 +1,344 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/core/kernel/ParallelFor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Programs are evaluated block by block. Each instruction produces one block
+/// of results in a per-thread scratch buffer, so intermediate results stay in
+/// cache and the inner loops are simple enough to be vectorized.
+static constexpr int64_t kFusedEWBlockSize = 256;
+
+template <typename scalar_t,
+          typename std::enable_if<std::is_signed<scalar_t>::value, int>::type =
+                  0>
+static inline scalar_t CPUAbsElementKernel(scalar_t x) {
+    return x < 0 ? -x : x;
+}
+
+template <typename scalar_t,
+          typename std::enable_if<!std::is_signed<scalar_t>::value,
+                                  int>::type = 0>
+static inline scalar_t CPUAbsElementKernel(scalar_t x) {
+    return x;
+}
+
+template <typename scalar_t>
+class CPUFusedEWEngine {
+public:
+    CPUFusedEWEngine(const std::vector<Tensor>& inputs,
+                     const std::vector<FusedEWInstruction>& program)
+        : program_(program) {
+        for (const Tensor& input : inputs) {
+            inputs_.emplace_back(input);
+            inputs_contiguous_.push_back(input.IsContiguous());
+        }
+    }
+
+    int64_t NumRegisters() const {
+        return static_cast<int64_t>(program_.size());
+    }
+
+    /// Allocates the per-thread scratch buffer and fills constant registers.
+    void InitScratch(std::vector<scalar_t>& scratch) const {
+        scratch.resize(program_.size() * kFusedEWBlockSize);
+        for (size_t i = 0; i < program_.size(); ++i) {
+            if (program_[i].op_code_ == FusedEWOpCode::Scalar) {
+                std::fill_n(scratch.data() + i * kFusedEWBlockSize,
+                            kFusedEWBlockSize,
+                            static_cast<scalar_t>(program_[i].scalar_));
+            }
+        }
+    }
+
+    /// Evaluates elements [start, start + n) with n <= kFusedEWBlockSize and
+    /// returns a pointer to the results. If \p dst is not null, the last
+    /// instruction writes to \p dst directly.
+    const scalar_t* EvalBlock(int64_t start,
+                              int64_t n,
+                              scalar_t* scratch,
+                              std::vector<const scalar_t*>& registers,
+                              scalar_t* dst) const {
+        const int64_t num_registers = NumRegisters();
+        for (int64_t i = 0; i < num_registers; ++i) {
+            const FusedEWInstruction& ins = program_[i];
+            scalar_t* out = scratch + i * kFusedEWBlockSize;
+            if (dst != nullptr && i == num_registers - 1) {
+                out = dst;
+            }
+            const bool is_leaf = ins.op_code_ == FusedEWOpCode::Input ||
+                                 ins.op_code_ == FusedEWOpCode::Scalar;
+            const scalar_t* a = is_leaf ? nullptr : registers[ins.lhs_];
+            const scalar_t* b = ins.rhs_ >= 0 ? registers[ins.rhs_] : nullptr;
+
+            switch (ins.op_code_) {
+                case FusedEWOpCode::Input:
+                    if (inputs_contiguous_[ins.lhs_] && out != dst) {
+                        registers[i] = static_cast<const scalar_t*>(
+                                               inputs_[ins.lhs_].data_ptr_) +
+                                       start;
+                        continue;
+                    }
+                    GatherBlock(inputs_[ins.lhs_], start, n, out);
+                    break;
+                case FusedEWOpCode::Scalar:
+                    if (out == dst) {
+                        std::fill_n(out, n,
+                                    static_cast<scalar_t>(ins.scalar_));
+                    }
+                    break;
+                case FusedEWOpCode::Add:
+                    for (int64_t k = 0; k < n; ++k) out[k] = a[k] + b[k];
+                    break;
+                case FusedEWOpCode::Sub:
+                    for (int64_t k = 0; k < n; ++k) out[k] = a[k] - b[k];
+                    break;
+                case FusedEWOpCode::Mul:
+                    for (int64_t k = 0; k < n; ++k) out[k] = a[k] * b[k];
+                    break;
+                case FusedEWOpCode::Div:
+                    for (int64_t k = 0; k < n; ++k) out[k] = a[k] / b[k];
+                    break;
+                case FusedEWOpCode::Neg:
+                    for (int64_t k = 0; k < n; ++k) out[k] = -a[k];
+                    break;
+                case FusedEWOpCode::Abs:
+                    for (int64_t k = 0; k < n; ++k) {
+                        out[k] = CPUAbsElementKernel(a[k]);
+                    }
+                    break;
+                case FusedEWOpCode::Sqrt:
+                    for (int64_t k = 0; k < n; ++k) {
+                        out[k] = static_cast<scalar_t>(
+                                std::sqrt(static_cast<double>(a[k])));
+                    }
+                    break;
+                case FusedEWOpCode::Square:
+                    for (int64_t k = 0; k < n; ++k) out[k] = a[k] * a[k];
+                    break;
+                case FusedEWOpCode::Exp:
+                    for (int64_t k = 0; k < n; ++k) {
+                        out[k] = static_cast<scalar_t>(
+                                std::exp(static_cast<double>(a[k])));
+                    }
+                    break;
+                case FusedEWOpCode::Sin:
+                    for (int64_t k = 0; k < n; ++k) {
+                        out[k] = static_cast<scalar_t>(
+                                std::sin(static_cast<double>(a[k])));
+                    }
+                    break;
+                case FusedEWOpCode::Cos:
+                    for (int64_t k = 0; k < n; ++k) {
+                        out[k] = static_cast<scalar_t>(
+                                std::cos(static_cast<double>(a[k])));
+                    }
+                    break;
+                default:
+                    utility::LogError("Unsupported op code.");
+                    break;
+            }
+            registers[i] = out;
+        }
+        return registers[num_registers - 1];
+    }
+
+private:
+    /// Loads n elements of a strided (e.g. broadcasted) input in row-major
+    /// order, starting from linear index start.
+    static void GatherBlock(const TensorRef& input,
+                            int64_t start,
+                            int64_t n,
+                            scalar_t* out) {
+        const int64_t ndims = input.ndims_;
+        int64_t index[MAX_DIMS];
+        int64_t offset = 0;
+        int64_t remaining = start;
+        for (int64_t d = ndims - 1; d >= 0; --d) {
+            index[d] = remaining % input.shape_[d];
+            remaining /= input.shape_[d];
+            offset += index[d] * input.byte_strides_[d];
+        }
+        const char* data_ptr = static_cast<const char*>(input.data_ptr_);
+        for (int64_t k = 0; k < n; ++k) {
+            out[k] = *reinterpret_cast<const scalar_t*>(data_ptr + offset);
+            for (int64_t d = ndims - 1; d >= 0; --d) {
+                offset += input.byte_strides_[d];
+                if (++index[d] < input.shape_[d]) {
+                    break;
+                }
+                offset -= index[d] * input.byte_strides_[d];
+                index[d] = 0;
+            }
+        }
+    }
+
+    std::vector<TensorRef> inputs_;
+    std::vector<bool> inputs_contiguous_;
+    std::vector<FusedEWInstruction> program_;
+};
+
+template <typename scalar_t>
+static void LaunchFusedEW(const CPUFusedEWEngine<scalar_t>& engine,
+                          int64_t num_elements,
+                          scalar_t* dst) {
+    // The scratch buffer is allocated once per range of blocks.
+    const int64_t num_blocks =
+            (num_elements + kFusedEWBlockSize - 1) / kFusedEWBlockSize;
+    ParallelFor(num_blocks, kDefaultGrainSize / kFusedEWBlockSize,
+                [&](int64_t block_start, int64_t block_end) {
+                    std::vector<scalar_t> scratch;
+                    std::vector<const scalar_t*> registers(
+                            engine.NumRegisters());
+                    engine.InitScratch(scratch);
+                    for (int64_t block = block_start; block < block_end;
+                         ++block) {
+                        const int64_t start = block * kFusedEWBlockSize;
+                        const int64_t n = std::min(kFusedEWBlockSize,
+                                                   num_elements - start);
+                        engine.EvalBlock(start, n, scratch.data(), registers,
+                                         dst + start);
+                    }
+                });
+}
+
+template <typename scalar_t, typename func_t>
+static void LaunchFusedEWReduction(const CPUFusedEWEngine<scalar_t>& engine,
+                                   int64_t num_elements,
+                                   scalar_t identity,
+                                   func_t reduce_func,
+                                   scalar_t* dst) {
+    // Partial results per chunk of blocks as in LaunchReductionKernelTwoPass.
+    const int64_t blocks_per_chunk = kDefaultGrainSize / kFusedEWBlockSize;
+    const int64_t num_blocks =
+            (num_elements + kFusedEWBlockSize - 1) / kFusedEWBlockSize;
+    const int64_t num_chunks =
+            (num_blocks + blocks_per_chunk - 1) / blocks_per_chunk;
+    std::vector<scalar_t> chunk_results(num_chunks, identity);
+
+    ParallelFor(num_chunks, 1, [&](int64_t chunk_start, int64_t chunk_end) {
+        std::vector<scalar_t> scratch;
+        std::vector<const scalar_t*> registers(engine.NumRegisters());
+        engine.InitScratch(scratch);
+
+        for (int64_t chunk = chunk_start; chunk < chunk_end; ++chunk) {
+            scalar_t acc = identity;
+            const int64_t block_end =
+                    std::min(num_blocks, (chunk + 1) * blocks_per_chunk);
+            for (int64_t block = chunk * blocks_per_chunk; block < block_end;
+                 ++block) {
+                const int64_t start = block * kFusedEWBlockSize;
+                const int64_t n =
+                        std::min(kFusedEWBlockSize, num_elements - start);
+                const scalar_t* result = engine.EvalBlock(
+                        start, n, scratch.data(), registers, nullptr);
+                for (int64_t k = 0; k < n; ++k) {
+                    acc = reduce_func(acc, result[k]);
+                }
+            }
+            chunk_results[chunk] = acc;
+        }
+    });
+
+    scalar_t result = identity;
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        result = reduce_func(result, chunk_results[chunk]);
+    }
+    *dst = result;
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst) {
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        CPUFusedEWEngine<scalar_t> engine(inputs, program);
+        LaunchFusedEW<scalar_t>(engine, dst.NumElements(),
+                                static_cast<scalar_t*>(dst.GetDataPtr()));
+    });
+}
+
+void FusedEWReductionCPU(const std::vector<Tensor>& inputs,
+                         const std::vector<FusedEWInstruction>& program,
+                         Tensor& dst,
+                         ReductionOpCode op_code) {
+    const int64_t num_elements =
+            inputs.empty() ? 1 : inputs[0].NumElements();
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        CPUFusedEWEngine<scalar_t> engine(inputs, program);
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                LaunchFusedEWReduction<scalar_t>(
+                        engine, num_elements, scalar_t(0),
+                        [](scalar_t a, scalar_t b) { return a + b; }, dst_ptr);
+                break;
+            case ReductionOpCode::Prod:
+                LaunchFusedEWReduction<scalar_t>(
+                        engine, num_elements, scalar_t(1),
+                        [](scalar_t a, scalar_t b) { return a * b; }, dst_ptr);
+                break;
+            case ReductionOpCode::Min:
+                if (num_elements == 0) {
+                    utility::LogError("Zero-size Tensor does not suport Min.");
+                }
+                LaunchFusedEWReduction<scalar_t>(
+                        engine, num_elements,
+                        std::numeric_limits<scalar_t>::max(),
+                        [](scalar_t a, scalar_t b) { return std::min(a, b); },
+                        dst_ptr);
+                break;
+            case ReductionOpCode::Max:
+                if (num_elements == 0) {
+                    utility::LogError("Zero-size Tensor does not suport Max.");
+                }
+                LaunchFusedEWReduction<scalar_t>(
+                        engine, num_elements,
+                        std::numeric_limits<scalar_t>::lowest(),
+                        [](scalar_t a, scalar_t b) { return std::max(a, b); },
+                        dst_ptr);
+                break;
+            default:
+                utility::LogError("Unsupported op code.");
+                break;
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,174 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/ParallelFor.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+// Kernels take a snapshot of the scheduler under the mutex, so the scheduler
+// may be changed while other threads are running kernels.
+struct ParallelForScheduler {
+    std::shared_ptr<const ParallelForFunction> external_parallel_for_;
+    int external_num_threads_ = 0;
+    std::shared_ptr<tbb::task_arena> arena_;
+};
+
+// Set while the calling thread runs a range of ParallelFor, so that nested
+// calls from TBB tasks or external pool threads are detected.
+thread_local bool in_parallel_for = false;
+
+class ParallelForRegionGuard {
+public:
+    ParallelForRegionGuard() : prev_(in_parallel_for) {
+        in_parallel_for = true;
+    }
+    ~ParallelForRegionGuard() { in_parallel_for = prev_; }
+
+private:
+    bool prev_;
+};
+
+std::mutex& SchedulerMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+ParallelForScheduler& Scheduler() {
+    static ParallelForScheduler scheduler;
+    return scheduler;
+}
+
+ParallelForScheduler GetScheduler() {
+    std::lock_guard<std::mutex> lock(SchedulerMutex());
+    return Scheduler();
+}
+
+}  // namespace
+
+void SetParallelForFunction(const ParallelForFunction& parallel_for,
+                            int num_threads) {
+    std::lock_guard<std::mutex> lock(SchedulerMutex());
+    ParallelForScheduler& scheduler = Scheduler();
+    if (parallel_for) {
+        if (num_threads < 1) {
+            utility::LogError("num_threads must be positive, but got {}.",
+                              num_threads);
+        }
+        scheduler.external_parallel_for_ =
+                std::make_shared<const ParallelForFunction>(parallel_for);
+        scheduler.external_num_threads_ = num_threads;
+    } else {
+        scheduler.external_parallel_for_ = nullptr;
+        scheduler.external_num_threads_ = 0;
+    }
+}
+
+void SetParallelForNumThreads(int num_threads) {
+    if (num_threads < 0) {
+        utility::LogError("num_threads must be non-negative, but got {}.",
+                          num_threads);
+    }
+    std::lock_guard<std::mutex> lock(SchedulerMutex());
+    if (num_threads == 0) {
+        Scheduler().arena_ = nullptr;
+    } else {
+        Scheduler().arena_ = std::make_shared<tbb::task_arena>(num_threads);
+    }
+}
+
+int GetParallelForNumThreads() {
+    ParallelForScheduler scheduler = GetScheduler();
+    if (scheduler.external_parallel_for_) {
+        return scheduler.external_num_threads_;
+    } else if (scheduler.arena_) {
+        return scheduler.arena_->max_concurrency();
+    } else {
+        return tbb::this_task_arena::max_concurrency();
+    }
+}
+
+bool InParallelRegion() {
+    return in_parallel_for || InParallel();
+}
+
+namespace detail {
+
+void ParallelForRange(int64_t num_workloads,
+                      int64_t grain_size,
+                      const std::function<void(int64_t, int64_t)>& range_func) {
+    auto guarded_range_func = [&](int64_t start, int64_t end) {
+        ParallelForRegionGuard guard;
+        range_func(start, end);
+    };
+
+    ParallelForScheduler scheduler = GetScheduler();
+    if (scheduler.external_parallel_for_) {
+        (*scheduler.external_parallel_for_)(num_workloads, grain_size,
+                                            guarded_range_func);
+        return;
+    }
+
+    // tbb::blocked_range may split below its grain size, so TBB partitions
+    // whole chunks of at least grain_size workloads instead.
+    const int64_t num_chunks = num_workloads / grain_size;
+    const int64_t chunk_size = num_workloads / num_chunks;
+    const int64_t num_larger_chunks = num_workloads % num_chunks;
+    auto chunk_begin = [&](int64_t chunk_idx) {
+        return chunk_idx * chunk_size + std::min(chunk_idx, num_larger_chunks);
+    };
+    auto run = [&]() {
+        tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_chunks),
+                          [&](const tbb::blocked_range<int64_t>& range) {
+                              guarded_range_func(chunk_begin(range.begin()),
+                                                 chunk_begin(range.end()));
+                          });
+    };
+    if (scheduler.arena_) {
+        scheduler.arena_->execute(run);
+    } else {
+        run();
+    }
+}
+
+}  // namespace detail
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+#include "open3d/core/kernel/ParallelUtil.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Default minimum number of workloads per task for cheap element-wise
+/// kernels. Smaller workloads are run serially on the calling thread.
+static constexpr int64_t kDefaultGrainSize = 32768;
+
+/// A parallel-for provided by an external thread pool. It must call
+/// range_func(start, end) on disjoint ranges that cover [0, num_workloads),
+/// each of at least grain_size workloads except for the last one, and return
+/// once all calls finished.
+using ParallelForFunction = std::function<void(
+        int64_t num_workloads,
+        int64_t grain_size,
+        const std::function<void(int64_t, int64_t)>& range_func)>;
+
+/// Runs all CPU kernels on an external thread pool instead of the TBB
+/// scheduler, e.g. to avoid oversubscription when Open3D is called from the
+/// application's own workers. Pass nullptr to restore the default scheduler.
+///
+/// \param parallel_for The external parallel-for.
+/// \param num_threads Number of threads of the external pool. This is used to
+/// choose how to partition the work.
+void SetParallelForFunction(const ParallelForFunction& parallel_for,
+                            int num_threads);
+
+/// Limits the number of threads used by the default scheduler. 0 restores the
+/// default, i.e. all hardware threads.
+void SetParallelForNumThreads(int num_threads);
+
+/// Returns the number of threads CPU kernels run on.
+int GetParallelForNumThreads();
+
+/// Returns true if called from inside an OpenMP parallel region or from inside
+/// a range of ParallelFor, on any scheduler.
+bool InParallelRegion();
+
+namespace detail {
+
+void ParallelForRange(int64_t num_workloads,
+                      int64_t grain_size,
+                      const std::function<void(int64_t, int64_t)>& range_func);
+
+}  // namespace detail
+
+/// Calls range_func(start, end) on disjoint ranges covering
+/// [0, num_workloads), in parallel. With the default scheduler, every range
+/// contains at least \p grain_size workloads. Workloads no larger than
+/// \p grain_size and calls from inside a parallel region (see
+/// InParallelRegion()) run serially on the calling thread.
+template <typename func_t>
+void ParallelFor(int64_t num_workloads,
+                 int64_t grain_size,
+                 const func_t& range_func) {
+    if (num_workloads <= 0) {
+        return;
+    }
+    grain_size = std::max(grain_size, int64_t(1));
+    if (num_workloads <= grain_size || InParallelRegion()) {
+        range_func(int64_t(0), num_workloads);
+        return;
+    }
+    detail::ParallelForRange(num_workloads, grain_size, range_func);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -29,7 +29,8 @@
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/Tensor.h"
-#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/kernel/CPUVectorization.h"
+#include "open3d/core/kernel/ParallelFor.h"
 #include "open3d/core/kernel/Reduction.h"
 #include "open3d/utility/Console.h"
 
@@ -85,6 +86,191 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+template <typename scalar_t>
+static inline scalar_t CPUVectorizedSum(const scalar_t* src, int64_t n) {
+    scalar_t acc = 0;
+    OPEN3D_SIMD_REDUCTION_LOOP(+, acc)
+    for (int64_t i = 0; i < n; ++i) {
+        acc += src[i];
+    }
+    return acc;
+}
+
+template <typename scalar_t>
+static inline scalar_t CPUVectorizedProd(const scalar_t* src, int64_t n) {
+    scalar_t acc = 1;
+    OPEN3D_SIMD_REDUCTION_LOOP(*, acc)
+    for (int64_t i = 0; i < n; ++i) {
+        acc *= src[i];
+    }
+    return acc;
+}
+
+template <typename scalar_t>
+static inline scalar_t CPUVectorizedMin(const scalar_t* src, int64_t n) {
+    scalar_t acc = std::numeric_limits<scalar_t>::max();
+    OPEN3D_SIMD_REDUCTION_LOOP(min, acc)
+    for (int64_t i = 0; i < n; ++i) {
+        acc = src[i] < acc ? src[i] : acc;
+    }
+    return acc;
+}
+
+template <typename scalar_t>
+static inline scalar_t CPUVectorizedMax(const scalar_t* src, int64_t n) {
+    scalar_t acc = std::numeric_limits<scalar_t>::lowest();
+    OPEN3D_SIMD_REDUCTION_LOOP(max, acc)
+    for (int64_t i = 0; i < n; ++i) {
+        acc = src[i] > acc ? src[i] : acc;
+    }
+    return acc;
+}
+
+/// Returns true if reducing \p src over \p dims reduces contiguous runs of
+/// memory, i.e. all reduction dims are inner to all non-reduction dims
+/// (ignoring dims of size 1). On success, sets the number of outputs and the
+/// length of the run reduced into each output.
+static bool IsContiguousReduction(const Tensor& src,
+                                  const Tensor& dst,
+                                  const SizeVector& dims,
+                                  int64_t& num_outputs,
+                                  int64_t& num_inputs_per_output) {
+    if (!src.IsContiguous() || !dst.IsContiguous() ||
+        src.GetDtype() != dst.GetDtype() || src.NumElements() == 0) {
+        return false;
+    }
+    const SizeVector& shape = src.GetShape();
+    int64_t num_dims = src.NumDims();
+    std::vector<bool> is_reduction_dim(num_dims, false);
+    for (int64_t dim : dims) {
+        if (dim < 0 || dim >= num_dims) {
+            return false;
+        }
+        is_reduction_dim[dim] = true;
+    }
+    num_inputs_per_output = 1;
+    bool seen_non_reduction_dim = false;
+    for (int64_t dim = num_dims - 1; dim >= 0; --dim) {
+        if (shape[dim] == 1) {
+            continue;
+        }
+        if (!is_reduction_dim[dim]) {
+            seen_non_reduction_dim = true;
+        } else if (seen_non_reduction_dim) {
+            return false;
+        } else {
+            num_inputs_per_output *= shape[dim];
+        }
+    }
+    num_outputs = src.NumElements() / num_inputs_per_output;
+    return dst.NumElements() == num_outputs;
+}
+
+/// Reduces each contiguous run of \p num_inputs_per_output elements of \p src
+/// into one element of \p dst. Runs longer than two grains are split into
+/// chunks of kDefaultGrainSize elements whose partial results are combined
+/// afterwards.
+/// \param range_reduce_func Vectorized reduction of (const scalar_t*, n).
+/// \param element_kernel Combines two partial results.
+template <typename scalar_t, typename range_func_t, typename func_t>
+static void LaunchContiguousReductionKernel(const Tensor& src,
+                                            Tensor& dst,
+                                            int64_t num_outputs,
+                                            int64_t num_inputs_per_output,
+                                            range_func_t range_reduce_func,
+                                            func_t element_kernel) {
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+
+    if (num_inputs_per_output < 2 * kDefaultGrainSize) {
+        ParallelFor(num_outputs, kDefaultGrainSize / num_inputs_per_output,
+                    [&](int64_t start, int64_t end) {
+                        LaunchVectorized([&]() {
+                            for (int64_t output_idx = start; output_idx < end;
+                                 ++output_idx) {
+                                dst_ptr[output_idx] = range_reduce_func(
+                                        src_ptr + output_idx *
+                                                          num_inputs_per_output,
+                                        num_inputs_per_output);
+                            }
+                        });
+                    });
+        return;
+    }
+
+    int64_t num_chunks = (num_inputs_per_output + kDefaultGrainSize - 1) /
+                         kDefaultGrainSize;
+    std::vector<scalar_t> chunk_results(num_outputs * num_chunks);
+    ParallelFor(num_outputs * num_chunks, 1, [&](int64_t start, int64_t end) {
+        LaunchVectorized([&]() {
+            for (int64_t task_idx = start; task_idx < end; ++task_idx) {
+                int64_t output_idx = task_idx / num_chunks;
+                int64_t chunk_start =
+                        (task_idx % num_chunks) * kDefaultGrainSize;
+                int64_t chunk_end = std::min(chunk_start + kDefaultGrainSize,
+                                             num_inputs_per_output);
+                chunk_results[task_idx] = range_reduce_func(
+                        src_ptr + output_idx * num_inputs_per_output +
+                                chunk_start,
+                        chunk_end - chunk_start);
+            }
+        });
+    });
+    for (int64_t output_idx = 0; output_idx < num_outputs; ++output_idx) {
+        scalar_t result = chunk_results[output_idx * num_chunks];
+        for (int64_t chunk_idx = 1; chunk_idx < num_chunks; ++chunk_idx) {
+            result = element_kernel(
+                    chunk_results[output_idx * num_chunks + chunk_idx], result);
+        }
+        dst_ptr[output_idx] = result;
+    }
+}
+
+template <typename scalar_t>
+static void LaunchContiguousReductionOp(const Tensor& src,
+                                        Tensor& dst,
+                                        int64_t num_outputs,
+                                        int64_t num_inputs_per_output,
+                                        ReductionOpCode op_code) {
+    switch (op_code) {
+        case ReductionOpCode::Sum:
+            LaunchContiguousReductionKernel<scalar_t>(
+                    src, dst, num_outputs, num_inputs_per_output,
+                    [](const scalar_t* src, int64_t n) {
+                        return CPUVectorizedSum(src, n);
+                    },
+                    CPUSumReductionKernel<scalar_t>);
+            break;
+        case ReductionOpCode::Prod:
+            LaunchContiguousReductionKernel<scalar_t>(
+                    src, dst, num_outputs, num_inputs_per_output,
+                    [](const scalar_t* src, int64_t n) {
+                        return CPUVectorizedProd(src, n);
+                    },
+                    CPUProdReductionKernel<scalar_t>);
+            break;
+        case ReductionOpCode::Min:
+            LaunchContiguousReductionKernel<scalar_t>(
+                    src, dst, num_outputs, num_inputs_per_output,
+                    [](const scalar_t* src, int64_t n) {
+                        return CPUVectorizedMin(src, n);
+                    },
+                    CPUMinReductionKernel<scalar_t>);
+            break;
+        case ReductionOpCode::Max:
+            LaunchContiguousReductionKernel<scalar_t>(
+                    src, dst, num_outputs, num_inputs_per_output,
+                    [](const scalar_t* src, int64_t n) {
+                        return CPUVectorizedMax(src, n);
+                    },
+                    CPUMaxReductionKernel<scalar_t>);
+            break;
+        default:
+            utility::LogError("Unsupported op code.");
+            break;
+    }
+}
+
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
@@ -95,7 +281,8 @@ public:
     void Run(const func_t& reduce_func, scalar_t identity) {
         // See: PyTorch's TensorIterator::parallel_reduce for the reference
         // design of reduction strategy.
-        if (GetMaxThreads() == 1 || InParallel()) {
+        if (GetParallelForNumThreads() == 1 || InParallelRegion() ||
+            indexer_.NumWorkloads() <= kDefaultGrainSize) {
             LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
         } else if (indexer_.NumOutputElements() <= 1) {
             LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
@@ -119,8 +306,10 @@ private:
         }
     }
 
-    /// Create num_threads workers to compute partial reductions and then reduce
-    /// to the final results. This only applies to reduction op with one output.
+    /// Computes partial reductions of chunks of kDefaultGrainSize workloads
+    /// and then reduces them to the final result. The chunking does not
+    /// depend on the number of threads, so results are reproducible. This only
+    /// applies to reduction op with one output.
     template <typename scalar_t, typename func_t>
     static void LaunchReductionKernelTwoPass(const Indexer& indexer,
                                              func_t element_kernel,
@@ -131,26 +320,29 @@ private:
                     "single-output reduction ops.");
         }
         int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = GetMaxThreads();
-        int64_t workload_per_thread =
-                (num_workloads + num_threads - 1) / num_threads;
-        std::vector<scalar_t> thread_results(num_threads, identity);
-
-#pragma omp parallel for schedule(static)
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
+        int64_t num_chunks =
+                (num_workloads + kDefaultGrainSize - 1) / kDefaultGrainSize;
+        std::vector<scalar_t> chunk_results(num_chunks, identity);
+
+        ParallelFor(num_chunks, 1, [&](int64_t chunk_start, int64_t chunk_end) {
+            for (int64_t chunk_idx = chunk_start; chunk_idx < chunk_end;
+                 ++chunk_idx) {
+                int64_t start = chunk_idx * kDefaultGrainSize;
+                int64_t end =
+                        std::min(start + kDefaultGrainSize, num_workloads);
+                scalar_t result = identity;
+                for (int64_t workload_idx = start; workload_idx < end;
+                     ++workload_idx) {
+                    scalar_t* src = reinterpret_cast<scalar_t*>(
+                            indexer.GetInputPtr(0, workload_idx));
+                    result = element_kernel(*src, result);
+                }
+                chunk_results[chunk_idx] = result;
             }
-        }
+        });
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            *dst = element_kernel(thread_results[thread_idx], *dst);
+        for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            *dst = element_kernel(chunk_results[chunk_idx], *dst);
         }
     }
 
@@ -160,7 +352,7 @@ private:
         // Prefers outer dimension >= num_threads.
         const int64_t* indexer_shape = indexer.GetMasterShape();
         const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = GetMaxThreads();
+        int64_t num_threads = GetParallelForNumThreads();
 
         // Init best_dim as the outer-most non-reduction dim.
         int64_t best_dim = num_dims - 1;
@@ -182,12 +374,20 @@ private:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        int64_t workloads_per_slice =
+                indexer.NumWorkloads() / std::max(indexer_shape[best_dim],
+                                                  int64_t(1));
+        int64_t grain_size =
+                kDefaultGrainSize / std::max(workloads_per_slice, int64_t(1));
+        ParallelFor(indexer_shape[best_dim], grain_size,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t i = start; i < end; ++i) {
+                            Indexer sub_indexer(indexer);
+                            sub_indexer.ShrinkDim(best_dim, i, 1);
+                            LaunchReductionKernelSerial<scalar_t>(
+                                    sub_indexer, element_kernel);
+                        }
+                    });
     }
 
 private:
@@ -207,25 +407,32 @@ public:
         // elements. We need to keep track of the indices within each
         // sub-iteration.
         int64_t num_output_elements = indexer_.NumOutputElements();
+        int64_t workloads_per_output =
+                indexer_.NumWorkloads() /
+                std::max(num_output_elements, int64_t(1));
+        int64_t grain_size =
+                kDefaultGrainSize / std::max(workloads_per_output, int64_t(1));
 
-#pragma omp parallel for schedule(static)
-        for (int64_t output_idx = 0; output_idx < num_output_elements;
-             output_idx++) {
-            // sub_indexer.NumWorkloads() == ipo.
-            // sub_indexer's workload_idx is indexer_'s ipo_idx.
-            Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
-            scalar_t dst_val = identity;
-            for (int64_t workload_idx = 0;
-                 workload_idx < sub_indexer.NumWorkloads(); workload_idx++) {
-                int64_t src_idx = workload_idx;
-                scalar_t* src_val = reinterpret_cast<scalar_t*>(
-                        sub_indexer.GetInputPtr(0, workload_idx));
-                int64_t* dst_idx = reinterpret_cast<int64_t*>(
-                        sub_indexer.GetOutputPtr(0, workload_idx));
-                std::tie(*dst_idx, dst_val) =
-                        reduce_func(src_idx, *src_val, *dst_idx, dst_val);
+        ParallelFor(num_output_elements, grain_size, [&](int64_t start,
+                                                         int64_t end) {
+            for (int64_t output_idx = start; output_idx < end; output_idx++) {
+                // sub_indexer.NumWorkloads() == ipo.
+                // sub_indexer's workload_idx is indexer_'s ipo_idx.
+                Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
+                scalar_t dst_val = identity;
+                for (int64_t workload_idx = 0;
+                     workload_idx < sub_indexer.NumWorkloads();
+                     workload_idx++) {
+                    int64_t src_idx = workload_idx;
+                    scalar_t* src_val = reinterpret_cast<scalar_t*>(
+                            sub_indexer.GetInputPtr(0, workload_idx));
+                    int64_t* dst_idx = reinterpret_cast<int64_t*>(
+                            sub_indexer.GetOutputPtr(0, workload_idx));
+                    std::tie(*dst_idx, dst_val) =
+                            reduce_func(src_idx, *src_val, *dst_idx, dst_val);
+                }
             }
-        }
+        });
     }
 
 private:
@@ -237,7 +444,17 @@ void ReductionCPU(const Tensor& src,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code) {
-    if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
+    int64_t num_outputs = 0;
+    int64_t num_inputs_per_output = 0;
+    if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end() &&
+        IsContiguousReduction(src, dst, dims, num_outputs,
+                              num_inputs_per_output)) {
+        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+            LaunchContiguousReductionOp<scalar_t>(
+                    src, dst, num_outputs, num_inputs_per_output, op_code);
+        });
+    } else if (s_regular_reduce_ops.find(op_code) !=
+               s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
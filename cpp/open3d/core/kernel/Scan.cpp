@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Scan.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// There are no CUDA kernels for scans yet. CUDA tensors are processed on the
+// CPU and the results are copied back.
+
+Tensor CumSum(const Tensor& src, int64_t dim) {
+    if (src.NumDims() == 0) {
+        utility::LogError("CumSum does not support 0-dim tensors.");
+    }
+    dim = shape_util::WrapDim(dim, src.NumDims());
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return CumSumCPU(src, dim);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        return CumSumCPU(src.To(Device("CPU:0")), dim).To(src.GetDevice());
+    } else {
+        utility::LogError("CumSum: Unimplemented device");
+    }
+}
+
+Tensor SegmentReduce(const Tensor& src,
+                     const Tensor& segment_ids,
+                     int64_t num_segments,
+                     SegmentReduceOpCode op_code) {
+    if (src.NumDims() == 0) {
+        utility::LogError("Segment reduction does not support 0-dim tensors.");
+    }
+    if (segment_ids.GetDtype() != Dtype::Int64) {
+        utility::LogError("segment_ids must be Int64, but got {}.",
+                          segment_ids.GetDtype().ToString());
+    }
+    if (segment_ids.GetShape() != SizeVector{src.GetLength()}) {
+        utility::LogError(
+                "segment_ids must have shape {{{}}}, but got {}.",
+                src.GetLength(), segment_ids.GetShape().ToString());
+    }
+    if (segment_ids.GetDevice() != src.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          segment_ids.GetDevice().ToString(),
+                          src.GetDevice().ToString());
+    }
+    if (num_segments < 0) {
+        utility::LogError("num_segments must be non-negative, but got {}.",
+                          num_segments);
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return SegmentReduceCPU(src, segment_ids, num_segments, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        Device host("CPU:0");
+        return SegmentReduceCPU(src.To(host), segment_ids.To(host),
+                                num_segments, op_code)
+                .To(src.GetDevice());
+    } else {
+        utility::LogError("SegmentReduce: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelFor.h"
+#include "open3d/core/kernel/Scan.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Prefix sum of a contiguous tensor viewed as {outer, len, inner}, along the
+/// len dimension.
+template <typename scalar_t>
+static void CumSumContiguous(const scalar_t* src,
+                             scalar_t* dst,
+                             int64_t outer,
+                             int64_t len,
+                             int64_t inner) {
+    if (inner == 1 && len >= 2 * kDefaultGrainSize) {
+        // Few long lines: scan each line in parallel.
+        for (int64_t o = 0; o < outer; ++o) {
+            utility::InclusivePrefixSum(src + o * len, src + (o + 1) * len,
+                                        dst + o * len);
+        }
+        return;
+    }
+
+    // Many lines: each task scans a block of adjacent lines, which is
+    // vectorized across the lines when inner > 1.
+    static constexpr int64_t kLineBlock = 256;
+    const int64_t num_line_blocks = (inner + kLineBlock - 1) / kLineBlock;
+    const int64_t task_size = len * std::min(inner, kLineBlock);
+    ParallelFor(outer * num_line_blocks,
+                kDefaultGrainSize / std::max(task_size, int64_t(1)),
+                [&](int64_t start, int64_t end) {
+                    for (int64_t task = start; task < end; ++task) {
+                        const int64_t o = task / num_line_blocks;
+                        const int64_t c0 =
+                                (task % num_line_blocks) * kLineBlock;
+                        const int64_t c1 = std::min(c0 + kLineBlock, inner);
+                        const scalar_t* src_o = src + o * len * inner;
+                        scalar_t* dst_o = dst + o * len * inner;
+                        for (int64_t c = c0; c < c1; ++c) {
+                            dst_o[c] = src_o[c];
+                        }
+                        for (int64_t l = 1; l < len; ++l) {
+                            const int64_t row = l * inner;
+                            for (int64_t c = c0; c < c1; ++c) {
+                                dst_o[row + c] =
+                                        dst_o[row - inner + c] + src_o[row + c];
+                            }
+                        }
+                    }
+                });
+}
+
+Tensor CumSumCPU(const Tensor& src, int64_t dim) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor dst(src.GetShape(), src.GetDtype(), src.GetDevice());
+    const SizeVector& shape = src.GetShape();
+    int64_t outer = 1;
+    int64_t inner = 1;
+    for (int64_t i = 0; i < dim; ++i) {
+        outer *= shape[i];
+    }
+    for (int64_t i = dim + 1; i < src.NumDims(); ++i) {
+        inner *= shape[i];
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        CumSumContiguous(
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr()),
+                static_cast<scalar_t*>(dst.GetDataPtr()), outer, shape[dim],
+                inner);
+    });
+    return dst;
+}
+
+template <typename scalar_t>
+static void SegmentReduceContiguous(const scalar_t* src,
+                                    const std::vector<int64_t>& offsets,
+                                    int64_t num_segments,
+                                    int64_t row_size,
+                                    SegmentReduceOpCode op_code,
+                                    scalar_t* dst) {
+    const int64_t num_rows = offsets.back();
+    const int64_t rows_per_segment =
+            num_rows / std::max(num_segments, int64_t(1));
+    ParallelFor(num_segments,
+                kDefaultGrainSize /
+                        std::max(rows_per_segment * row_size, int64_t(1)),
+                [&](int64_t start, int64_t end) {
+                    for (int64_t s = start; s < end; ++s) {
+                        const int64_t row_start = offsets[s];
+                        const int64_t row_end = offsets[s + 1];
+                        if (row_start == row_end) {
+                            continue;
+                        }
+                        scalar_t* dst_row = dst + s * row_size;
+                        const scalar_t* src_row = src + row_start * row_size;
+                        std::copy(src_row, src_row + row_size, dst_row);
+                        for (int64_t r = row_start + 1; r < row_end; ++r) {
+                            src_row = src + r * row_size;
+                            if (op_code == SegmentReduceOpCode::Max) {
+                                for (int64_t c = 0; c < row_size; ++c) {
+                                    dst_row[c] = std::max(dst_row[c],
+                                                          src_row[c]);
+                                }
+                            } else {
+                                for (int64_t c = 0; c < row_size; ++c) {
+                                    dst_row[c] += src_row[c];
+                                }
+                            }
+                        }
+                        if (op_code == SegmentReduceOpCode::Mean) {
+                            const scalar_t count =
+                                    static_cast<scalar_t>(row_end - row_start);
+                            for (int64_t c = 0; c < row_size; ++c) {
+                                dst_row[c] /= count;
+                            }
+                        }
+                    }
+                });
+}
+
+Tensor SegmentReduceCPU(const Tensor& src,
+                        const Tensor& segment_ids,
+                        int64_t num_segments,
+                        SegmentReduceOpCode op_code) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor ids_contiguous = segment_ids.Contiguous();
+    const int64_t num_rows = src.GetLength();
+    const int64_t* ids =
+            static_cast<const int64_t*>(ids_contiguous.GetDataPtr());
+
+    std::atomic<bool> is_valid(true);
+    ParallelFor(num_rows, kDefaultGrainSize, [&](int64_t start, int64_t end) {
+        for (int64_t i = start; i < end; ++i) {
+            if (ids[i] < 0 || ids[i] >= num_segments ||
+                (i > 0 && ids[i] < ids[i - 1])) {
+                is_valid = false;
+                return;
+            }
+        }
+    });
+    if (!is_valid) {
+        utility::LogError(
+                "segment_ids must be sorted and within [0, {}).",
+                num_segments);
+    }
+
+    // offsets[s] is the first row of segment s.
+    std::vector<int64_t> offsets(num_segments + 1);
+    ParallelFor(num_segments + 1, 1024, [&](int64_t start, int64_t end) {
+        for (int64_t s = start; s < end; ++s) {
+            offsets[s] = std::lower_bound(ids, ids + num_rows, s) - ids;
+        }
+    });
+
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_segments;
+    Tensor dst = Tensor::Zeros(dst_shape, src.GetDtype(), src.GetDevice());
+    const int64_t row_size = dst_shape.NumElements() /
+                             std::max(num_segments, int64_t(1));
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        SegmentReduceContiguous(
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr()),
+                offsets, num_segments, row_size, op_code,
+                static_cast<scalar_t*>(dst.GetDataPtr()));
+    });
+    return dst;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
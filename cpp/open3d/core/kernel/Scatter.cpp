@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Scatter.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// There are no CUDA kernels for gather and scatter yet. CUDA tensors are
+// processed on the CPU and the results are copied back.
+
+static void CheckIndices(const Tensor& indices, const Device& device) {
+    if (indices.GetDtype() != Dtype::Int64) {
+        utility::LogError("Indices must be Int64, but got {}.",
+                          indices.GetDtype().ToString());
+    }
+    if (indices.NumDims() != 1) {
+        utility::LogError("Indices must be 1-D, but got shape {}.",
+                          indices.GetShape().ToString());
+    }
+    if (indices.GetDevice() != device) {
+        utility::LogError("Device mismatch {} != {}.",
+                          indices.GetDevice().ToString(), device.ToString());
+    }
+}
+
+Tensor Gather(const Tensor& src, const Tensor& indices) {
+    if (src.NumDims() == 0) {
+        utility::LogError("Gather does not support 0-dim tensors.");
+    }
+    CheckIndices(indices, src.GetDevice());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return GatherCPU(src, indices);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        Device host("CPU:0");
+        return GatherCPU(src.To(host), indices.To(host)).To(src.GetDevice());
+    } else {
+        utility::LogError("Gather: Unimplemented device");
+    }
+}
+
+void Scatter(const Tensor& src,
+             const Tensor& indices,
+             Tensor& dst,
+             ScatterOpCode op_code) {
+    if (src.NumDims() == 0 || dst.NumDims() == 0) {
+        utility::LogError("Scatter does not support 0-dim tensors.");
+    }
+    CheckIndices(indices, src.GetDevice());
+    if (indices.GetLength() != src.GetLength()) {
+        utility::LogError("Expected {} indices, but got {}.", src.GetLength(),
+                          indices.GetLength());
+    }
+    if (src.GetDtype() != dst.GetDtype()) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          src.GetDtype().ToString(),
+                          dst.GetDtype().ToString());
+    }
+    if (src.GetDtype() == Dtype::Bool) {
+        utility::LogError("Scatter does not support Bool tensors.");
+    }
+    if (src.GetDevice() != dst.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          src.GetDevice().ToString(),
+                          dst.GetDevice().ToString());
+    }
+    const SizeVector src_shape = src.GetShape();
+    const SizeVector dst_shape = dst.GetShape();
+    SizeVector src_row_shape(src_shape.begin() + 1, src_shape.end());
+    SizeVector dst_row_shape(dst_shape.begin() + 1, dst_shape.end());
+    if (src_row_shape != dst_row_shape) {
+        utility::LogError(
+                "Cannot scatter rows of shape {} to rows of shape {}.",
+                src_row_shape.ToString(), dst_row_shape.ToString());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ScatterCPU(src, indices, dst, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        Device host("CPU:0");
+        Tensor dst_host = dst.To(host);
+        ScatterCPU(src.To(host), indices.To(host), dst_host, op_code);
+        dst.AsRvalue() = dst_host;
+    } else {
+        utility::LogError("Scatter: Unimplemented device");
+    }
+}
+
+void MaskedFill(Tensor& dst, const Tensor& mask, const Tensor& value) {
+    if (mask.GetDtype() != Dtype::Bool) {
+        utility::LogError("Mask must be Bool, but got {}.",
+                          mask.GetDtype().ToString());
+    }
+    if (value.NumElements() != 1) {
+        utility::LogError("Fill value must have one element, but got {}.",
+                          value.NumElements());
+    }
+    if (mask.GetDevice() != dst.GetDevice()) {
+        utility::LogError("Device mismatch {} != {}.",
+                          mask.GetDevice().ToString(),
+                          dst.GetDevice().ToString());
+    }
+    Tensor value_host =
+            value.To(Device("CPU:0")).To(dst.GetDtype()).Reshape({});
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        MaskedFillCPU(dst, mask, value_host);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        Device host("CPU:0");
+        Tensor dst_host = dst.To(host);
+        MaskedFillCPU(dst_host, mask.To(host), value_host);
+        dst.AsRvalue() = dst_host;
+    } else {
+        utility::LogError("MaskedFill: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class ScatterOpCode { Add, Max };
+
+/// Gathers rows along dim 0, i.e. dst[i] = src[indices[i]].
+///
+/// \param src Tensor of shape {N, ...}.
+/// \param indices Int64 tensor of shape {M} with values in [0, N).
+/// \return Tensor of shape {M, ...}.
+Tensor Gather(const Tensor& src, const Tensor& indices);
+
+/// Scatters rows along dim 0 in-place, i.e. dst[indices[i]] op= src[i].
+/// Repeated indices are accumulated.
+///
+/// \param src Tensor of shape {N, ...}.
+/// \param indices Int64 tensor of shape {N} with values in [0, M).
+/// \param dst Tensor of shape {M, ...} with the dtype of \p src.
+void Scatter(const Tensor& src,
+             const Tensor& indices,
+             Tensor& dst,
+             ScatterOpCode op_code);
+
+/// Sets dst[mask] = value in-place, where \p mask is a boolean tensor
+/// broadcastable to dst and \p value is a single-element tensor.
+void MaskedFill(Tensor& dst, const Tensor& mask, const Tensor& value);
+
+Tensor GatherCPU(const Tensor& src, const Tensor& indices);
+
+void ScatterCPU(const Tensor& src,
+                const Tensor& indices,
+                Tensor& dst,
+                ScatterOpCode op_code);
+
+void MaskedFillCPU(Tensor& dst, const Tensor& mask, const Tensor& value);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/ParallelFor.h"
+#include "open3d/core/kernel/Scatter.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static void CheckIndicesInRange(const int64_t* indices,
+                                int64_t num_indices,
+                                int64_t num_rows) {
+    std::atomic<bool> is_valid(true);
+    ParallelFor(num_indices, kDefaultGrainSize,
+                [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        if (indices[i] < 0 || indices[i] >= num_rows) {
+                            is_valid = false;
+                            return;
+                        }
+                    }
+                });
+    if (!is_valid) {
+        utility::LogError("Indices out of range [0, {}).", num_rows);
+    }
+}
+
+Tensor GatherCPU(const Tensor& src, const Tensor& indices) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor indices_contiguous = indices.Contiguous();
+    const int64_t num_indices = indices.GetLength();
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices_contiguous.GetDataPtr());
+    CheckIndicesInRange(indices_ptr, num_indices, src.GetLength());
+
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_indices;
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    const int64_t row_bytes = src.GetLength() == 0
+                                      ? 0
+                                      : src.NumElements() / src.GetLength() *
+                                                src.GetDtype().ByteSize();
+    const char* src_ptr =
+            static_cast<const char*>(src_contiguous.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    ParallelFor(num_indices,
+                kDefaultGrainSize / std::max(row_bytes, int64_t(1)),
+                [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        std::memcpy(dst_ptr + i * row_bytes,
+                                    src_ptr + indices_ptr[i] * row_bytes,
+                                    row_bytes);
+                    }
+                });
+    return dst;
+}
+
+/// Scatters src rows into contiguous dst rows without atomics. If the
+/// destination is small compared to the source, each task accumulates into a
+/// private partial buffer and the buffers are merged at the end. Otherwise
+/// each task owns a range of destination rows and only applies the source
+/// rows that map into it.
+template <typename scalar_t, typename func_t>
+static void ScatterContiguous(const scalar_t* src,
+                              const int64_t* indices,
+                              int64_t num_src_rows,
+                              scalar_t* dst,
+                              int64_t num_dst_rows,
+                              int64_t row_size,
+                              scalar_t identity,
+                              func_t op) {
+    auto scatter_rows = [&](int64_t src_start, int64_t src_end,
+                            int64_t dst_start, int64_t dst_end,
+                            scalar_t* target) {
+        for (int64_t i = src_start; i < src_end; ++i) {
+            const int64_t r = indices[i];
+            if (r < dst_start || r >= dst_end) {
+                continue;
+            }
+            const scalar_t* src_row = src + i * row_size;
+            scalar_t* target_row = target + r * row_size;
+            for (int64_t c = 0; c < row_size; ++c) {
+                target_row[c] = op(target_row[c], src_row[c]);
+            }
+        }
+    };
+
+    const int64_t src_size = num_src_rows * row_size;
+    const int64_t dst_size = num_dst_rows * row_size;
+    const int64_t num_tasks = std::min(
+            int64_t(GetParallelForNumThreads()),
+            (src_size + kDefaultGrainSize - 1) / kDefaultGrainSize);
+    if (num_tasks <= 1 || InParallelRegion()) {
+        scatter_rows(0, num_src_rows, 0, num_dst_rows, dst);
+        return;
+    }
+
+    if ((num_tasks - 1) * dst_size <= src_size) {
+        // Task 0 writes to dst directly, the others to their partial buffers.
+        std::vector<scalar_t> partials((num_tasks - 1) * dst_size, identity);
+        ParallelFor(num_tasks, 1, [&](int64_t start, int64_t end) {
+            for (int64_t t = start; t < end; ++t) {
+                scalar_t* target =
+                        t == 0 ? dst : partials.data() + (t - 1) * dst_size;
+                scatter_rows(num_src_rows * t / num_tasks,
+                             num_src_rows * (t + 1) / num_tasks, 0,
+                             num_dst_rows, target);
+            }
+        });
+        ParallelFor(dst_size, kDefaultGrainSize / (num_tasks - 1),
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t t = 1; t < num_tasks; ++t) {
+                            const scalar_t* partial =
+                                    partials.data() + (t - 1) * dst_size;
+                            for (int64_t e = start; e < end; ++e) {
+                                dst[e] = op(dst[e], partial[e]);
+                            }
+                        }
+                    });
+    } else {
+        ParallelFor(num_tasks, 1, [&](int64_t start, int64_t end) {
+            for (int64_t t = start; t < end; ++t) {
+                scatter_rows(0, num_src_rows, num_dst_rows * t / num_tasks,
+                             num_dst_rows * (t + 1) / num_tasks, dst);
+            }
+        });
+    }
+}
+
+void ScatterCPU(const Tensor& src,
+                const Tensor& indices,
+                Tensor& dst,
+                ScatterOpCode op_code) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor indices_contiguous = indices.Contiguous();
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices_contiguous.GetDataPtr());
+    CheckIndicesInRange(indices_ptr, indices.GetLength(), dst.GetLength());
+
+    // Non-contiguous destinations are accumulated in a contiguous copy.
+    Tensor dst_contiguous = dst.Contiguous();
+    const int64_t num_dst_rows = dst.GetLength();
+    const int64_t row_size =
+            num_dst_rows == 0 ? 0 : dst.NumElements() / num_dst_rows;
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst_contiguous.GetDataPtr());
+        if (op_code == ScatterOpCode::Add) {
+            ScatterContiguous(src_ptr, indices_ptr, src.GetLength(), dst_ptr,
+                              num_dst_rows, row_size, scalar_t(0),
+                              [](scalar_t a, scalar_t b) { return a + b; });
+        } else if (op_code == ScatterOpCode::Max) {
+            ScatterContiguous(src_ptr, indices_ptr, src.GetLength(), dst_ptr,
+                              num_dst_rows, row_size,
+                              std::numeric_limits<scalar_t>::lowest(),
+                              [](scalar_t a, scalar_t b) {
+                                  return std::max(a, b);
+                              });
+        } else {
+            utility::LogError("Unsupported scatter op code.");
+        }
+    });
+    if (!dst.IsContiguous()) {
+        dst.AsRvalue() = dst_contiguous;
+    }
+}
+
+void MaskedFillCPU(Tensor& dst, const Tensor& mask, const Tensor& value) {
+    Indexer indexer({mask}, dst, DtypePolicy::NONE);
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst.GetDtype(), [&]() {
+        const scalar_t fill_value = value.Item<scalar_t>();
+        CPULauncher::LaunchUnaryEWKernel(
+                indexer, [&](const void* mask_ptr, void* dst_ptr) {
+                    if (*static_cast<const bool*>(mask_ptr)) {
+                        *static_cast<scalar_t*>(dst_ptr) = fill_value;
+                    }
+                });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,72 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// There are no CUDA kernels for sorting yet. CUDA tensors are sorted on the
+// CPU and the results are copied back.
+
+Tensor ArgSort(const Tensor& src) {
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return ArgSortCPU(src);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        return ArgSortCPU(src.To(Device("CPU:0"))).To(src.GetDevice());
+    } else {
+        utility::LogError("ArgSort: Unimplemented device");
+    }
+}
+
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src,
+                                          bool return_inverse,
+                                          bool return_counts) {
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return UniqueCPU(src, return_inverse, return_counts);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        Tensor unique, inverse, counts;
+        std::tie(unique, inverse, counts) = UniqueCPU(
+                src.To(Device("CPU:0")), return_inverse, return_counts);
+        return std::make_tuple(
+                unique.To(src.GetDevice()),
+                return_inverse ? inverse.To(src.GetDevice()) : inverse,
+                return_counts ? counts.To(src.GetDevice()) : counts);
+    } else {
+        utility::LogError("Unique: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
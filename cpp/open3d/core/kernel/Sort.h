@@ -0,0 +1,57 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Returns the Int64 indices that sort the flattened \p src in ascending
+/// order. The sort is stable.
+Tensor ArgSort(const Tensor& src);
+
+/// Returns the sorted unique values of the flattened \p src. If requested,
+/// also returns the Int64 index of each element of \p src into the unique
+/// values (with the shape of \p src) and the Int64 number of occurrences of
+/// each unique value. Results that are not requested are empty tensors.
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src,
+                                          bool return_inverse,
+                                          bool return_counts);
+
+Tensor ArgSortCPU(const Tensor& src);
+
+std::tuple<Tensor, Tensor, Tensor> UniqueCPU(const Tensor& src,
+                                             bool return_inverse,
+                                             bool return_counts);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,255 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelFor.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Maps values to unsigned integer keys with the same ordering, so that all
+/// dtypes can be radix sorted.
+template <typename scalar_t, typename Enable = void>
+struct CPURadixKey;
+
+template <typename scalar_t>
+struct CPURadixKey<scalar_t,
+                   typename std::enable_if<
+                           std::is_integral<scalar_t>::value &&
+                           std::is_unsigned<scalar_t>::value &&
+                           !std::is_same<scalar_t, bool>::value>::type> {
+    using key_t = scalar_t;
+    static key_t Encode(scalar_t value) { return value; }
+};
+
+template <typename scalar_t>
+struct CPURadixKey<scalar_t,
+                   typename std::enable_if<
+                           std::is_same<scalar_t, bool>::value>::type> {
+    using key_t = uint8_t;
+    static key_t Encode(scalar_t value) { return value ? 1 : 0; }
+};
+
+/// Signed integers: flipping the sign bit maps two's complement order to
+/// unsigned order.
+template <typename scalar_t>
+struct CPURadixKey<scalar_t,
+                   typename std::enable_if<
+                           std::is_integral<scalar_t>::value &&
+                           std::is_signed<scalar_t>::value>::type> {
+    using key_t = typename std::make_unsigned<scalar_t>::type;
+    static key_t Encode(scalar_t value) {
+        return static_cast<key_t>(value) ^
+               (key_t(1) << (sizeof(key_t) * 8 - 1));
+    }
+};
+
+/// IEEE floats: negative values have all bits flipped, positive values only
+/// the sign bit. -0.0 is mapped to +0.0. NaNs are sorted to the front or the
+/// back depending on their sign bit.
+template <typename scalar_t>
+struct CPURadixKey<scalar_t,
+                   typename std::enable_if<
+                           std::is_floating_point<scalar_t>::value>::type> {
+    using key_t = typename std::conditional<sizeof(scalar_t) == 4,
+                                            uint32_t,
+                                            uint64_t>::type;
+    static key_t Encode(scalar_t value) {
+        if (value == 0) {
+            value = 0;
+        }
+        key_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        const key_t sign_bit = key_t(1) << (sizeof(key_t) * 8 - 1);
+        return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+    }
+};
+
+/// Stable LSD radix sort of (key, index) pairs with 8-bit digits. Each pass
+/// counts digits per chunk in parallel, turns the counts into scatter offsets
+/// and scatters the chunks in parallel. Passes where all keys have the same
+/// digit are skipped, e.g. the high bytes of small integers.
+template <typename key_t>
+static void RadixSortPairs(std::vector<key_t>& keys,
+                           std::vector<int64_t>& indices) {
+    static constexpr int kRadixBits = 8;
+    static constexpr int64_t kRadix = int64_t(1) << kRadixBits;
+    const int64_t n = static_cast<int64_t>(keys.size());
+    const int64_t num_chunks = (n + kDefaultGrainSize - 1) / kDefaultGrainSize;
+
+    std::vector<key_t> keys_tmp(n);
+    std::vector<int64_t> indices_tmp(n);
+    std::vector<int64_t> offsets(num_chunks * kRadix);
+    for (int shift = 0; shift < static_cast<int>(sizeof(key_t) * 8);
+         shift += kRadixBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        ParallelFor(num_chunks, 1, [&](int64_t chunk_start, int64_t chunk_end) {
+            for (int64_t chunk = chunk_start; chunk < chunk_end; ++chunk) {
+                int64_t* counts = offsets.data() + chunk * kRadix;
+                int64_t end = std::min((chunk + 1) * kDefaultGrainSize, n);
+                for (int64_t i = chunk * kDefaultGrainSize; i < end; ++i) {
+                    counts[(keys[i] >> shift) & (kRadix - 1)]++;
+                }
+            }
+        });
+
+        // Exclusive scan in digit-major, chunk-minor order keeps the sort
+        // stable.
+        bool is_trivial_pass = false;
+        int64_t offset = 0;
+        for (int64_t digit = 0; digit < kRadix; ++digit) {
+            int64_t digit_count = 0;
+            for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+                int64_t count = offsets[chunk * kRadix + digit];
+                offsets[chunk * kRadix + digit] = offset;
+                offset += count;
+                digit_count += count;
+            }
+            if (digit_count == n) {
+                is_trivial_pass = true;
+                break;
+            }
+        }
+        if (is_trivial_pass) {
+            continue;
+        }
+
+        ParallelFor(num_chunks, 1, [&](int64_t chunk_start, int64_t chunk_end) {
+            for (int64_t chunk = chunk_start; chunk < chunk_end; ++chunk) {
+                int64_t* chunk_offsets = offsets.data() + chunk * kRadix;
+                int64_t end = std::min((chunk + 1) * kDefaultGrainSize, n);
+                for (int64_t i = chunk * kDefaultGrainSize; i < end; ++i) {
+                    int64_t dst =
+                            chunk_offsets[(keys[i] >> shift) & (kRadix - 1)]++;
+                    keys_tmp[dst] = keys[i];
+                    indices_tmp[dst] = indices[i];
+                }
+            }
+        });
+        keys.swap(keys_tmp);
+        indices.swap(indices_tmp);
+    }
+}
+
+/// Sorts the n values of the contiguous src. Returns the encoded sorted keys
+/// and the permutation that sorts src.
+template <typename scalar_t>
+static void SortKeys(const scalar_t* src,
+                     int64_t n,
+                     std::vector<typename CPURadixKey<scalar_t>::key_t>& keys,
+                     std::vector<int64_t>& indices) {
+    keys.resize(n);
+    indices.resize(n);
+    ParallelFor(n, kDefaultGrainSize, [&](int64_t start, int64_t end) {
+        for (int64_t i = start; i < end; ++i) {
+            keys[i] = CPURadixKey<scalar_t>::Encode(src[i]);
+            indices[i] = i;
+        }
+    });
+    RadixSortPairs(keys, indices);
+}
+
+Tensor ArgSortCPU(const Tensor& src) {
+    Tensor src_contiguous = src.Contiguous();
+    const int64_t n = src.NumElements();
+    std::vector<int64_t> indices;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        std::vector<typename CPURadixKey<scalar_t>::key_t> keys;
+        SortKeys(static_cast<const scalar_t*>(src_contiguous.GetDataPtr()), n,
+                 keys, indices);
+    });
+    return Tensor(indices, {n}, Dtype::Int64, src.GetDevice());
+}
+
+std::tuple<Tensor, Tensor, Tensor> UniqueCPU(const Tensor& src,
+                                             bool return_inverse,
+                                             bool return_counts) {
+    Tensor src_contiguous = src.Contiguous();
+    const int64_t n = src.NumElements();
+    Tensor unique, inverse, counts;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        std::vector<typename CPURadixKey<scalar_t>::key_t> keys;
+        std::vector<int64_t> indices;
+        SortKeys(src_ptr, n, keys, indices);
+
+        // unique_ids[i] is the 1-based index of the unique value of the i-th
+        // sorted element.
+        std::vector<int64_t> unique_ids(n);
+        ParallelFor(n, kDefaultGrainSize, [&](int64_t start, int64_t end) {
+            for (int64_t i = start; i < end; ++i) {
+                unique_ids[i] = (i == 0 || keys[i] != keys[i - 1]) ? 1 : 0;
+            }
+        });
+        utility::InclusivePrefixSum(unique_ids.data(), unique_ids.data() + n,
+                                    unique_ids.data());
+        const int64_t num_unique = n > 0 ? unique_ids[n - 1] : 0;
+
+        unique = Tensor({num_unique}, src.GetDtype(), src.GetDevice());
+        scalar_t* unique_data = static_cast<scalar_t*>(unique.GetDataPtr());
+        std::vector<int64_t> starts(num_unique + 1, n);
+        ParallelFor(n, kDefaultGrainSize, [&](int64_t start, int64_t end) {
+            for (int64_t i = start; i < end; ++i) {
+                if (i == 0 || unique_ids[i] != unique_ids[i - 1]) {
+                    unique_data[unique_ids[i] - 1] = src_ptr[indices[i]];
+                    starts[unique_ids[i] - 1] = i;
+                }
+            }
+        });
+
+        if (return_inverse) {
+            inverse = Tensor(src.GetShape(), Dtype::Int64, src.GetDevice());
+            int64_t* inverse_ptr = static_cast<int64_t*>(inverse.GetDataPtr());
+            ParallelFor(n, kDefaultGrainSize, [&](int64_t start, int64_t end) {
+                for (int64_t i = start; i < end; ++i) {
+                    inverse_ptr[indices[i]] = unique_ids[i] - 1;
+                }
+            });
+        }
+        if (return_counts) {
+            counts = Tensor({num_unique}, Dtype::Int64, src.GetDevice());
+            int64_t* counts_ptr = static_cast<int64_t*>(counts.GetDataPtr());
+            for (int64_t i = 0; i < num_unique; ++i) {
+                counts_ptr[i] = starts[i + 1] - starts[i];
+            }
+        }
+    });
+    return std::make_tuple(unique, inverse, counts);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
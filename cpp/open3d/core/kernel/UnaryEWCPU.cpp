@@ -26,6 +26,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <type_traits>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -120,6 +121,83 @@ static void CPULogicalNotElementKernel(const void* src, void* dst) {
             !static_cast<bool>(*static_cast<const src_t*>(src)));
 }
 
+template <typename scalar_t>
+static inline typename std::enable_if<std::is_signed<scalar_t>::value,
+                                      scalar_t>::type
+CPUVectorizedAbs(scalar_t a) {
+    return a < 0 ? static_cast<scalar_t>(-a) : a;
+}
+
+template <typename scalar_t>
+static inline typename std::enable_if<!std::is_signed<scalar_t>::value,
+                                      scalar_t>::type
+CPUVectorizedAbs(scalar_t a) {
+    return a;
+}
+
+template <typename scalar_t, typename func_t>
+static void LaunchContiguousUnaryEWKernel(const Tensor& src,
+                                          Tensor& dst,
+                                          func_t element_kernel) {
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+    CPULauncher::LaunchVectorizedKernel(
+            dst.NumElements(), [&](int64_t start, int64_t end) {
+                OPEN3D_SIMD_LOOP
+                for (int64_t i = start; i < end; ++i) {
+                    dst_ptr[i] = element_kernel(src_ptr[i]);
+                }
+            });
+}
+
+/// Vectorized fast path for contiguous tensors of the same dtype. Returns
+/// false if \p op_code has no vectorized implementation for scalar_t.
+template <typename scalar_t>
+static bool LaunchContiguousUnaryEWOp(const Tensor& src,
+                                      Tensor& dst,
+                                      UnaryEWOpCode op_code) {
+    constexpr bool is_float = std::is_floating_point<scalar_t>::value;
+    switch (op_code) {
+        case UnaryEWOpCode::Neg:
+            LaunchContiguousUnaryEWKernel<scalar_t>(
+                    src, dst,
+                    [](scalar_t a) -> scalar_t { return -a; });
+            return true;
+        case UnaryEWOpCode::Abs:
+            LaunchContiguousUnaryEWKernel<scalar_t>(
+                    src, dst, CPUVectorizedAbs<scalar_t>);
+            return true;
+        case UnaryEWOpCode::Sqrt:
+            // Without -fno-math-errno the compiler keeps a scalar sqrt, but
+            // the loop still skips the Indexer.
+            if (!is_float) return false;
+            LaunchContiguousUnaryEWKernel<scalar_t>(
+                    src, dst,
+                    [](scalar_t a) -> scalar_t { return std::sqrt(a); });
+            return true;
+        case UnaryEWOpCode::Floor:
+            if (!is_float) return false;
+            LaunchContiguousUnaryEWKernel<scalar_t>(
+                    src, dst,
+                    [](scalar_t a) -> scalar_t { return std::floor(a); });
+            return true;
+        case UnaryEWOpCode::Ceil:
+            if (!is_float) return false;
+            LaunchContiguousUnaryEWKernel<scalar_t>(
+                    src, dst,
+                    [](scalar_t a) -> scalar_t { return std::ceil(a); });
+            return true;
+        case UnaryEWOpCode::Trunc:
+            if (!is_float) return false;
+            LaunchContiguousUnaryEWKernel<scalar_t>(
+                    src, dst,
+                    [](scalar_t a) -> scalar_t { return std::trunc(a); });
+            return true;
+        default:
+            return false;
+    }
+}
+
 void CopyCPU(const Tensor& src, Tensor& dst) {
     // src and dst have been checked to have the same shape, dtype, device
     SizeVector shape = src.GetShape();
@@ -184,6 +262,17 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             }
         });
     } else {
+        if (src.IsContiguous() && dst.IsContiguous() &&
+            src.GetShape() == dst.GetShape() && src_dtype == dst_dtype) {
+            bool launched = false;
+            DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+                launched = LaunchContiguousUnaryEWOp<scalar_t>(src, dst,
+                                                               op_code);
+            });
+            if (launched) {
+                return;
+            }
+        }
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/VoxelDownSample.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// There are no CUDA kernels for voxel downsampling yet. CUDA tensors are
+// processed on the CPU and the results are copied back.
+
+void VoxelSegments(const Tensor& points,
+                   double voxel_size,
+                   const Tensor& origin,
+                   Tensor& order,
+                   Tensor& splits) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    origin.AssertShape({3});
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive, but got {}.",
+                          voxel_size);
+    }
+    Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        VoxelSegmentsCPU(points, voxel_size, origin, order, splits);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        const Device host("CPU:0");
+        VoxelSegmentsCPU(points.To(host), voxel_size, origin.To(host), order,
+                         splits);
+        order = order.To(points.GetDevice());
+        splits = splits.To(points.GetDevice());
+    } else {
+        utility::LogError("VoxelSegments: Unimplemented device");
+    }
+}
+
+Tensor VoxelMean(const Tensor& src, const Tensor& order, const Tensor& splits) {
+    order.AssertDtype(Dtype::Int64);
+    splits.AssertDtype(Dtype::Int64);
+    if (src.NumDims() == 0 || src.GetLength() != order.GetLength()) {
+        utility::LogError("src must have {} rows, but has shape {}.",
+                          order.GetLength(), src.GetShape().ToString());
+    }
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return VoxelMeanCPU(src, order, splits);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        const Device host("CPU:0");
+        return VoxelMeanCPU(src.To(host), order.To(host), splits.To(host))
+                .To(src.GetDevice());
+    } else {
+        utility::LogError("VoxelMean: Unimplemented device");
+    }
+}
+
+void VoxelCenters(const Tensor& points,
+                  double voxel_size,
+                  const Tensor& origin,
+                  const Tensor& order,
+                  const Tensor& splits,
+                  Tensor& centers,
+                  Tensor& nearest) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    origin.AssertShape({3});
+    order.AssertDtype(Dtype::Int64);
+    splits.AssertDtype(Dtype::Int64);
+    Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        VoxelCentersCPU(points, voxel_size, origin, order, splits, centers,
+                        nearest);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        const Device host("CPU:0");
+        VoxelCentersCPU(points.To(host), voxel_size, origin.To(host),
+                        order.To(host), splits.To(host), centers, nearest);
+        centers = centers.To(points.GetDevice());
+        nearest = nearest.To(points.GetDevice());
+    } else {
+        utility::LogError("VoxelCenters: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Groups 3D points by voxel, sorting the voxel keys with a radix sort.
+///
+/// \param points Float32 or Float64 tensor of shape {N, 3}.
+/// \param voxel_size Edge length of the voxels.
+/// \param origin Tensor of shape {3}, a corner of the voxel grid.
+/// \param order Output Int64 tensor of shape {N}, the point indices sorted
+/// by voxel. The points of a voxel are in increasing order.
+/// \param splits Output Int64 tensor of shape {M + 1} for M voxels. The
+/// points of voxel m are order[splits[m]:splits[m + 1]].
+void VoxelSegments(const Tensor& points,
+                   double voxel_size,
+                   const Tensor& origin,
+                   Tensor& order,
+                   Tensor& splits);
+
+/// Averages the rows of \p src in each voxel of VoxelSegments(). For floating
+/// point dtypes, rows with a NaN are left out of the sum but still counted.
+/// For integer dtypes the mean is truncated.
+///
+/// \param src Tensor of shape {N, ...}.
+/// \return Tensor of shape {M, ...} with the dtype of \p src.
+Tensor VoxelMean(const Tensor& src, const Tensor& order, const Tensor& splits);
+
+/// Computes the center of each voxel of VoxelSegments(), and the index of the
+/// point closest to it.
+///
+/// \param centers Output tensor of shape {M, 3} with the dtype of \p points.
+/// \param nearest Output Int64 tensor of shape {M}.
+void VoxelCenters(const Tensor& points,
+                  double voxel_size,
+                  const Tensor& origin,
+                  const Tensor& order,
+                  const Tensor& splits,
+                  Tensor& centers,
+                  Tensor& nearest);
+
+void VoxelSegmentsCPU(const Tensor& points,
+                      double voxel_size,
+                      const Tensor& origin,
+                      Tensor& order,
+                      Tensor& splits);
+
+Tensor VoxelMeanCPU(const Tensor& src,
+                    const Tensor& order,
+                    const Tensor& splits);
+
+void VoxelCentersCPU(const Tensor& points,
+                     double voxel_size,
+                     const Tensor& origin,
+                     const Tensor& order,
+                     const Tensor& splits,
+                     Tensor& centers,
+                     Tensor& nearest);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,248 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/CoreUtil.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelFor.h"
+#include "open3d/core/kernel/VoxelDownSample.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Voxel coordinate of \p value along one axis.
+static inline int64_t VoxelCoordinate(double value,
+                                      double origin,
+                                      double voxel_size) {
+    return static_cast<int64_t>(std::floor((value - origin) / voxel_size));
+}
+
+void VoxelSegmentsCPU(const Tensor& points,
+                      double voxel_size,
+                      const Tensor& origin,
+                      Tensor& order,
+                      Tensor& splits) {
+    const Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+    if (num_points == 0) {
+        order = Tensor::Empty({0}, Dtype::Int64, device);
+        splits = Tensor::Zeros({1}, Dtype::Int64, device);
+        return;
+    }
+    const Tensor points_contiguous = points.Contiguous();
+    const std::vector<double> o =
+            origin.To(Dtype::Float64).ToFlatVector<double>();
+
+    // The voxel coordinates are packed in mixed radix over the extent of the
+    // points, which floor() maps to the extent of the voxels.
+    const std::vector<double> min_bound = points_contiguous.Min({0})
+                                                  .To(Dtype::Float64)
+                                                  .ToFlatVector<double>();
+    const std::vector<double> max_bound = points_contiguous.Max({0})
+                                                  .To(Dtype::Float64)
+                                                  .ToFlatVector<double>();
+    int64_t voxel_min[3];
+    int64_t extent[3];
+    double num_keys = 1;
+    for (int c = 0; c < 3; ++c) {
+        voxel_min[c] = VoxelCoordinate(min_bound[c], o[c], voxel_size);
+        extent[c] = VoxelCoordinate(max_bound[c], o[c], voxel_size) -
+                    voxel_min[c] + 1;
+        num_keys *= double(extent[c]);
+    }
+    if (!(num_keys < double(std::numeric_limits<int64_t>::max()))) {
+        utility::LogError("voxel_size {} is too small for the point cloud.",
+                          voxel_size);
+    }
+
+    Tensor keys = Tensor::Empty({num_points}, Dtype::Int64, device);
+    int64_t* keys_ptr = static_cast<int64_t*>(keys.GetDataPtr());
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points_contiguous.GetDataPtr());
+        ParallelFor(num_points, kDefaultGrainSize,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t i = start; i < end; ++i) {
+                            const scalar_t* p = points_ptr + 3 * i;
+                            int64_t key = 0;
+                            for (int c = 0; c < 3; ++c) {
+                                key = key * extent[c] +
+                                      VoxelCoordinate(p[c], o[c], voxel_size) -
+                                      voxel_min[c];
+                            }
+                            keys_ptr[i] = key;
+                        }
+                    });
+    });
+
+    // The radix sort is stable, so the points of a voxel stay in order.
+    order = keys.ArgSort();
+    const int64_t* order_ptr = static_cast<const int64_t*>(order.GetDataPtr());
+
+    // Voxel ids, as the inclusive prefix sum of the voxel starts.
+    std::vector<int64_t> voxel_ids(num_points);
+    ParallelFor(num_points, kDefaultGrainSize, [&](int64_t start, int64_t end) {
+        for (int64_t i = start; i < end; ++i) {
+            voxel_ids[i] = i == 0 || keys_ptr[order_ptr[i]] !=
+                                             keys_ptr[order_ptr[i - 1]];
+        }
+    });
+    utility::InclusivePrefixSum(voxel_ids.data(),
+                                voxel_ids.data() + num_points,
+                                voxel_ids.data());
+    const int64_t num_voxels = voxel_ids[num_points - 1];
+
+    splits = Tensor::Empty({num_voxels + 1}, Dtype::Int64, device);
+    int64_t* splits_ptr = static_cast<int64_t*>(splits.GetDataPtr());
+    ParallelFor(num_points, kDefaultGrainSize, [&](int64_t start, int64_t end) {
+        for (int64_t i = start; i < end; ++i) {
+            if (i == 0 || voxel_ids[i] != voxel_ids[i - 1]) {
+                splits_ptr[voxel_ids[i] - 1] = i;
+            }
+        }
+    });
+    splits_ptr[num_voxels] = num_points;
+}
+
+Tensor VoxelMeanCPU(const Tensor& src,
+                    const Tensor& order,
+                    const Tensor& splits) {
+    const int64_t num_voxels = splits.GetLength() - 1;
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_voxels;
+    Tensor dst = Tensor::Empty(dst_shape, src.GetDtype(), src.GetDevice());
+    if (num_voxels <= 0 || dst.NumElements() == 0) {
+        return dst;
+    }
+
+    const Tensor src_contiguous = src.Contiguous();
+    const int64_t width = dst.NumElements() / num_voxels;
+    const int64_t* order_ptr = static_cast<const int64_t*>(order.GetDataPtr());
+    const int64_t* splits_ptr =
+            static_cast<const int64_t*>(splits.GetDataPtr());
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+        ParallelFor(num_voxels, 256, [&](int64_t start, int64_t end) {
+            std::vector<double> sum(width);
+            for (int64_t m = start; m < end; ++m) {
+                std::fill(sum.begin(), sum.end(), 0.0);
+                for (int64_t k = splits_ptr[m]; k < splits_ptr[m + 1]; ++k) {
+                    const scalar_t* row = src_ptr + order_ptr[k] * width;
+                    if (std::is_floating_point<scalar_t>::value) {
+                        bool has_nan = false;
+                        for (int64_t c = 0; c < width; ++c) {
+                            has_nan |= std::isnan(double(row[c]));
+                        }
+                        if (has_nan) {
+                            continue;
+                        }
+                    }
+                    for (int64_t c = 0; c < width; ++c) {
+                        sum[c] += double(row[c]);
+                    }
+                }
+                const double count = double(splits_ptr[m + 1] - splits_ptr[m]);
+                for (int64_t c = 0; c < width; ++c) {
+                    dst_ptr[m * width + c] =
+                            static_cast<scalar_t>(sum[c] / count);
+                }
+            }
+        });
+    });
+    return dst;
+}
+
+void VoxelCentersCPU(const Tensor& points,
+                     double voxel_size,
+                     const Tensor& origin,
+                     const Tensor& order,
+                     const Tensor& splits,
+                     Tensor& centers,
+                     Tensor& nearest) {
+    const Device device = points.GetDevice();
+    const int64_t num_voxels = std::max(splits.GetLength() - 1, int64_t(0));
+    centers = Tensor::Empty({num_voxels, 3}, points.GetDtype(), device);
+    nearest = Tensor::Empty({num_voxels}, Dtype::Int64, device);
+    if (num_voxels == 0) {
+        return;
+    }
+
+    const Tensor points_contiguous = points.Contiguous();
+    const std::vector<double> o =
+            origin.To(Dtype::Float64).ToFlatVector<double>();
+    const int64_t* order_ptr = static_cast<const int64_t*>(order.GetDataPtr());
+    const int64_t* splits_ptr =
+            static_cast<const int64_t*>(splits.GetDataPtr());
+    int64_t* nearest_ptr = static_cast<int64_t*>(nearest.GetDataPtr());
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points_contiguous.GetDataPtr());
+        scalar_t* centers_ptr = static_cast<scalar_t*>(centers.GetDataPtr());
+        ParallelFor(num_voxels, 256, [&](int64_t start, int64_t end) {
+            for (int64_t m = start; m < end; ++m) {
+                // All the points of the voxel share its coordinates.
+                const scalar_t* first =
+                        points_ptr + 3 * order_ptr[splits_ptr[m]];
+                double center[3];
+                for (int c = 0; c < 3; ++c) {
+                    int64_t voxel = VoxelCoordinate(first[c], o[c], voxel_size);
+                    center[c] = o[c] + (double(voxel) + 0.5) * voxel_size;
+                    centers_ptr[3 * m + c] = static_cast<scalar_t>(center[c]);
+                }
+
+                double best_dist2 = std::numeric_limits<double>::infinity();
+                int64_t best = order_ptr[splits_ptr[m]];
+                for (int64_t k = splits_ptr[m]; k < splits_ptr[m + 1]; ++k) {
+                    const scalar_t* p = points_ptr + 3 * order_ptr[k];
+                    double dist2 = 0;
+                    for (int c = 0; c < 3; ++c) {
+                        dist2 += (double(p[c]) - center[c]) *
+                                 (double(p[c]) - center[c]);
+                    }
+                    if (dist2 < best_dist2) {
+                        best_dist2 = dist2;
+                        best = order_ptr[k];
+                    }
+                }
+                nearest_ptr[m] = best;
+            }
+        });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -26,11 +26,8 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
-#ifdef BUILD_CUDA_MODULE
-#include "open3d/core/nns/FixedRadiusSearch.h"
-#endif
-
 #include "open3d/core/CoreUtil.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -48,17 +45,30 @@ FixedRadiusIndex::~FixedRadiusIndex(){};
 
 bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                                      double radius) {
-#ifdef BUILD_CUDA_MODULE
-    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CUDA) {
-        utility::LogError(
-                "[FixedRadiusIndex::SetTensorData] dataset_points should be "
-                "GPU Tensor.");
-    }
     if (radius <= 0) {
         utility::LogError(
                 "[FixedRadiusIndex::SetTensorData] radius should be positive.");
     }
+    if (dataset_points.NumDims() != 2 || dataset_points.GetShape()[1] != 3) {
+        utility::LogError(
+                "[FixedRadiusIndex::SetTensorData] dataset_points must have "
+                "shape {{n, 3}}, but got {}.",
+                dataset_points.GetShape().ToString());
+    }
     dataset_points_ = dataset_points.Contiguous();
+    radius_ = radius;
+
+    if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CPU) {
+        // About one bucket per point keeps the buckets short for any radius.
+        int64_t hash_table_size =
+                std::max<int64_t>(static_cast<int64_t>(GetDatasetSize()), 1);
+        BuildSpatialHashTableCPU(dataset_points_, radius, hash_table_size,
+                                 hash_table_cell_splits_, hash_table_index_,
+                                 sorted_points_);
+        return true;
+    }
+
+#ifdef BUILD_CUDA_MODULE
     int64_t num_points = GetDatasetSize();
     int64_t hash_table_size = std::min<int64_t>(
             std::max<int64_t>(hash_table_size_factor * num_points, 1),
@@ -111,14 +121,14 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
     return true;
 #else
     utility::LogError(
-            "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please "
-            "compile Open3d with BUILD_CUDA_MODULE=ON.");
+            "FixedRadiusIndex::SetTensorData with GPU tensor is disabled "
+            "since BUILD_CUDA_MODULE is OFF. Please compile Open3d with "
+            "BUILD_CUDA_MODULE=ON.");
 #endif
 };
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         const Tensor &query_points, double radius) const {
-#ifdef BUILD_CUDA_MODULE
     // Check dtype.
     query_points.AssertDtype(GetDtype());
 
@@ -132,6 +142,20 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         utility::LogError(
                 "[FixedRadiusIndex::SearchRadius] radius should be positive.");
     }
+
+    if (GetDevice().GetType() == Device::DeviceType::CPU) {
+        if (radius > radius_) {
+            utility::LogError(
+                    "[FixedRadiusIndex::SearchRadius] radius {} is larger "
+                    "than the radius {} of the index.",
+                    radius, radius_);
+        }
+        return FixedRadiusSearchCPU(query_points.Contiguous(), radius, radius_,
+                                    hash_table_cell_splits_, hash_table_index_,
+                                    sorted_points_);
+    }
+
+#ifdef BUILD_CUDA_MODULE
     Tensor query_points_ = query_points.Contiguous();
     int64_t num_query_points = query_points_.GetShape()[0];
     std::vector<int64_t> queries_row_splits({0, num_query_points});
@@ -196,8 +220,9 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
     return std::make_tuple(neighbors_index, neighbors_distance, num_neighbors);
 #else
     utility::LogError(
-            "FixedRadiusIndex::SearchRadius BUILD_CUDA_MODULE is OFF. Please "
-            "compile Open3d with BUILD_CUDA_MODULE=ON.");
+            "FixedRadiusIndex::SearchRadius with GPU tensor is disabled since "
+            "BUILD_CUDA_MODULE is OFF. Please compile Open3d with "
+            "BUILD_CUDA_MODULE=ON.");
 #endif
 };
 
@@ -39,6 +39,11 @@ namespace nns {
 /// \class FixedRadiusIndex
 ///
 /// \brief FixedRadiusIndex for nearest neighbor range search.
+///
+/// The dataset points are bucketed in a spatial hash table of voxels of size
+/// 2 * radius. On the CPU, the points are stored sorted by bucket, and queries
+/// may use any radius up to the radius the index was built with. Only 3D
+/// points are supported.
 class FixedRadiusIndex : public NNSIndex {
 public:
     /// \brief Default Constructor.
@@ -46,8 +51,9 @@ public:
 
     /// \brief Parameterized Constructor.
     ///
-    /// \param tensor Provides a set of data points as Tensor for KDTree
-    /// construction.
+    /// \param dataset_points Provides a set of data points as Tensor for
+    /// hash table construction.
+    /// \param radius The largest radius of searches.
     FixedRadiusIndex(const Tensor& dataset_points, double radius);
     ~FixedRadiusIndex();
     FixedRadiusIndex(const FixedRadiusIndex&) = delete;
@@ -92,15 +98,35 @@ public:
         utility::LogError("FixedRadiusIndex::SearchHybrid not implemented.");
     }
 
-    const double hash_table_size_factor = 1 / 32;
+    /// Returns the radius the index was built with.
+    double GetRadius() const { return radius_; }
+
+    /// CPU only: Int64 tensor of shape {hash_table_size + 1}, the start of
+    /// each bucket in GetSortedPoints().
+    const Tensor& GetHashTableCellSplits() const {
+        return hash_table_cell_splits_;
+    }
+
+    /// CPU only: Int64 tensor of shape {N}, the dataset index of each point
+    /// of GetSortedPoints().
+    const Tensor& GetHashTableIndex() const { return hash_table_index_; }
+
+    /// CPU only: the dataset points sorted by bucket.
+    const Tensor& GetSortedPoints() const { return sorted_points_; }
+
+    const double hash_table_size_factor = 1.0 / 32;
     const int64_t max_hash_tabls_size = 10000;
 
 protected:
+    /// Radius the index was built with.
+    double radius_ = 0;
     std::vector<int64_t> points_row_splits_;
     std::vector<uint32_t> hash_table_splits_;
     std::vector<uint32_t> out_hash_table_splits_;
     Tensor hash_table_cell_splits_;
     Tensor hash_table_index_;
+    /// CPU only: the dataset points in the order of hash_table_index_.
+    Tensor sorted_points_;
 };
 
 template <class T>
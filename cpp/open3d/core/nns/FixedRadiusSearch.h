@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
 
@@ -202,6 +205,57 @@ void FixedRadiusSearchCUDA(void* temp,
                            const uint32_t* const hash_table_index,
                            NeighborSearchAllocator<T>& output_allocator);
 
+/// Builds a spatial hash table of 3D points on the CPU. The points are
+/// bucketed by the hash of their voxel of size 2 * \p radius and sorted by
+/// bucket, so that the points of a bucket are contiguous in memory.
+///
+/// \param points    Contiguous CPU tensor of shape {N, 3}, Float32 or
+///        Float64.
+///
+/// \param radius    The largest radius that will be used for searching.
+///
+/// \param hash_table_size    The number of buckets of the hash table.
+///
+/// \param hash_table_cell_splits    Output Int64 tensor of shape
+///        {hash_table_size + 1}. Bucket i holds the entries
+///        [hash_table_cell_splits[i], hash_table_cell_splits[i + 1]) of
+///        \p hash_table_index and \p sorted_points.
+///
+/// \param hash_table_index    Output Int64 tensor of shape {N}, the indices of
+///        the points sorted by bucket.
+///
+/// \param sorted_points    Output tensor of shape {N, 3}, the points sorted by
+///        bucket.
+void BuildSpatialHashTableCPU(const Tensor& points,
+                              double radius,
+                              int64_t hash_table_size,
+                              Tensor& hash_table_cell_splits,
+                              Tensor& hash_table_index,
+                              Tensor& sorted_points);
+
+/// Fixed radius search on the CPU with the hash table of
+/// BuildSpatialHashTableCPU(). Neighbors of each query are sorted by distance.
+///
+/// \param queries    Contiguous CPU tensor of shape {M, 3}, with the dtype of
+///        the points.
+///
+/// \param radius    The search radius. Must not be larger than the radius used
+///        to build the hash table.
+///
+/// \param index_radius    The radius used to build the hash table.
+///
+/// \return Tuple of Tensors (indices, distances, num_neighbors):
+/// - indices: Int64 tensor of shape {total_num_neighbors}.
+/// - distances: squared distances, tensor of shape {total_num_neighbors}.
+/// - num_neighbors: Int64 tensor of shape {M}.
+std::tuple<Tensor, Tensor, Tensor> FixedRadiusSearchCPU(
+        const Tensor& queries,
+        double radius,
+        double index_radius,
+        const Tensor& hash_table_cell_splits,
+        const Tensor& hash_table_index,
+        const Tensor& sorted_points);
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
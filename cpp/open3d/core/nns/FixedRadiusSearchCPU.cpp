@@ -0,0 +1,228 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/CoreUtil.h"
+#include "open3d/core/kernel/ParallelFor.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Number of queries processed by a task of FixedRadiusSearchCPU().
+static constexpr int64_t kQueryBatchSize = 256;
+
+void BuildSpatialHashTableCPU(const Tensor& points,
+                              double radius,
+                              int64_t hash_table_size,
+                              Tensor& hash_table_cell_splits,
+                              Tensor& hash_table_index,
+                              Tensor& sorted_points) {
+    const int64_t num_points = points.GetLength();
+    const Device device = points.GetDevice();
+    Tensor cell_ids = Tensor::Empty({num_points}, Dtype::Int64, device);
+    int64_t* cell_ids_ptr = static_cast<int64_t*>(cell_ids.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        using Vec3_t = utility::MiniVec<scalar_t, 3>;
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(points.GetDataPtr());
+        const scalar_t inv_voxel_size = static_cast<scalar_t>(0.5 / radius);
+        kernel::ParallelFor(
+                num_points, kernel::kDefaultGrainSize / 16,
+                [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        Vec3_t pos(points_ptr + 3 * i);
+                        cell_ids_ptr[i] = static_cast<int64_t>(
+                                SpatialHash(ComputeVoxelIndex(
+                                        pos, inv_voxel_size)) %
+                                hash_table_size);
+                    }
+                });
+    });
+
+    // Stable radix sort by bucket, then copy the points into bucket order.
+    hash_table_index = cell_ids.ArgSort();
+    sorted_points = points.Gather(hash_table_index);
+    Tensor sorted_cell_ids = cell_ids.Gather(hash_table_index);
+
+    // Each bucket boundary is found by exactly one sorted position.
+    hash_table_cell_splits =
+            Tensor::Empty({hash_table_size + 1}, Dtype::Int64, device);
+    int64_t* splits_ptr =
+            static_cast<int64_t*>(hash_table_cell_splits.GetDataPtr());
+    const int64_t* sorted_ptr =
+            static_cast<const int64_t*>(sorted_cell_ids.GetDataPtr());
+    kernel::ParallelFor(
+            num_points + 1, kernel::kDefaultGrainSize,
+            [&](int64_t start, int64_t end) {
+                for (int64_t i = start; i < end; ++i) {
+                    const int64_t prev_cell = i == 0 ? -1 : sorted_ptr[i - 1];
+                    const int64_t cell =
+                            i == num_points ? hash_table_size : sorted_ptr[i];
+                    for (int64_t c = prev_cell + 1; c <= cell; ++c) {
+                        splits_ptr[c] = i;
+                    }
+                }
+            });
+}
+
+std::tuple<Tensor, Tensor, Tensor> FixedRadiusSearchCPU(
+        const Tensor& queries,
+        double radius,
+        double index_radius,
+        const Tensor& hash_table_cell_splits,
+        const Tensor& hash_table_index,
+        const Tensor& sorted_points) {
+    const int64_t num_queries = queries.GetLength();
+    const int64_t hash_table_size = hash_table_cell_splits.GetLength() - 1;
+    const Device device = queries.GetDevice();
+    const Dtype dtype = queries.GetDtype();
+    Tensor num_neighbors = Tensor::Empty({num_queries}, Dtype::Int64, device);
+    Tensor neighbors_index;
+    Tensor neighbors_distance;
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+        using Vec3_t = utility::MiniVec<scalar_t, 3>;
+        const scalar_t* queries_ptr =
+                static_cast<const scalar_t*>(queries.GetDataPtr());
+        const scalar_t* points_ptr =
+                static_cast<const scalar_t*>(sorted_points.GetDataPtr());
+        const int64_t* splits_ptr = static_cast<const int64_t*>(
+                hash_table_cell_splits.GetDataPtr());
+        const int64_t* index_ptr =
+                static_cast<const int64_t*>(hash_table_index.GetDataPtr());
+        int64_t* num_neighbors_ptr =
+                static_cast<int64_t*>(num_neighbors.GetDataPtr());
+        const scalar_t r = static_cast<scalar_t>(radius);
+        const scalar_t threshold = r * r;
+        const scalar_t inv_voxel_size =
+                static_cast<scalar_t>(0.5 / index_radius);
+
+        // Each batch of queries collects its results in its own buffers, which
+        // are concatenated at the end.
+        const int64_t num_batches =
+                (num_queries + kQueryBatchSize - 1) / kQueryBatchSize;
+        std::vector<std::vector<std::pair<scalar_t, int64_t>>> batch_neighbors(
+                num_batches);
+        kernel::ParallelFor(num_batches, 1, [&](int64_t start, int64_t end) {
+            std::vector<std::pair<scalar_t, int64_t>> query_neighbors;
+            for (int64_t b = start; b < end; ++b) {
+                std::vector<std::pair<scalar_t, int64_t>>& neighbors =
+                        batch_neighbors[b];
+                const int64_t query_end =
+                        std::min((b + 1) * kQueryBatchSize, num_queries);
+                for (int64_t q = b * kQueryBatchSize; q < query_end; ++q) {
+                    const Vec3_t query_pos(queries_ptr + 3 * q);
+                    // The voxels have size 2 * index_radius, so the ball of
+                    // radius r <= index_radius touches 2 voxels along each
+                    // axis, or 3 due to rounding.
+                    const utility::MiniVec<int, 3> voxel_min =
+                            ComputeVoxelIndex(query_pos - r, inv_voxel_size);
+                    const utility::MiniVec<int, 3> voxel_max =
+                            ComputeVoxelIndex(query_pos + r, inv_voxel_size);
+                    int64_t buckets[27];
+                    int num_buckets = 0;
+                    for (int z = voxel_min[2]; z <= voxel_max[2]; ++z) {
+                        for (int y = voxel_min[1]; y <= voxel_max[1]; ++y) {
+                            for (int x = voxel_min[0]; x <= voxel_max[0];
+                                 ++x) {
+                                const int64_t bucket = static_cast<int64_t>(
+                                        SpatialHash(x, y, z) %
+                                        hash_table_size);
+                                // Different voxels can share a bucket.
+                                if (std::find(buckets, buckets + num_buckets,
+                                              bucket) ==
+                                    buckets + num_buckets) {
+                                    buckets[num_buckets++] = bucket;
+                                }
+                            }
+                        }
+                    }
+
+                    query_neighbors.clear();
+                    for (int k = 0; k < num_buckets; ++k) {
+                        for (int64_t i = splits_ptr[buckets[k]];
+                             i < splits_ptr[buckets[k] + 1]; ++i) {
+                            const scalar_t* p = points_ptr + 3 * i;
+                            const scalar_t dx = p[0] - query_pos[0];
+                            const scalar_t dy = p[1] - query_pos[1];
+                            const scalar_t dz = p[2] - query_pos[2];
+                            const scalar_t dist = dx * dx + dy * dy + dz * dz;
+                            if (dist <= threshold) {
+                                query_neighbors.emplace_back(dist,
+                                                             index_ptr[i]);
+                            }
+                        }
+                    }
+                    std::sort(query_neighbors.begin(), query_neighbors.end());
+                    num_neighbors_ptr[q] =
+                            static_cast<int64_t>(query_neighbors.size());
+                    neighbors.insert(neighbors.end(), query_neighbors.begin(),
+                                     query_neighbors.end());
+                }
+            }
+        });
+
+        std::vector<int64_t> batch_offsets(num_batches + 1, 0);
+        for (int64_t b = 0; b < num_batches; ++b) {
+            batch_offsets[b + 1] =
+                    batch_offsets[b] +
+                    static_cast<int64_t>(batch_neighbors[b].size());
+        }
+        neighbors_index = Tensor::Empty({batch_offsets.back()}, Dtype::Int64,
+                                        device);
+        neighbors_distance =
+                Tensor::Empty({batch_offsets.back()}, dtype, device);
+        int64_t* out_index_ptr =
+                static_cast<int64_t*>(neighbors_index.GetDataPtr());
+        scalar_t* out_distance_ptr =
+                static_cast<scalar_t*>(neighbors_distance.GetDataPtr());
+        kernel::ParallelFor(num_batches, 1, [&](int64_t start, int64_t end) {
+            for (int64_t b = start; b < end; ++b) {
+                int64_t offset = batch_offsets[b];
+                for (const auto& neighbor : batch_neighbors[b]) {
+                    out_distance_ptr[offset] = neighbor.first;
+                    out_index_ptr[offset] = neighbor.second;
+                    ++offset;
+                }
+            }
+        });
+    });
+
+    return std::make_tuple(neighbors_index, neighbors_distance, num_neighbors);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -58,6 +58,7 @@ bool NearestNeighborSearch::KnnIndex() {
 bool NearestNeighborSearch::MultiRadiusIndex() { return SetIndex(); };
 
 bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
+    fixed_radius_index_.reset();
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (!radius.has_value())
             utility::LogError(
@@ -74,6 +75,11 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
                 "Please recompile Open3D with BUILD_CUDA_MODULE=ON.");
 #endif
 
+    } else if (radius.has_value() && dataset_points_.NumDims() == 2 &&
+               dataset_points_.GetShape()[1] == 3) {
+        fixed_radius_index_.reset(new nns::FixedRadiusIndex());
+        return fixed_radius_index_->SetTensorData(dataset_points_,
+                                                  radius.value());
     } else {
         return SetIndex();
     }
@@ -111,14 +117,13 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius) {
-    if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
-        if (fixed_radius_index_) {
-            return fixed_radius_index_->SearchRadius(query_points, radius);
-        } else {
-            utility::LogError(
-                    "[NearsetNeighborSearch::FixedRadiusSearch] Index is not "
-                    "set.");
-        }
+    if (fixed_radius_index_) {
+        return fixed_radius_index_->SearchRadius(query_points, radius);
+    } else if (dataset_points_.GetDevice().GetType() ==
+               Device::DeviceType::CUDA) {
+        utility::LogError(
+                "[NearsetNeighborSearch::FixedRadiusSearch] Index is not "
+                "set.");
     } else {
         if (nanoflann_index_) {
             return nanoflann_index_->SearchRadius(query_points, radius);
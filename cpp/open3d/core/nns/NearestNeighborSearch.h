@@ -67,8 +67,11 @@ public:
 
     /// Set index for fixed-radius search.
     ///
-    /// \param radius optional radius parameter. required for gpu fixed radius
-    /// index. \return Returns true if building index success, otherwise false.
+    /// \param radius optional radius parameter. Required for GPU tensors. For
+    /// 3D CPU tensors, a radius selects a spatial hash grid index, which
+    /// supports searches with a radius up to this one. Otherwise a KDTree is
+    /// used.
+    /// \return Returns true if building index success, otherwise false.
     bool FixedRadiusIndex(utility::optional<double> radius = {});
 
     /// Set index for hybrid search.
@@ -28,7 +28,10 @@
 
 #include <Eigen/Dense>
 #include <numeric>
+#include <unordered_map>
 
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/kernel/VoxelDownSample.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/Qhull.h"
@@ -196,117 +199,41 @@ std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
     return output;
 }
 
-// helper classes for VoxelDownSample and VoxelDownSampleAndTrace
-namespace {
-class AccumulatedPoint {
-public:
-    AccumulatedPoint()
-        : num_of_points_(0),
-          point_(0.0, 0.0, 0.0),
-          normal_(0.0, 0.0, 0.0),
-          color_(0.0, 0.0, 0.0) {}
-
-public:
-    void AddPoint(const PointCloud &cloud, int index) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
-            }
-        }
-        if (cloud.HasColors()) {
-            color_ += cloud.colors_[index];
-        }
-        num_of_points_++;
-    }
-
-    Eigen::Vector3d GetAveragePoint() const {
-        return point_ / double(num_of_points_);
-    }
-
-    Eigen::Vector3d GetAverageNormal() const {
-        // Call NormalizeNormals() afterwards if necessary
-        return normal_ / double(num_of_points_);
-    }
-
-    Eigen::Vector3d GetAverageColor() const {
-        return color_ / double(num_of_points_);
-    }
-
-public:
-    int num_of_points_;
-    Eigen::Vector3d point_;
-    Eigen::Vector3d normal_;
-    Eigen::Vector3d color_;
-};
-
-class point_cubic_id {
-public:
-    size_t point_id;
-    int cubic_id;
-};
+// Wraps the memory of \p values in a Float64 tensor of shape {N, 3}, without
+// copying it.
+static core::Tensor WrapVector3dVector(
+        const std::vector<Eigen::Vector3d> &values) {
+    const core::Device host("CPU:0");
+    void *data_ptr = const_cast<double *>(values.data()->data());
+    return core::Tensor({int64_t(values.size()), 3}, {3, 1}, data_ptr,
+                        core::Dtype::Float64,
+                        std::make_shared<core::Blob>(host, data_ptr,
+                                                     [](void *) {}));
+}
 
-class AccumulatedPointForTrace : public AccumulatedPoint {
-public:
-    void AddPoint(const PointCloud &cloud,
-                  size_t index,
-                  int cubic_index,
-                  bool approximate_class) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
-            }
-        }
-        if (cloud.HasColors()) {
-            if (approximate_class) {
-                auto got = classes.find(int(cloud.colors_[index][0]));
-                if (got == classes.end())
-                    classes[int(cloud.colors_[index][0])] = 1;
-                else
-                    classes[int(cloud.colors_[index][0])] += 1;
-            } else {
-                color_ += cloud.colors_[index];
-            }
-        }
-        point_cubic_id new_id;
-        new_id.point_id = index;
-        new_id.cubic_id = cubic_index;
-        original_id.push_back(new_id);
-        num_of_points_++;
-    }
-
-    Eigen::Vector3d GetMaxClass() {
-        int max_class = -1;
-        int max_count = -1;
-        for (auto it = classes.begin(); it != classes.end(); it++) {
-            if (it->second > max_count) {
-                max_count = it->second;
-                max_class = it->first;
-            }
-        }
-        return Eigen::Vector3d(max_class, max_class, max_class);
+static std::vector<Eigen::Vector3d> GatherVector3dVector(
+        const std::vector<Eigen::Vector3d> &values,
+        const core::Tensor &indices) {
+    const int64_t *indices_ptr =
+            static_cast<const int64_t *>(indices.GetDataPtr());
+    std::vector<Eigen::Vector3d> gathered(indices.GetLength());
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < indices.GetLength(); ++i) {
+        gathered[i] = values[indices_ptr[i]];
     }
-
-    std::vector<point_cubic_id> GetOriginalID() { return original_id; }
-
-private:
-    // original point cloud id in higher resolution + its cubic id
-    std::vector<point_cubic_id> original_id;
-    std::unordered_map<int, int> classes;
-};
-}  // namespace
+    return gathered;
+}
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
-        double voxel_size) const {
+        double voxel_size,
+        VoxelDownSampleMode mode /* = VoxelDownSampleMode::Mean */) const {
     auto output = std::make_shared<PointCloud>();
     if (voxel_size <= 0.0) {
         utility::LogError("[VoxelDownSample] voxel_size <= 0.");
     }
+    if (!HasPoints()) {
+        return output;
+    }
     Eigen::Vector3d voxel_size3 =
             Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
     Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
@@ -315,27 +242,50 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+    // The points are sorted by voxel, then each voxel is reduced in
+    // parallel.
+    const core::Tensor points = WrapVector3dVector(points_);
+    const core::Tensor origin(voxel_min_bound.data(), {3},
+                              core::Dtype::Float64);
+    core::Tensor order, splits;
+    core::kernel::VoxelSegments(points, voxel_size, origin, order, splits);
+    const int64_t num_voxels = splits.GetLength() - 1;
+
+    if (mode == VoxelDownSampleMode::Mean) {
+        output->points_ = core::eigen_converter::TensorToEigenVector3dVector(
+                core::kernel::VoxelMean(points, order, splits));
+        if (HasNormals()) {
+            // Call NormalizeNormals() afterwards if necessary.
+            output->normals_ =
+                    core::eigen_converter::TensorToEigenVector3dVector(
+                            core::kernel::VoxelMean(
+                                    WrapVector3dVector(normals_), order,
+                                    splits));
+        }
+        if (HasColors()) {
+            output->colors_ =
+                    core::eigen_converter::TensorToEigenVector3dVector(
+                            core::kernel::VoxelMean(WrapVector3dVector(colors_),
+                                                    order, splits));
+        }
+    } else {
+        core::Tensor selected;
+        if (mode == VoxelDownSampleMode::First) {
+            selected = order.IndexGet({splits.Slice(0, 0, num_voxels)});
+            output->points_ = GatherVector3dVector(points_, selected);
+        } else {
+            core::Tensor centers;
+            core::kernel::VoxelCenters(points, voxel_size, origin, order,
+                                       splits, centers, selected);
+            output->points_ =
+                    core::eigen_converter::TensorToEigenVector3dVector(centers);
+        }
+        if (HasNormals()) {
+            output->normals_ = GatherVector3dVector(normals_, selected);
         }
-        if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+        if (HasColors()) {
+            output->colors_ = GatherVector3dVector(colors_, selected);
         }
     }
     utility::LogDebug(
@@ -364,51 +314,76 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    if (!HasPoints()) {
+        return std::make_tuple(output, cubic_id,
+                               std::vector<std::vector<int>>());
+    }
+
+    const core::Tensor points = WrapVector3dVector(points_);
+    core::Tensor order, splits;
+    core::kernel::VoxelSegments(
+            points, voxel_size,
+            core::Tensor(voxel_min_bound.data(), {3}, core::Dtype::Float64),
+            order, splits);
+    const int num_voxels = int(splits.GetLength() - 1);
+    const int64_t *order_ptr = static_cast<const int64_t *>(order.GetDataPtr());
+    const int64_t *splits_ptr =
+            static_cast<const int64_t *>(splits.GetDataPtr());
+
+    output->points_ = core::eigen_converter::TensorToEigenVector3dVector(
+            core::kernel::VoxelMean(points, order, splits));
+    if (HasNormals()) {
+        output->normals_ = core::eigen_converter::TensorToEigenVector3dVector(
+                core::kernel::VoxelMean(WrapVector3dVector(normals_), order,
+                                        splits));
+    }
+    if (HasColors() && !approximate_class) {
+        output->colors_ = core::eigen_converter::TensorToEigenVector3dVector(
+                core::kernel::VoxelMean(WrapVector3dVector(colors_), order,
+                                        splits));
+    } else if (HasColors()) {
+        output->colors_.resize(num_voxels);
+    }
+
+    // The points of a voxel are in increasing order, so the last point of a
+    // cubic id wins, as with the insertion order of the serial version.
+    cubic_id.resize(num_voxels, 8);
+    cubic_id.setConstant(-1);
+    std::vector<std::vector<int>> original_indices(num_voxels);
     int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
+#pragma omp parallel for schedule(static)
+    for (int cnt = 0; cnt < num_voxels; ++cnt) {
+        std::unordered_map<int, int> classes;
+        original_indices[cnt].reserve(splits_ptr[cnt + 1] - splits_ptr[cnt]);
+        for (int64_t k = splits_ptr[cnt]; k < splits_ptr[cnt + 1]; ++k) {
+            const int pid = int(order_ptr[k]);
+            auto ref_coord = (points_[pid] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - floor(ref_coord(c))) >= 0.5) {
+                    cid += cid_temp[c];
+                }
             }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
-    cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
-        }
-        if (has_colors) {
-            if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
-            } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+            cubic_id(cnt, cid) = pid;
+            original_indices[cnt].push_back(pid);
+            if (HasColors() && approximate_class) {
+                classes[int(colors_[pid][0])]++;
             }
         }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
+        if (HasColors() && approximate_class) {
+            // The most frequent class, the smallest one on ties.
+            int max_class = -1;
+            int max_count = -1;
+            for (const auto &it : classes) {
+                if (it.second > max_count ||
+                    (it.second == max_count && it.first < max_class)) {
+                    max_count = it.second;
+                    max_class = it.first;
+                }
+            }
+            output->colors_[cnt] =
+                    Eigen::Vector3d(max_class, max_class, max_class);
         }
-        cnt++;
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
@@ -47,6 +47,18 @@ class RGBDImage;
 class TriangleMesh;
 class VoxelGrid;
 
+/// \enum VoxelDownSampleMode
+///
+/// \brief How the points in a voxel are merged by voxel downsampling.
+enum class VoxelDownSampleMode {
+    /// Mean of the points and of each attribute.
+    Mean = 0,
+    /// The point with the smallest index, with its attributes.
+    First = 1,
+    /// The voxel center, with the attributes of the point closest to it.
+    Center = 2,
+};
+
 /// \class PointCloud
 ///
 /// \brief A point cloud consists of point coordinates, and optionally point
@@ -133,11 +145,16 @@ public:
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
-    /// Normals and colors are averaged if they exist.
+    /// With VoxelDownSampleMode::Mean, normals and colors are averaged if
+    /// they exist. The points are sorted by voxel and the voxels are reduced
+    /// in parallel.
     ///
     /// \param voxel_size Defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud.
-    std::shared_ptr<PointCloud> VoxelDownSample(double voxel_size) const;
+    /// \param mode How the points of a voxel are merged.
+    std::shared_ptr<PointCloud> VoxelDownSample(
+            double voxel_size,
+            VoxelDownSampleMode mode = VoxelDownSampleMode::Mean) const;
 
     /// \brief Function to downsample using geometry.PointCloud.VoxelDownSample
     ///
@@ -285,9 +302,15 @@ public:
     /// \param min_points Minimum number of points to form a cluster.
     /// \param print_progress If `true` the progress is visualized in the
     /// console.
+    /// \param low_memory If `true` the neighborhoods are searched again when
+    /// needed instead of being stored, and the clusters are merged in
+    /// parallel with a union-find over the core points. The memory use no
+    /// longer grows with the number of neighbors, and the labels are the
+    /// same.
     std::vector<int> ClusterDBSCAN(double eps,
                                    size_t min_points,
-                                   bool print_progress = false) const;
+                                   bool print_progress = false,
+                                   bool low_memory = false) const;
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
@@ -295,13 +318,47 @@ public:
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations. The iterations run
+    /// in parallel.
+    /// \param probability Required confidence, in (0, 1], that at least one
+    /// sample consisted of inliers only. It is not an inlier ratio. With w the
+    /// inlier ratio of the best plane so far, the number of iterations is
+    /// lowered to log(1 - probability) / log(1 - w^ransac_n).
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Segment several planes with RANSAC.
+    ///
+    /// Planes are segmented one after the other with SegmentPlane, each one
+    /// among the points not in the previous planes, until \p max_num_planes
+    /// planes are found, the largest plane left has fewer than
+    /// \p min_num_inliers inliers, or no sample of the points left spans a
+    /// plane. The point cloud is not copied between the rounds.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations for each plane.
+    /// \param max_num_planes Maximum number of planes.
+    /// \param min_num_inliers Minimum number of inliers of a plane.
+    /// \param probability Required confidence, in (0, 1], that at least one
+    /// sample of each round consisted of inliers only, which bounds the
+    /// iterations of the round as in SegmentPlane. It is not an inlier ratio.
+    /// \return Returns the plane models ax + by + cz + d = 0 and the indices
+    /// of their inliers, in the order they were segmented.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const int max_num_planes = 10,
+                  const size_t min_num_inliers = 100,
+                  const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -30,13 +30,117 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/ConcurrentUnionFind.h"
 
 namespace open3d {
 namespace geometry {
 
+// DBSCAN that searches the neighborhoods when it needs them instead of
+// storing them. The core points are found first, then merged with their core
+// neighbors in a union-find, and each border point finally joins the cluster
+// with the smallest label among its core neighbors. Clusters are labeled in
+// the order of their smallest core point, so the labels are the same as the
+// ones of the serial expansion.
+static std::vector<int> ClusterDBSCANLowMemory(const PointCloud &pcd,
+                                               double eps,
+                                               size_t min_points,
+                                               bool print_progress) {
+    const int num_points = int(pcd.points_.size());
+    KDTreeFlann kdtree(pcd);
+    utility::ConsoleProgressBar progress_bar(num_points, "Find Core Points",
+                                             print_progress);
+
+    std::vector<char> is_core(num_points);
+#pragma omp parallel
+    {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+#pragma omp for schedule(static)
+        for (int idx = 0; idx < num_points; ++idx) {
+            kdtree.SearchRadius(pcd.points_[idx], eps, indices, dists2);
+            is_core[idx] = indices.size() >= min_points;
+            if (print_progress) {
+#pragma omp critical
+                { ++progress_bar; }
+            }
+        }
+    }
+
+    // Neighborhoods are symmetric, so each pair of core points is merged from
+    // its larger index.
+    progress_bar.reset(num_points, "Merge Core Points", print_progress);
+    utility::ConcurrentUnionFind<int> union_find(num_points);
+#pragma omp parallel
+    {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+#pragma omp for schedule(dynamic, 256)
+        for (int idx = 0; idx < num_points; ++idx) {
+            if (is_core[idx]) {
+                kdtree.SearchRadius(pcd.points_[idx], eps, indices, dists2);
+                for (int nb : indices) {
+                    if (nb < idx && is_core[nb]) {
+                        union_find.Union(idx, nb);
+                    }
+                }
+            }
+            if (print_progress) {
+#pragma omp critical
+                { ++progress_bar; }
+            }
+        }
+    }
+
+    // The root of each cluster is its smallest core point.
+    std::vector<int> labels(num_points, -1);
+    int cluster_label = 0;
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx] && union_find.Find(idx) == idx) {
+            labels[idx] = cluster_label++;
+        }
+    }
+#pragma omp parallel for schedule(static)
+    for (int idx = 0; idx < num_points; ++idx) {
+        int root = is_core[idx] ? union_find.Find(idx) : idx;
+        if (root != idx) {
+            labels[idx] = labels[root];
+        }
+    }
+
+    progress_bar.reset(num_points, "Label Border Points", print_progress);
+#pragma omp parallel
+    {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+#pragma omp for schedule(dynamic, 256)
+        for (int idx = 0; idx < num_points; ++idx) {
+            if (!is_core[idx]) {
+                kdtree.SearchRadius(pcd.points_[idx], eps, indices, dists2);
+                for (int nb : indices) {
+                    if (is_core[nb] &&
+                        (labels[idx] == -1 || labels[nb] < labels[idx])) {
+                        labels[idx] = labels[nb];
+                    }
+                }
+            }
+            if (print_progress) {
+#pragma omp critical
+                { ++progress_bar; }
+            }
+        }
+    }
+
+    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+    return labels;
+}
+
 std::vector<int> PointCloud::ClusterDBSCAN(double eps,
                                            size_t min_points,
-                                           bool print_progress) const {
+                                           bool print_progress,
+                                           bool low_memory) const {
+    if (low_memory) {
+        return ClusterDBSCANLowMemory(*this, eps, min_points, print_progress);
+    }
     KDTreeFlann kdtree(*this);
 
     // precompute all neighbours
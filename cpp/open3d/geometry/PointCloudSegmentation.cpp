@@ -26,62 +26,46 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <numeric>
-#include <random>
 #include <unordered_set>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
 
-/// \class RANSACResult
-///
-/// \brief Stores the current best result in the RANSAC algorithm.
-class RANSACResult {
-public:
-    RANSACResult() : fitness_(0), inlier_rmse_(0) {}
-    ~RANSACResult() {}
-
-public:
-    double fitness_;
-    double inlier_rmse_;
-};
-
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
-RANSACResult EvaluateRANSACBasedOnDistance(
-        const std::vector<Eigen::Vector3d> &points,
-        const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
-    RANSACResult result;
-
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
-
+// Counts the points of \p indices closer than \p distance_threshold to the
+// plane model, and sums their distances to the plane in \p error. Gives up
+// and returns 0 as soon as the points left cannot reach \p best_num_inliers.
+static size_t CountPlaneInliers(const std::vector<Eigen::Vector3d> &points,
+                                const std::vector<size_t> &indices,
+                                const Eigen::Vector4d &plane_model,
+                                double distance_threshold,
+                                const std::atomic<size_t> &best_num_inliers,
+                                double &error) {
+    const size_t num_points = indices.size();
+    const Eigen::Vector3d normal = plane_model.head<3>();
+    size_t num_inliers = 0;
+    error = 0;
+    for (size_t k = 0; k < num_points; ++k) {
+        // The shared count is only read once in a while.
+        if (k % 1024 == 0 &&
+            num_inliers + (num_points - k) < best_num_inliers.load()) {
+            return 0;
+        }
+        double distance =
+                std::abs(normal.dot(points[indices[k]]) + plane_model(3));
         if (distance < distance_threshold) {
             error += distance;
-            inliers.emplace_back(idx);
+            ++num_inliers;
         }
     }
-
-    size_t inlier_num = inliers.size();
-    if (inlier_num == 0) {
-        result.fitness_ = 0;
-        result.inlier_rmse_ = 0;
-    } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
-        result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
-    }
-    return result;
+    return num_inliers;
 }
 
 // Find the plane such that the summed squared distance from the
@@ -132,72 +116,113 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
-
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
+// RANSAC plane fitting restricted to the points of \p indices. Threads draw
+// hypotheses from a shared counter. Whenever a thread finds a better plane,
+// with inlier ratio w, the number of hypotheses to test is lowered to
+// log(1 - probability) / log(1 - w^ransac_n), the number of samples needed
+// for one of them to consist of inliers only with confidence \p probability.
+// \p degenerate is set if no sample spans a plane, in which case every point
+// is an inlier of the zero plane.
+static std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneOnIndices(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &indices,
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        bool &degenerate) {
+    const size_t num_points = indices.size();
+    std::atomic<int> next_itr(0);
+    std::atomic<int> exit_itr(num_iterations);
+    std::atomic<size_t> best_num_inliers(0);
+    // Fitness is the inlier ratio, and RMSE the summed inlier distance over
+    // the square root of the inlier count.
+    double best_fitness = 0;
+    double best_inlier_rmse = 0;
     Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
 
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
+#pragma omp parallel
+    {
+        std::vector<size_t> sample(ransac_n);
+        double best_fitness_local = 0;
+        double best_inlier_rmse_local = 0;
+        Eigen::Vector4d best_plane_model_local = Eigen::Vector4d(0, 0, 0, 0);
 
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
+        for (int itr = next_itr++; itr < exit_itr; itr = next_itr++) {
+            for (int i = 0; i < ransac_n; ++i) {
+                do {
+                    sample[i] = indices[utility::UniformRandInt(
+                            0, static_cast<int>(num_points) - 1)];
+                } while (std::find(sample.begin(), sample.begin() + i,
+                                   sample[i]) != sample.begin() + i);
+            }
 
-    std::random_device rd;
-    std::mt19937 rng(rd());
+            // Fit model to the randomly selected points.
+            Eigen::Vector4d plane_model =
+                    ransac_n == 3 ? TriangleMesh::ComputeTrianglePlane(
+                                            points[sample[0]],
+                                            points[sample[1]],
+                                            points[sample[2]])
+                                  : GetPlaneFromPoints(points, sample);
+            if (plane_model.isZero(0)) {
+                continue;
+            }
 
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
+            double error;
+            size_t num_inliers =
+                    CountPlaneInliers(points, indices, plane_model,
+                                      distance_threshold, best_num_inliers,
+                                      error);
+            if (num_inliers == 0) {
+                continue;
+            }
+            double fitness = double(num_inliers) / double(num_points);
+            double inlier_rmse = error / std::sqrt(double(num_inliers));
+            if (fitness < best_fitness_local ||
+                (fitness == best_fitness_local &&
+                 inlier_rmse >= best_inlier_rmse_local)) {
+                continue;
+            }
+            best_fitness_local = fitness;
+            best_inlier_rmse_local = inlier_rmse;
+            best_plane_model_local = plane_model;
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
-        }
+            size_t best = best_num_inliers;
+            while (num_inliers > best &&
+                   !best_num_inliers.compare_exchange_weak(best,
+                                                           num_inliers)) {
+            }
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
+            // Update exit condition if necessary.
+            double exit_itr_d = std::log(1.0 - probability) /
+                                std::log(1.0 - std::pow(fitness, ransac_n));
+            if (exit_itr_d < double(num_iterations)) {
+                int exit_itr_new = static_cast<int>(std::ceil(exit_itr_d));
+                int exit_itr_old = exit_itr;
+                while (exit_itr_new < exit_itr_old &&
+                       !exit_itr.compare_exchange_weak(exit_itr_old,
+                                                       exit_itr_new)) {
+                }
+            }
         }
-
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+#pragma omp critical
+        {
+            if (best_fitness_local > best_fitness ||
+                (best_fitness_local == best_fitness &&
+                 best_inlier_rmse_local < best_inlier_rmse)) {
+                best_fitness = best_fitness_local;
+                best_inlier_rmse = best_inlier_rmse_local;
+                best_plane_model = best_plane_model_local;
+            }
         }
     }
 
+    degenerate = best_plane_model.isZero(0);
+
     // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
+    std::vector<size_t> inliers;
+    for (size_t idx : indices) {
+        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
                               1);
         double distance = std::abs(best_plane_model.dot(point));
 
@@ -207,12 +232,91 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     }
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+    best_plane_model = GetPlaneFromPoints(points, inliers);
 
-    utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
-                      inliers.size(), result.fitness_, result.inlier_rmse_);
+    utility::LogDebug(
+            "RANSAC exits at {:d}-th iteration | Inliers: {:d}, Fitness: "
+            "{:e}, RMSE: {:e}",
+            std::min(exit_itr.load(), num_iterations), inliers.size(),
+            best_fitness, best_inlier_rmse);
     return std::make_tuple(best_plane_model, inliers);
 }
 
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
+    // Return if ransac_n is less than the required plane model parameters.
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (points_.size() < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be in (0, 1], but got {}.",
+                          probability);
+    }
+
+    std::vector<size_t> indices(points_.size());
+    std::iota(std::begin(indices), std::end(indices), 0);
+    bool degenerate;
+    return SegmentPlaneOnIndices(points_, indices, distance_threshold,
+                                 ransac_n, num_iterations, probability,
+                                 degenerate);
+}
+
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const int max_num_planes /* = 10 */,
+                          const size_t min_num_inliers /* = 100 */,
+                          const double probability /* = 0.99999999 */) const {
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be in (0, 1], but got {}.",
+                          probability);
+    }
+
+    // The points left are tracked by index, so that the cloud is never
+    // copied between rounds.
+    std::vector<size_t> remaining(points_.size());
+    std::iota(std::begin(remaining), std::end(remaining), 0);
+    std::vector<char> is_inlier(points_.size(), 0);
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    while (int(planes.size()) < max_num_planes &&
+           remaining.size() >= std::max(size_t(ransac_n), min_num_inliers)) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        bool degenerate;
+        std::tie(plane_model, inliers) = SegmentPlaneOnIndices(
+                points_, remaining, distance_threshold, ransac_n,
+                num_iterations, probability, degenerate);
+        // A round without a plane would take every point left.
+        if (degenerate || plane_model.isZero(0) || inliers.empty() ||
+            inliers.size() < min_num_inliers) {
+            break;
+        }
+        for (size_t idx : inliers) {
+            is_inlier[idx] = 1;
+        }
+        remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+                                       [&](size_t idx) {
+                                           return is_inlier[idx] != 0;
+                                       }),
+                        remaining.end());
+        planes.emplace_back(plane_model, std::move(inliers));
+    }
+    utility::LogDebug("SegmentPlanes | Planes: {:d}, Points left: {:d}",
+                      planes.size(), remaining.size());
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
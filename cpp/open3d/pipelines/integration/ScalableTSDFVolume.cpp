@@ -49,7 +49,10 @@ ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
 
 ScalableTSDFVolume::~ScalableTSDFVolume() {}
 
-void ScalableTSDFVolume::Reset() { volume_units_.clear(); }
+void ScalableTSDFVolume::Reset() {
+    volume_units_.clear();
+    voxel_pool_.clear();
+}
 
 void ScalableTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
@@ -94,123 +97,139 @@ void ScalableTSDFVolume::Integrate(
     auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
+
+    // Collect the units touched by the frame, each thread deduplicating its
+    // own share of the points first.
     std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+            touched_volume_units;
+    const Eigen::Vector3d trunc(sdf_trunc_, sdf_trunc_, sdf_trunc_);
+    const int num_points = int(pointcloud->points_.size());
+#pragma omp parallel
+    {
+        std::unordered_set<Eigen::Vector3i,
+                           utility::hash_eigen<Eigen::Vector3i>>
+                touched_local;
+#pragma omp for nowait
+        for (int i = 0; i < num_points; i++) {
+            const Eigen::Vector3d &point = pointcloud->points_[i];
+            Eigen::Vector3i min_bound = LocateVolumeUnit(point - trunc);
+            Eigen::Vector3i max_bound = LocateVolumeUnit(point + trunc);
+            for (int x = min_bound(0); x <= max_bound(0); x++) {
+                for (int y = min_bound(1); y <= max_bound(1); y++) {
+                    for (int z = min_bound(2); z <= max_bound(2); z++) {
+                        touched_local.insert(Eigen::Vector3i(x, y, z));
                     }
                 }
             }
         }
+#pragma omp critical(ScalableTSDFVolume_Integrate)
+        touched_volume_units.insert(touched_local.begin(),
+                                    touched_local.end());
+    }
+
+    std::vector<const VolumeUnit *> units;
+    units.reserve(touched_volume_units.size());
+    for (const Eigen::Vector3i &index : touched_volume_units) {
+        units.push_back(&OpenVolumeUnit(index));
+    }
+
+    // Integrate all the touched units in one parallel region. The units are
+    // independent, and each one is integrated by a single thread.
+    const TSDFIntegrationKernel kernel(
+            image, intrinsic, extrinsic, *depth2cameradistance,
+            volume_unit_length_ / volume_unit_resolution_, sdf_trunc_,
+            color_type_);
+    const int num_units = int(units.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < num_units; i++) {
+        const VolumeUnit &unit = *units[i];
+        geometry::TSDFVoxel *voxels = GetVoxels(unit);
+        const Eigen::Vector3d origin =
+                unit.index_.cast<double>() * volume_unit_length_;
+        for (int x = 0; x < volume_unit_resolution_; x++) {
+            for (int y = 0; y < volume_unit_resolution_; y++) {
+                kernel.IntegrateColumn(
+                        voxels + IndexOf(Eigen::Vector3i(x, y, 0)),
+                        volume_unit_resolution_, x, y, origin);
+            }
+        }
     }
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
-    float w0, w1, f0, f1;
-    Eigen::Vector3f c0, c1;
+    float w0 = 0.0f, w1 = 0.0f, f0 = 0.0f, f1 = 0.0f;
+    Eigen::Vector3f c0 = Eigen::Vector3f::Zero(), c1 = Eigen::Vector3f::Zero();
     for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
-                        if (color_type_ != TSDFVolumeColorType::NoColor)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
-                        if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
-                            Eigen::Vector3d p0 =
-                                    Eigen::Vector3d(half_voxel_length +
-                                                            voxel_length_ * x,
-                                                    half_voxel_length +
-                                                            voxel_length_ * y,
-                                                    half_voxel_length +
-                                                            voxel_length_ * z) +
-                                    index0.cast<double>() * volume_unit_length_;
-                            for (int i = 0; i < 3; i++) {
-                                Eigen::Vector3d p1 = p0;
-                                Eigen::Vector3i idx1 = idx0;
-                                Eigen::Vector3i index1 = index0;
-                                p1(i) += voxel_length_;
-                                idx1(i) += 1;
-                                if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .tsdf_;
+        const geometry::TSDFVoxel *voxels0 = GetVoxels(unit.second);
+        const auto &index0 = unit.second.index_;
+        for (int x = 0; x < volume_unit_resolution_; x++) {
+            for (int y = 0; y < volume_unit_resolution_; y++) {
+                for (int z = 0; z < volume_unit_resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    w0 = voxels0[IndexOf(idx0)].weight_;
+                    f0 = voxels0[IndexOf(idx0)].tsdf_;
+                    if (color_type_ != TSDFVolumeColorType::NoColor)
+                        c0 = voxels0[IndexOf(idx0)].color_.cast<float>();
+                    if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
+                        Eigen::Vector3d p0 =
+                                Eigen::Vector3d(
+                                        half_voxel_length + voxel_length_ * x,
+                                        half_voxel_length + voxel_length_ * y,
+                                        half_voxel_length + voxel_length_ * z) +
+                                index0.cast<double>() * volume_unit_length_;
+                        for (int i = 0; i < 3; i++) {
+                            Eigen::Vector3d p1 = p0;
+                            Eigen::Vector3i idx1 = idx0;
+                            Eigen::Vector3i index1 = index0;
+                            p1(i) += voxel_length_;
+                            idx1(i) += 1;
+                            if (idx1(i) < volume_unit_resolution_) {
+                                w1 = voxels0[IndexOf(idx1)].weight_;
+                                f1 = voxels0[IndexOf(idx1)].tsdf_;
+                                if (color_type_ !=
+                                    TSDFVolumeColorType::NoColor)
+                                    c1 = voxels0[IndexOf(idx1)]
+                                                 .color_.cast<float>();
+                            } else {
+                                idx1(i) -= volume_unit_resolution_;
+                                index1(i) += 1;
+                                auto unit_itr = volume_units_.find(index1);
+                                if (unit_itr == volume_units_.end()) {
+                                    w1 = 0.0f;
+                                    f1 = 0.0f;
+                                } else {
+                                    const geometry::TSDFVoxel *voxels1 =
+                                            GetVoxels(unit_itr->second);
+                                    w1 = voxels1[IndexOf(idx1)].weight_;
+                                    f1 = voxels1[IndexOf(idx1)].tsdf_;
                                     if (color_type_ !=
                                         TSDFVolumeColorType::NoColor)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
-                                                                     idx1)]
+                                        c1 = voxels1[IndexOf(idx1)]
                                                      .color_.cast<float>();
-                                } else {
-                                    idx1(i) -= volume0.resolution_;
-                                    index1(i) += 1;
-                                    auto unit_itr = volume_units_.find(index1);
-                                    if (unit_itr == volume_units_.end()) {
-                                        w1 = 0.0f;
-                                        f1 = 0.0f;
-                                    } else {
-                                        const auto &volume1 =
-                                                *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
-                                        if (color_type_ !=
-                                            TSDFVolumeColorType::NoColor)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
-                                    }
                                 }
-                                if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
-                                    f0 * f1 < 0) {
-                                    float r0 = std::fabs(f0);
-                                    float r1 = std::fabs(f1);
-                                    Eigen::Vector3d p = p0;
-                                    p(i) = (p0(i) * r1 + p1(i) * r0) /
-                                           (r0 + r1);
-                                    pointcloud->points_.push_back(p);
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1) / 255.0f)
-                                                        .cast<double>());
-                                    } else if (color_type_ ==
-                                               TSDFVolumeColorType::Gray32) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1))
-                                                        .cast<double>());
-                                    }
-                                    // has_normal
-                                    pointcloud->normals_.push_back(
-                                            GetNormalAt(p));
+                            }
+                            if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
+                                f0 * f1 < 0) {
+                                float r0 = std::fabs(f0);
+                                float r1 = std::fabs(f1);
+                                Eigen::Vector3d p = p0;
+                                p(i) = (p0(i) * r1 + p1(i) * r0) / (r0 + r1);
+                                pointcloud->points_.push_back(p);
+                                if (color_type_ == TSDFVolumeColorType::RGB8) {
+                                    pointcloud->colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1) /
+                                             255.0f)
+                                                    .cast<double>());
+                                } else if (color_type_ ==
+                                           TSDFVolumeColorType::Gray32) {
+                                    pointcloud->colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1))
+                                                    .cast<double>());
                                 }
+                                // has_normal
+                                pointcloud->normals_.push_back(GetNormalAt(p));
                             }
                         }
                     }
@@ -234,136 +253,113 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
             edgeindex_to_vertexindex;
     int edge_to_index[12];
     for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
+        const geometry::TSDFVoxel *voxels0 = GetVoxels(unit.second);
+        const auto &index0 = unit.second.index_;
+        for (int x = 0; x < volume_unit_resolution_; x++) {
+            for (int y = 0; y < volume_unit_resolution_; y++) {
+                for (int z = 0; z < volume_unit_resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    int cube_index = 0;
+                    float w[8];
+                    float f[8];
+                    Eigen::Vector3d c[8];
+                    for (int i = 0; i < 8; i++) {
+                        Eigen::Vector3i index1 = index0;
+                        Eigen::Vector3i idx1 = idx0 + shift[i];
+                        const geometry::TSDFVoxel *voxels1 = voxels0;
+                        if (idx1(0) >= volume_unit_resolution_ ||
+                            idx1(1) >= volume_unit_resolution_ ||
+                            idx1(2) >= volume_unit_resolution_) {
+                            for (int j = 0; j < 3; j++) {
+                                if (idx1(j) >= volume_unit_resolution_) {
+                                    idx1(j) -= volume_unit_resolution_;
+                                    index1(j) += 1;
                                 }
                             }
+                            auto unit_itr1 = volume_units_.find(index1);
+                            voxels1 = unit_itr1 == volume_units_.end()
+                                              ? nullptr
+                                              : GetVoxels(unit_itr1->second);
                         }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
+                        if (voxels1 == nullptr) {
+                            w[i] = 0.0f;
+                            f[i] = 0.0f;
+                        } else {
+                            const geometry::TSDFVoxel &voxel =
+                                    voxels1[IndexOf(idx1)];
+                            w[i] = voxel.weight_;
+                            f[i] = voxel.tsdf_;
+                            if (color_type_ == TSDFVolumeColorType::RGB8)
+                                c[i] = voxel.color_ / 255.0;
+                            else if (color_type_ ==
+                                     TSDFVolumeColorType::Gray32)
+                                c[i] = voxel.color_;
                         }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
+                        if (w[i] == 0.0f) {
+                            cube_index = 0;
+                            break;
+                        } else {
+                            if (f[i] < 0.0f) {
+                                cube_index |= (1 << i);
                             }
                         }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
+                    }
+                    if (cube_index == 0 || cube_index == 255) {
+                        continue;
+                    }
+                    for (int i = 0; i < 12; i++) {
+                        if (edge_table[cube_index] & (1 << i)) {
+                            Eigen::Vector4i edge_index =
+                                    Eigen::Vector4i(index0(0), index0(1),
+                                                    index0(2), 0) *
+                                            volume_unit_resolution_ +
+                                    Eigen::Vector4i(x, y, z, 0) +
+                                    edge_shift[i];
+                            if (edgeindex_to_vertexindex.find(edge_index) ==
+                                edgeindex_to_vertexindex.end()) {
+                                edge_to_index[i] =
+                                        (int)mesh->vertices_.size();
+                                edgeindex_to_vertexindex[edge_index] =
+                                        (int)mesh->vertices_.size();
+                                Eigen::Vector3d pt(
+                                        half_voxel_length +
+                                                voxel_length_ *
+                                                        edge_index(0),
+                                        half_voxel_length +
+                                                voxel_length_ *
+                                                        edge_index(1),
+                                        half_voxel_length +
+                                                voxel_length_ *
+                                                        edge_index(2));
+                                double f0 = std::abs(
+                                        (double)f[edge_to_vert[i][0]]);
+                                double f1 = std::abs(
+                                        (double)f[edge_to_vert[i][1]]);
+                                pt(edge_index(3)) +=
+                                        f0 * voxel_length_ / (f0 + f1);
+                                mesh->vertices_.push_back(pt);
+                                if (color_type_ !=
+                                    TSDFVolumeColorType::NoColor) {
+                                    const auto &c0 = c[edge_to_vert[i][0]];
+                                    const auto &c1 = c[edge_to_vert[i][1]];
+                                    mesh->vertex_colors_.push_back(
+                                            (f1 * c0 + f0 * c1) /
+                                            (f0 + f1));
+                                }
+                            } else {
+                                edge_to_index[i] = edgeindex_to_vertexindex
+                                        [edge_index];
+                            }
                         }
                     }
+                    for (int i = 0; tri_table[cube_index][i] != -1;
+                         i += 3) {
+                        mesh->triangles_.push_back(Eigen::Vector3i(
+                                edge_to_index[tri_table[cube_index][i]],
+                                edge_to_index[tri_table[cube_index][i + 2]],
+                                edge_to_index[tri_table[cube_index]
+                                                       [i + 1]]));
+                    }
                 }
             }
         }
@@ -374,25 +370,47 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
 std::shared_ptr<geometry::PointCloud>
 ScalableTSDFVolume::ExtractVoxelPointCloud() {
     auto voxel = std::make_shared<geometry::PointCloud>();
-    for (auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            auto v = unit.second.volume_->ExtractVoxelPointCloud();
-            *voxel += *v;
+    const double unit_voxel_length =
+            volume_unit_length_ / volume_unit_resolution_;
+    const double half_voxel_length = unit_voxel_length * 0.5;
+    for (const auto &unit : volume_units_) {
+        const geometry::TSDFVoxel *voxels = GetVoxels(unit.second);
+        const Eigen::Vector3d origin =
+                unit.second.index_.cast<double>() * volume_unit_length_;
+        for (int x = 0; x < volume_unit_resolution_; x++) {
+            for (int y = 0; y < volume_unit_resolution_; y++) {
+                for (int z = 0; z < volume_unit_resolution_; z++) {
+                    const geometry::TSDFVoxel &v =
+                            voxels[IndexOf(Eigen::Vector3i(x, y, z))];
+                    if (v.weight_ != 0.0f && v.tsdf_ < 0.98f &&
+                        v.tsdf_ >= -0.98f) {
+                        Eigen::Vector3d pt(
+                                half_voxel_length + unit_voxel_length * x,
+                                half_voxel_length + unit_voxel_length * y,
+                                half_voxel_length + unit_voxel_length * z);
+                        voxel->points_.push_back(pt + origin);
+                        double c = (v.tsdf_ + 1.0) * 0.5;
+                        voxel->colors_.push_back(Eigen::Vector3d(c, c, c));
+                    }
+                }
+            }
         }
     }
     return voxel;
 }
 
-std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
+ScalableTSDFVolume::VolumeUnit &ScalableTSDFVolume::OpenVolumeUnit(
         const Eigen::Vector3i &index) {
     auto &unit = volume_units_[index];
-    if (!unit.volume_) {
-        unit.volume_.reset(new UniformTSDFVolume(
-                volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
-                color_type_, index.cast<double>() * volume_unit_length_));
+    if (unit.pool_index_ < 0) {
+        unit.pool_index_ = int(volume_units_.size()) - 1;
         unit.index_ = index;
+        if (unit.pool_index_ % kVolumeUnitsPerPage == 0) {
+            voxel_pool_.emplace_back(kVolumeUnitsPerPage *
+                                     GetNumVoxelsPerUnit());
+        }
     }
-    return unit.volume_;
+    return unit;
 }
 
 Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
@@ -416,7 +434,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
     if (unit_itr == volume_units_.end()) {
         return 0.0;
     }
-    const auto &volume0 = *unit_itr->second.volume_;
+    const geometry::TSDFVoxel *voxels0 = GetVoxels(unit_itr->second);
     Eigen::Vector3i idx0;
     Eigen::Vector3d p_grid =
             (p_locate - index0.cast<double>() * volume_unit_length_) /
@@ -435,7 +453,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
         if (idx1(0) < volume_unit_resolution_ &&
             idx1(1) < volume_unit_resolution_ &&
             idx1(2) < volume_unit_resolution_) {
-            f[i] = volume0.voxels_[volume0.IndexOf(idx1)].tsdf_;
+            f[i] = voxels0[IndexOf(idx1)].tsdf_;
         } else {
             for (int j = 0; j < 3; j++) {
                 if (idx1(j) >= volume_unit_resolution_) {
@@ -447,8 +465,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
             if (unit_itr1 == volume_units_.end()) {
                 f[i] = 0.0f;
             } else {
-                const auto &volume1 = *unit_itr1->second.volume_;
-                f[i] = volume1.voxels_[volume1.IndexOf(idx1)].tsdf_;
+                f[i] = GetVoxels(unit_itr1->second)[IndexOf(idx1)].tsdf_;
             }
         }
     }
@@ -28,16 +28,16 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/pipelines/integration/TSDFVolume.h"
+#include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace pipelines {
 namespace integration {
 
-class UniformTSDFVolume;
-
 /// The ScalableTSDFVolume implements a more memory efficient data structure for
 /// volumetric integration.
 ///
@@ -56,17 +56,26 @@ class UniformTSDFVolume;
 /// normal and producing a smooth surface output. The carving is great in
 /// removing outlier structures like floating noise pixels and bumps along
 /// structure edges.
+///
+/// The voxels of all the volume units live in a pool of pages holding
+/// kVolumeUnitsPerPage units each. Integrate() first collects the units
+/// touched by a frame in parallel, then integrates all of them in a single
+/// parallel loop over the units.
 class ScalableTSDFVolume : public TSDFVolume {
 public:
     struct VolumeUnit {
     public:
-        VolumeUnit() : volume_(NULL) {}
+        VolumeUnit() : pool_index_(-1) {}
 
     public:
-        std::shared_ptr<UniformTSDFVolume> volume_;
+        /// Position of the unit's voxels in the voxel pool.
+        int pool_index_;
         Eigen::Vector3i index_;
     };
 
+    /// Number of volume units allocated at once by the voxel pool.
+    static constexpr int kVolumeUnitsPerPage = 16;
+
 public:
     ScalableTSDFVolume(double voxel_length,
                        double sdf_trunc,
@@ -98,19 +107,48 @@ public:
                        utility::hash_eigen<Eigen::Vector3i>>
             volume_units_;
 
+    /// Returns the resolution^3 voxels of \p unit, indexed like
+    /// UniformTSDFVolume::IndexOf().
+    geometry::TSDFVoxel *GetVoxels(const VolumeUnit &unit) {
+        return voxel_pool_[unit.pool_index_ / kVolumeUnitsPerPage].data() +
+               size_t(unit.pool_index_ % kVolumeUnitsPerPage) *
+                       GetNumVoxelsPerUnit();
+    }
+    const geometry::TSDFVoxel *GetVoxels(const VolumeUnit &unit) const {
+        return voxel_pool_[unit.pool_index_ / kVolumeUnitsPerPage].data() +
+               size_t(unit.pool_index_ % kVolumeUnitsPerPage) *
+                       GetNumVoxelsPerUnit();
+    }
+
 private:
+    size_t GetNumVoxelsPerUnit() const {
+        return size_t(volume_unit_resolution_) * volume_unit_resolution_ *
+               volume_unit_resolution_;
+    }
+
+    int IndexOf(const Eigen::Vector3i &xyz) const {
+        return (xyz(0) * volume_unit_resolution_ + xyz(1)) *
+                       volume_unit_resolution_ +
+               xyz(2);
+    }
+
     Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) {
         return Eigen::Vector3i((int)std::floor(point(0) / volume_unit_length_),
                                (int)std::floor(point(1) / volume_unit_length_),
                                (int)std::floor(point(2) / volume_unit_length_));
     }
 
-    std::shared_ptr<UniformTSDFVolume> OpenVolumeUnit(
-            const Eigen::Vector3i &index);
+    /// Returns the unit at \p index, taking its voxels from the pool if the
+    /// unit is new.
+    VolumeUnit &OpenVolumeUnit(const Eigen::Vector3i &index);
 
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
+
+    /// Pages of kVolumeUnitsPerPage * resolution^3 voxels. Pages are never
+    /// reallocated, so opening a unit does not move the voxels of the others.
+    std::vector<std::vector<geometry::TSDFVoxel>> voxel_pool_;
 };
 
 }  // namespace integration
@@ -38,6 +38,91 @@ namespace open3d {
 namespace pipelines {
 namespace integration {
 
+TSDFIntegrationKernel::TSDFIntegrationKernel(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const geometry::Image &depth_to_camera_distance_multiplier,
+        double voxel_length,
+        double sdf_trunc,
+        TSDFVolumeColorType color_type)
+    : image_(image),
+      depth_to_camera_distance_multiplier_(depth_to_camera_distance_multiplier),
+      color_type_(color_type),
+      fx_(static_cast<float>(intrinsic.GetFocalLength().first)),
+      fy_(static_cast<float>(intrinsic.GetFocalLength().second)),
+      cx_(static_cast<float>(intrinsic.GetPrincipalPoint().first)),
+      cy_(static_cast<float>(intrinsic.GetPrincipalPoint().second)),
+      extrinsic_f_(extrinsic.cast<float>()),
+      voxel_length_f_(static_cast<float>(voxel_length)),
+      half_voxel_length_f_(voxel_length_f_ * 0.5f),
+      sdf_trunc_f_(static_cast<float>(sdf_trunc)),
+      sdf_trunc_inv_f_(1.0f / sdf_trunc_f_),
+      safe_width_f_(intrinsic.width_ - 0.0001f),
+      safe_height_f_(intrinsic.height_ - 0.0001f) {
+    extrinsic_scaled_f_ = extrinsic_f_ * voxel_length_f_;
+}
+
+void TSDFIntegrationKernel::IntegrateColumn(
+        geometry::TSDFVoxel *voxels,
+        int resolution,
+        int x,
+        int y,
+        const Eigen::Vector3d &origin) const {
+    Eigen::Vector4f pt_3d_homo(
+            float(half_voxel_length_f_ + voxel_length_f_ * x + origin(0)),
+            float(half_voxel_length_f_ + voxel_length_f_ * y + origin(1)),
+            float(half_voxel_length_f_ + origin(2)), 1.f);
+    Eigen::Vector4f pt_camera = extrinsic_f_ * pt_3d_homo;
+    for (int z = 0; z < resolution; z++,
+             pt_camera(0) += extrinsic_scaled_f_(0, 2),
+             pt_camera(1) += extrinsic_scaled_f_(1, 2),
+             pt_camera(2) += extrinsic_scaled_f_(2, 2)) {
+        // Skip if negative depth after projection
+        if (pt_camera(2) <= 0) {
+            continue;
+        }
+        // Skip if x-y coordinate not in range
+        float u_f = pt_camera(0) * fx_ / pt_camera(2) + cx_ + 0.5f;
+        float v_f = pt_camera(1) * fy_ / pt_camera(2) + cy_ + 0.5f;
+        if (!(u_f >= 0.0001f && u_f < safe_width_f_ && v_f >= 0.0001f &&
+              v_f < safe_height_f_)) {
+            continue;
+        }
+        // Skip if negative depth in depth image
+        int u = (int)u_f;
+        int v = (int)v_f;
+        float d = *image_.depth_.PointerAt<float>(u, v);
+        if (d <= 0.0f) {
+            continue;
+        }
+
+        geometry::TSDFVoxel &voxel = voxels[z];
+        float sdf = (d - pt_camera(2)) *
+                    (*depth_to_camera_distance_multiplier_.PointerAt<float>(
+                            u, v));
+        if (sdf > -sdf_trunc_f_) {
+            // integrate
+            float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f_);
+            voxel.tsdf_ = (voxel.tsdf_ * voxel.weight_ + tsdf) /
+                          (voxel.weight_ + 1.0f);
+            if (color_type_ == TSDFVolumeColorType::RGB8) {
+                const uint8_t *rgb = image_.color_.PointerAt<uint8_t>(u, v, 0);
+                Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
+                voxel.color_ = (voxel.color_ * voxel.weight_ + rgb_f) /
+                               (voxel.weight_ + 1.0f);
+            } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+                const float *intensity =
+                        image_.color_.PointerAt<float>(u, v, 0);
+                voxel.color_ =
+                        (voxel.color_.array() * voxel.weight_ + (*intensity)) /
+                        (voxel.weight_ + 1.0f);
+            }
+            voxel.weight_ += 1.0f;
+        }
+    }
+}
+
 UniformTSDFVolume::UniformTSDFVolume(
         double length,
         int resolution,
@@ -299,18 +384,9 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const geometry::Image &depth_to_camera_distance_multiplier) {
-    const float fx = static_cast<float>(intrinsic.GetFocalLength().first);
-    const float fy = static_cast<float>(intrinsic.GetFocalLength().second);
-    const float cx = static_cast<float>(intrinsic.GetPrincipalPoint().first);
-    const float cy = static_cast<float>(intrinsic.GetPrincipalPoint().second);
-    const Eigen::Matrix4f extrinsic_f = extrinsic.cast<float>();
-    const float voxel_length_f = static_cast<float>(voxel_length_);
-    const float half_voxel_length_f = voxel_length_f * 0.5f;
-    const float sdf_trunc_f = static_cast<float>(sdf_trunc_);
-    const float sdf_trunc_inv_f = 1.0f / sdf_trunc_f;
-    const Eigen::Matrix4f extrinsic_scaled_f = extrinsic_f * voxel_length_f;
-    const float safe_width_f = intrinsic.width_ - 0.0001f;
-    const float safe_height_f = intrinsic.height_ - 0.0001f;
+    const TSDFIntegrationKernel kernel(
+            image, intrinsic, extrinsic, depth_to_camera_distance_multiplier,
+            voxel_length_, sdf_trunc_, color_type_);
 
 #ifdef _WIN32
 #pragma omp parallel for schedule(static)
@@ -319,69 +395,8 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
 #endif
     for (int x = 0; x < resolution_; x++) {
         for (int y = 0; y < resolution_; y++) {
-            Eigen::Vector4f pt_3d_homo(float(half_voxel_length_f +
-                                             voxel_length_f * x + origin_(0)),
-                                       float(half_voxel_length_f +
-                                             voxel_length_f * y + origin_(1)),
-                                       float(half_voxel_length_f + origin_(2)),
-                                       1.f);
-            Eigen::Vector4f pt_camera = extrinsic_f * pt_3d_homo;
-            for (int z = 0; z < resolution_; z++,
-                     pt_camera(0) += extrinsic_scaled_f(0, 2),
-                     pt_camera(1) += extrinsic_scaled_f(1, 2),
-                     pt_camera(2) += extrinsic_scaled_f(2, 2)) {
-                // Skip if negative depth after projection
-                if (pt_camera(2) <= 0) {
-                    continue;
-                }
-                // Skip if x-y coordinate not in range
-                float u_f = pt_camera(0) * fx / pt_camera(2) + cx + 0.5f;
-                float v_f = pt_camera(1) * fy / pt_camera(2) + cy + 0.5f;
-                if (!(u_f >= 0.0001f && u_f < safe_width_f && v_f >= 0.0001f &&
-                      v_f < safe_height_f)) {
-                    continue;
-                }
-                // Skip if negative depth in depth image
-                int u = (int)u_f;
-                int v = (int)v_f;
-                float d = *image.depth_.PointerAt<float>(u, v);
-                if (d <= 0.0f) {
-                    continue;
-                }
-
-                int v_ind = IndexOf(x, y, z);
-                float sdf =
-                        (d - pt_camera(2)) *
-                        (*depth_to_camera_distance_multiplier.PointerAt<float>(
-                                u, v));
-                if (sdf > -sdf_trunc_f) {
-                    // integrate
-                    float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
-                             tsdf) /
-                            (voxels_[v_ind].weight_ + 1.0f);
-                    if (color_type_ == TSDFVolumeColorType::RGB8) {
-                        const uint8_t *rgb =
-                                image.color_.PointerAt<uint8_t>(u, v, 0);
-                        Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
-                                 rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                        const float *intensity =
-                                image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
-                                 (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    }
-                    voxels_[v_ind].weight_ += 1.0f;
-                }
-            }
+            kernel.IntegrateColumn(&voxels_[IndexOf(x, y, 0)], resolution_, x,
+                                   y, origin_);
         }
     }
 }
@@ -51,6 +51,53 @@ public:
 namespace pipelines {
 namespace integration {
 
+/// \class TSDFIntegrationKernel
+///
+/// \brief Scan-converts one RGBD frame into TSDF voxels, one z column at a
+/// time.
+///
+/// The per-frame constants are computed once, so that the same kernel can be
+/// applied to a UniformTSDFVolume or to many volume units of a
+/// ScalableTSDFVolume. IntegrateColumn() is single-threaded and the caller
+/// picks the loop to parallelize.
+class TSDFIntegrationKernel {
+public:
+    TSDFIntegrationKernel(
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const geometry::Image &depth_to_camera_distance_multiplier,
+            double voxel_length,
+            double sdf_trunc,
+            TSDFVolumeColorType color_type);
+
+    /// Integrates the \p resolution voxels (x, y, 0..resolution - 1) of a
+    /// block with its corner at \p origin. \p voxels points to voxel
+    /// (x, y, 0), and the z neighbors are contiguous.
+    void IntegrateColumn(geometry::TSDFVoxel *voxels,
+                         int resolution,
+                         int x,
+                         int y,
+                         const Eigen::Vector3d &origin) const;
+
+private:
+    const geometry::RGBDImage &image_;
+    const geometry::Image &depth_to_camera_distance_multiplier_;
+    TSDFVolumeColorType color_type_;
+    float fx_;
+    float fy_;
+    float cx_;
+    float cy_;
+    Eigen::Matrix4f extrinsic_f_;
+    Eigen::Matrix4f extrinsic_scaled_f_;
+    float voxel_length_f_;
+    float half_voxel_length_f_;
+    float sdf_trunc_f_;
+    float sdf_trunc_inv_f_;
+    float safe_width_f_;
+    float safe_height_f_;
+};
+
 /// \class UniformTSDFVolume
 ///
 /// \brief UniformTSDFVolume implements the classic TSDF volume with uniform
@@ -47,27 +47,34 @@ public:
     std::vector<Eigen::Vector3d> color_gradient_;
 };
 
-std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
-        const geometry::PointCloud &target,
-        const geometry::KDTreeSearchParamHybrid &search_param) {
-    utility::LogDebug("InitializePointCloudForColoredICP");
-
-    geometry::KDTreeFlann tree;
-    tree.SetGeometry(target);
-
+std::shared_ptr<PointCloudForColoredICP> CopyPointCloudForColoredICP(
+        const geometry::PointCloud &target) {
+    if (!target.HasNormals() || !target.HasColors()) {
+        utility::LogError(
+                "Colored ICP requires a target PointCloud with normals and "
+                "colors.");
+    }
     auto output = std::make_shared<PointCloudForColoredICP>();
     output->colors_ = target.colors_;
     output->normals_ = target.normals_;
     output->points_ = target.points_;
+    return output;
+}
+
+void ComputeColorGradients(
+        PointCloudForColoredICP &output,
+        const geometry::KDTreeFlann &tree,
+        const geometry::KDTreeSearchParamHybrid &search_param) {
+    utility::LogDebug("ComputeColorGradients");
 
-    size_t n_points = output->points_.size();
-    output->color_gradient_.resize(n_points, Eigen::Vector3d::Zero());
+    size_t n_points = output.points_.size();
+    output.color_gradient_.resize(n_points, Eigen::Vector3d::Zero());
 
     for (size_t k = 0; k < n_points; k++) {
-        const Eigen::Vector3d &vt = output->points_[k];
-        const Eigen::Vector3d &nt = output->normals_[k];
-        double it = (output->colors_[k](0) + output->colors_[k](1) +
-                     output->colors_[k](2)) /
+        const Eigen::Vector3d &vt = output.points_[k];
+        const Eigen::Vector3d &nt = output.normals_[k];
+        double it = (output.colors_[k](0) + output.colors_[k](1) +
+                     output.colors_[k](2)) /
                     3.0;
 
         std::vector<int> point_idx;
@@ -83,11 +90,11 @@ std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
             b.setZero();
             for (size_t i = 1; i < nn; i++) {
                 int P_adj_idx = point_idx[i];
-                Eigen::Vector3d vt_adj = output->points_[P_adj_idx];
+                Eigen::Vector3d vt_adj = output.points_[P_adj_idx];
                 Eigen::Vector3d vt_proj = vt_adj - (vt_adj - vt).dot(nt) * nt;
-                double it_adj = (output->colors_[P_adj_idx](0) +
-                                 output->colors_[P_adj_idx](1) +
-                                 output->colors_[P_adj_idx](2)) /
+                double it_adj = (output.colors_[P_adj_idx](0) +
+                                 output.colors_[P_adj_idx](1) +
+                                 output.colors_[P_adj_idx](2)) /
                                 3.0;
                 A(i - 1, 0) = (vt_proj(0) - vt(0));
                 A(i - 1, 1) = (vt_proj(1) - vt(1));
@@ -105,15 +112,25 @@ std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
             std::tie(is_success, x) = utility::SolveLinearSystemPSD(
                     A.transpose() * A, A.transpose() * b);
             if (is_success) {
-                output->color_gradient_[k] = x;
+                output.color_gradient_[k] = x;
             }
         }
     }
-    return output;
 }
 
 }  // namespace
 
+ColoredICPTarget::ColoredICPTarget(const geometry::PointCloud &target,
+                                   double max_distance)
+    : RegistrationTarget(CopyPointCloudForColoredICP(target)) {
+    // target_ is the PointCloudForColoredICP created above.
+    auto target_c = std::const_pointer_cast<PointCloudForColoredICP>(
+            std::static_pointer_cast<const PointCloudForColoredICP>(target_));
+    ComputeColorGradients(
+            *target_c, *kdtree_,
+            geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
+}
+
 Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -231,9 +248,21 @@ RegistrationResult RegistrationColoredICP(
         /*TransformationEstimationForColoredICP()*/,
         const ICPConvergenceCriteria
                 &criteria /* = ICPConvergenceCriteria()*/) {
-    auto target_c = InitializePointCloudForColoredICP(
-            target, geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
-    return RegistrationICP(source, *target_c, max_distance, init, estimation,
+    ColoredICPTarget target_c(target, max_distance);
+    return RegistrationICP(source, target_c, max_distance, init, estimation,
+                           criteria);
+}
+
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const ColoredICPTarget &target,
+        double max_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimationForColoredICP &estimation
+        /*TransformationEstimationForColoredICP()*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    return RegistrationICP(source, target, max_distance, init, estimation,
                            criteria);
 }
 
@@ -80,6 +80,23 @@ private:
             TransformationEstimationType::ColoredICP;
 };
 
+/// \class ColoredICPTarget
+///
+/// \brief Target point cloud of Colored ICP, with its KD-tree and the color
+/// gradients of its points, computed once on construction. See
+/// RegistrationTarget.
+class ColoredICPTarget : public RegistrationTarget {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The target point cloud with normals and colors, which is
+    /// copied.
+    /// \param max_distance Maximum correspondence points-pair distance of the
+    /// registrations. The color gradients are estimated in a radius of twice
+    /// \p max_distance.
+    ColoredICPTarget(const geometry::PointCloud &target, double max_distance);
+};
+
 /// \brief Function for Colored ICP registration.
 ///
 /// This is implementation of following paper
@@ -104,6 +121,24 @@ RegistrationResult RegistrationColoredICP(
                 TransformationEstimationForColoredICP(),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Function for Colored ICP registration, with a prebuilt target
+/// KD-tree and color gradients.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud, its KD-tree and color gradients.
+/// \param max_distance Maximum correspondence points-pair distance.
+/// \param init Initial transformation estimation.
+/// \param estimation TransformationEstimationForColoredICP method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const ColoredICPTarget &target,
+        double max_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimationForColoredICP &estimation =
+                TransformationEstimationForColoredICP(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
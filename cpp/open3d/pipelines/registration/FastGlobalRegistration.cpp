@@ -26,7 +26,8 @@
 
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 
-#include "open3d/geometry/KDTreeFlann.h"
+#include <algorithm>
+
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/Registration.h"
@@ -53,69 +54,18 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
         swapped = true;
     }
 
-    // STEP 1) Initial matching
-    int nPti = int(point_cloud_vec[fi].points_.size());
-    int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
-    std::vector<std::pair<int, int>> corres;
-    std::vector<std::pair<int, int>> corres_ij;
-    std::vector<std::pair<int, int>> corres_ji;
-    std::vector<int> i_to_j(nPti, -1);
-    for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
-        }
-        corres_ji.push_back(std::pair<int, int>(i, j));
-    }
-    for (int i = 0; i < nPti; i++) {
-        if (i_to_j[i] != -1)
-            corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
-    }
-    int ncorres_ij = int(corres_ij.size());
-    int ncorres_ji = int(corres_ji.size());
-    for (int i = 0; i < ncorres_ij; ++i)
-        corres.push_back(
-                std::pair<int, int>(corres_ij[i].first, corres_ij[i].second));
-    for (int j = 0; j < ncorres_ji; ++j)
-        corres.push_back(
-                std::pair<int, int>(corres_ji[j].first, corres_ji[j].second));
-    utility::LogDebug("points are remained : {:d}", (int)corres.size());
-
-    // STEP 2) CROSS CHECK
-    utility::LogDebug("\t[cross check] ");
-    std::vector<std::pair<int, int>> corres_cross;
-    std::vector<std::vector<int>> Mi(nPti), Mj(nPtj);
-    int ci, cj;
-    for (int i = 0; i < ncorres_ij; ++i) {
-        ci = corres_ij[i].first;
-        cj = corres_ij[i].second;
-        Mi[ci].push_back(cj);
-    }
-    for (int j = 0; j < ncorres_ji; ++j) {
-        ci = corres_ji[j].first;
-        cj = corres_ji[j].second;
-        Mj[cj].push_back(ci);
-    }
-    for (int i = 0; i < nPti; ++i) {
-        for (size_t ii = 0; ii < Mi[i].size(); ++ii) {
-            int j = Mi[i][ii];
-            for (size_t jj = 0; jj < Mj[j].size(); ++jj) {
-                if (Mj[j][jj] == i)
-                    corres_cross.push_back(std::pair<int, int>(i, j));
-            }
-        }
+    // STEP 1) Initial matching and STEP 2) CROSS CHECK
+    // Mutual nearest neighbors in feature space, searched from the smaller
+    // fragment fj and ordered by their index in fi.
+    CorrespondenceSet corres_mutual = CorrespondencesFromFeatures(
+            features_vec[fj], features_vec[fi], true, option.matching_option_);
+    std::vector<std::pair<int, int>> corres_cross(corres_mutual.size());
+    for (size_t k = 0; k < corres_mutual.size(); ++k) {
+        corres_cross[k] = std::make_pair(corres_mutual[k](1),
+                                         corres_mutual[k](0));
     }
-    utility::LogDebug("points are remained : %d", (int)corres_cross.size());
+    std::sort(corres_cross.begin(), corres_cross.end());
+    utility::LogDebug("points are remained : {:d}", (int)corres_cross.size());
 
     // STEP 3) TUPLE CONSTRAINT
     utility::LogDebug("\t[tuple constraint] ");
@@ -27,6 +27,11 @@
 #include "open3d/pipelines/registration/Feature.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
@@ -50,7 +55,8 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     auto n2_copy = n2;
     double angle1 = n1_copy.dot(dp2p1) / result(3);
     double angle2 = n2_copy.dot(dp2p1) / result(3);
-    if (acos(fabs(angle1)) > acos(fabs(angle2))) {
+    // Same as acos(fabs(angle1)) > acos(fabs(angle2)), acos is decreasing.
+    if (fabs(angle1) < fabs(angle2)) {
         n1_copy = n2;
         n2_copy = n1;
         dp2p1 *= -1.0;
@@ -70,19 +76,23 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     return result;
 }
 
+/// Neighbors of each point, searched once and used both for the SPFH and for
+/// the FPFH.
+struct PointNeighbors {
+    std::vector<std::vector<int>> indices_;
+    std::vector<std::vector<double>> distance2_;
+};
+
 static std::shared_ptr<Feature> ComputeSPFHFeature(
-        const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
+        const geometry::PointCloud &input, const PointNeighbors &neighbors) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
 #pragma omp parallel for schedule(static)
     for (int i = 0; i < (int)input.points_.size(); i++) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        const std::vector<int> &indices = neighbors.indices_[i];
+        if (indices.size() > 1) {
             // only compute SPFH feature when a point has neighbors
             double hist_incr = 100.0 / (double)(indices.size() - 1);
             for (size_t k = 1; k < indices.size(); k++) {
@@ -120,13 +130,20 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 "normal.");
     }
     geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    PointNeighbors neighbors;
+    neighbors.indices_.resize(input.points_.size());
+    neighbors.distance2_.resize(input.points_.size());
 #pragma omp parallel for schedule(static)
     for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        kdtree.Search(input.points_[i], search_param, neighbors.indices_[i],
+                      neighbors.distance2_[i]);
+    }
+    auto spfh = ComputeSPFHFeature(input, neighbors);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < (int)input.points_.size(); i++) {
+        const std::vector<int> &indices = neighbors.indices_[i];
+        const std::vector<double> &distance2 = neighbors.distance2_[i];
+        if (indices.size() > 1) {
             double sum[3] = {0.0, 0.0, 0.0};
             for (size_t k = 1; k < indices.size(); k++) {
                 // skip the point itself
@@ -154,6 +171,326 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     return feature;
 }
 
+namespace {
+
+/// \class KDForest
+///
+/// Forest of randomized kd-trees for approximate nearest neighbor search in
+/// high dimensions (C. Silpa-Anan and R. Hartley, Optimised KD-trees for fast
+/// image descriptor matching, CVPR 2008). Each split is on a dimension drawn
+/// at random among the ones of highest variance, so that the trees partition
+/// the space differently. A query descends all the trees, then keeps visiting
+/// the closest unexplored branches of any tree until it has checked a given
+/// number of points.
+class KDForest {
+public:
+    /// Search buffers, to be reused for all the queries of a thread.
+    struct SearchBuffer {
+        Eigen::VectorXf query_;
+        /// Min-heap of (lower bound of the distance, node).
+        std::vector<std::pair<float, int>> branches_;
+        /// checked_[k] == stamp_ if the k-th point was checked by this query.
+        std::vector<uint32_t> checked_;
+        uint32_t stamp_ = 0;
+    };
+
+    KDForest(const Eigen::MatrixXd &data, int num_trees)
+        : data_(data.cast<float>()) {
+        const int num_points = int(data_.cols());
+        indices_.resize(size_t(num_trees) * num_points);
+        std::mt19937 generator(0);
+        for (int t = 0; t < num_trees; t++) {
+            int *begin = indices_.data() + size_t(t) * num_points;
+            std::iota(begin, begin + num_points, 0);
+            std::shuffle(begin, begin + num_points, generator);
+            roots_.push_back(Build(begin, begin + num_points, generator));
+        }
+    }
+
+    /// Returns the index of the approximate nearest neighbor of query.
+    int Search(const Eigen::Ref<const Eigen::VectorXd> &query,
+               int checks,
+               SearchBuffer &buffer) const {
+        buffer.query_ = query.cast<float>();
+        buffer.branches_.clear();
+        if (buffer.checked_.size() != size_t(data_.cols())) {
+            buffer.checked_.assign(data_.cols(), 0);
+            buffer.stamp_ = 0;
+        }
+        if (++buffer.stamp_ == 0) {
+            std::fill(buffer.checked_.begin(), buffer.checked_.end(), 0);
+            buffer.stamp_ = 1;
+        }
+        Result result;
+        for (int root : roots_) {
+            Descend(root, 0.0f, buffer, result);
+        }
+        auto greater = std::greater<std::pair<float, int>>();
+        while (!buffer.branches_.empty() && result.num_checked_ < checks) {
+            std::pop_heap(buffer.branches_.begin(), buffer.branches_.end(),
+                          greater);
+            std::pair<float, int> branch = buffer.branches_.back();
+            buffer.branches_.pop_back();
+            if (branch.first >= result.distance2_) {
+                break;
+            }
+            Descend(branch.second, branch.first, buffer, result);
+        }
+        return result.index_;
+    }
+
+private:
+    /// Inner node if dim_ >= 0, splitting at value_ into the nodes children_.
+    /// Leaf otherwise, holding the points [children_[0], children_[1]) of
+    /// indices_.
+    struct Node {
+        int dim_;
+        float value_;
+        int children_[2];
+    };
+
+    struct Result {
+        int index_ = -1;
+        float distance2_ = std::numeric_limits<float>::max();
+        int num_checked_ = 0;
+    };
+
+    int Build(int *begin, int *end, std::mt19937 &generator) {
+        const int max_leaf_size = 32;
+        const int num_sample = 100;
+        const int num_candidate_dims = 5;
+        const int dim = int(data_.rows());
+        const int node = int(nodes_.size());
+        nodes_.emplace_back();
+        if (end - begin <= max_leaf_size) {
+            nodes_[node].dim_ = -1;
+            nodes_[node].children_[0] = int(begin - indices_.data());
+            nodes_[node].children_[1] = int(end - indices_.data());
+            return node;
+        }
+
+        // Mean and variance of the first points, which are in random order.
+        int n = std::min(int(end - begin), num_sample);
+        Eigen::VectorXf mean = Eigen::VectorXf::Zero(dim);
+        for (int k = 0; k < n; k++) {
+            mean += data_.col(begin[k]);
+        }
+        mean /= float(n);
+        Eigen::VectorXf variance = Eigen::VectorXf::Zero(dim);
+        for (int k = 0; k < n; k++) {
+            variance += (data_.col(begin[k]) - mean).cwiseAbs2();
+        }
+        std::vector<int> dims(dim);
+        std::iota(dims.begin(), dims.end(), 0);
+        int num_candidates = std::min(num_candidate_dims, dim);
+        std::partial_sort(dims.begin(), dims.begin() + num_candidates,
+                          dims.end(), [&](int a, int b) {
+                              return variance(a) > variance(b);
+                          });
+        int split_dim = dims[std::uniform_int_distribution<int>(
+                0, num_candidates - 1)(generator)];
+        float split_value = mean(split_dim);
+
+        int *middle = std::partition(begin, end, [&](int k) {
+            return data_(split_dim, k) < split_value;
+        });
+        if (middle == begin || middle == end) {
+            middle = begin + (end - begin) / 2;
+        }
+        nodes_[node].dim_ = split_dim;
+        nodes_[node].value_ = split_value;
+        int left = Build(begin, middle, generator);
+        int right = Build(middle, end, generator);
+        nodes_[node].children_[0] = left;
+        nodes_[node].children_[1] = right;
+        return node;
+    }
+
+    /// Descends from node to a leaf, queueing the other branches, and checks
+    /// the points of the leaf.
+    void Descend(int node,
+                 float lower_bound,
+                 SearchBuffer &buffer,
+                 Result &result) const {
+        auto greater = std::greater<std::pair<float, int>>();
+        while (nodes_[node].dim_ >= 0) {
+            const Node &inner = nodes_[node];
+            float diff = buffer.query_(inner.dim_) - inner.value_;
+            int near = inner.children_[diff < 0 ? 0 : 1];
+            int far = inner.children_[diff < 0 ? 1 : 0];
+            float far_lower_bound = lower_bound + diff * diff;
+            if (far_lower_bound < result.distance2_) {
+                buffer.branches_.emplace_back(far_lower_bound, far);
+                std::push_heap(buffer.branches_.begin(),
+                               buffer.branches_.end(), greater);
+            }
+            node = near;
+        }
+        for (int k = nodes_[node].children_[0]; k < nodes_[node].children_[1];
+             k++) {
+            int index = indices_[k];
+            if (buffer.checked_[index] == buffer.stamp_) {
+                continue;
+            }
+            buffer.checked_[index] = buffer.stamp_;
+            result.num_checked_++;
+            float distance2 = (data_.col(index) - buffer.query_).squaredNorm();
+            if (distance2 < result.distance2_) {
+                result.distance2_ = distance2;
+                result.index_ = index;
+            }
+        }
+    }
+
+    /// The points as columns, in single precision.
+    Eigen::MatrixXf data_;
+    std::vector<Node> nodes_;
+    std::vector<int> roots_;
+    /// Point indices, grouped by leaf, for each tree.
+    std::vector<int> indices_;
+};
+
+/// Nearest neighbor search among the columns of a feature matrix.
+class FeatureNearestNeighborSearch {
+public:
+    using SearchBuffer = KDForest::SearchBuffer;
+
+    FeatureNearestNeighborSearch(const Feature &dataset,
+                                 const FeatureMatchingOption &option)
+        : checks_(option.checks_) {
+        if (option.method_ == FeatureMatchingOption::Method::KDForest) {
+            forest_.reset(new KDForest(dataset.data_, option.num_trees_));
+        } else {
+            kdtree_.SetFeature(dataset);
+        }
+    }
+
+    /// Returns the index of the nearest neighbor of the i-th query.
+    int Search(const Feature &queries, int i, SearchBuffer &buffer) const {
+        if (forest_) {
+            return forest_->Search(queries.data_.col(i), checks_, buffer);
+        }
+        std::vector<int> indices(1);
+        std::vector<double> distance2(1);
+        kdtree_.SearchKNN(Eigen::VectorXd(queries.data_.col(i)), 1, indices,
+                          distance2);
+        return indices[0];
+    }
+
+private:
+    int checks_;
+    geometry::KDTreeFlann kdtree_;
+    std::unique_ptr<KDForest> forest_;
+};
+
+/// Keeps the correspondences of \p corres_ij, the nearest target feature of
+/// each source feature, whose source feature is also the nearest source
+/// feature of their target feature.
+CorrespondenceSet MutualFilter(const Feature &source_features,
+                               const Feature &target_features,
+                               const CorrespondenceSet &corres_ij,
+                               const FeatureMatchingOption &option) {
+    if (corres_ij.empty()) {
+        return CorrespondenceSet();
+    }
+    int num_src = int(source_features.Num());
+    int num_tgt = int(target_features.Num());
+
+    // The reverse search is only needed for the target features that are the
+    // nearest neighbor of some source feature.
+    std::vector<char> is_matched(num_tgt, 0);
+    std::vector<int> matched_targets;
+    for (int i = 0; i < num_src; i++) {
+        int j = corres_ij[i](1);
+        if (!is_matched[j]) {
+            is_matched[j] = 1;
+            matched_targets.push_back(j);
+        }
+    }
+    std::vector<int> nearest_source(num_tgt, -1);
+    FeatureNearestNeighborSearch source_search(source_features, option);
+#pragma omp parallel
+    {
+        FeatureNearestNeighborSearch::SearchBuffer buffer;
+#pragma omp for schedule(static)
+        for (int k = 0; k < int(matched_targets.size()); k++) {
+            int j = matched_targets[k];
+            nearest_source[j] =
+                    source_search.Search(target_features, j, buffer);
+        }
+    }
+
+    std::vector<char> is_mutual(num_src);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_src; i++) {
+        is_mutual[i] = nearest_source[corres_ij[i](1)] == i;
+    }
+    CorrespondenceSet corres_mutual;
+    for (int i = 0; i < num_src; i++) {
+        if (is_mutual[i]) {
+            corres_mutual.push_back(corres_ij[i]);
+        }
+    }
+    return corres_mutual;
+}
+
+}  // namespace
+
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_features,
+        const Feature &target_features,
+        bool mutual_filter /* = false*/,
+        const FeatureMatchingOption &option /* = FeatureMatchingOption()*/) {
+    if (source_features.Dimension() != target_features.Dimension()) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] Source and target features have "
+                "different dimensions {:d} and {:d}.",
+                source_features.Dimension(), target_features.Dimension());
+    }
+    if (option.method_ == FeatureMatchingOption::Method::KDForest &&
+        (option.num_trees_ < 1 || option.checks_ < 1)) {
+        utility::LogError(
+                "[CorrespondencesFromFeatures] KDForest needs num_trees >= 1 "
+                "and checks >= 1, but got {:d} and {:d}.",
+                option.num_trees_, option.checks_);
+    }
+    int num_src = int(source_features.Num());
+    int num_tgt = int(target_features.Num());
+    if (num_src == 0 || num_tgt == 0) {
+        return CorrespondenceSet();
+    }
+
+    CorrespondenceSet corres_ij(num_src);
+    {
+        FeatureNearestNeighborSearch target_search(target_features, option);
+#pragma omp parallel
+        {
+            FeatureNearestNeighborSearch::SearchBuffer buffer;
+#pragma omp for schedule(static)
+            for (int i = 0; i < num_src; i++) {
+                corres_ij[i] = Eigen::Vector2i(
+                        i, target_search.Search(source_features, i, buffer));
+            }
+        }
+    }
+    if (!mutual_filter) {
+        return corres_ij;
+    }
+    return MutualFilter(source_features, target_features, corres_ij, option);
+}
+
+std::pair<CorrespondenceSet, CorrespondenceSet>
+MutualCorrespondencesFromFeatures(
+        const Feature &source_features,
+        const Feature &target_features,
+        const FeatureMatchingOption &option /* = FeatureMatchingOption()*/) {
+    CorrespondenceSet corres_ij = CorrespondencesFromFeatures(
+            source_features, target_features, false, option);
+    CorrespondenceSet corres_mutual =
+            MutualFilter(source_features, target_features, corres_ij, option);
+    return std::make_pair(std::move(corres_ij), std::move(corres_mutual));
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
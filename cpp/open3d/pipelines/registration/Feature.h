@@ -28,9 +28,11 @@
 
 #include <Eigen/Core>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
 
@@ -73,6 +75,73 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// \class FeatureMatchingOption
+///
+/// \brief Options for matching features to their nearest neighbors.
+class FeatureMatchingOption {
+public:
+    /// \enum Method
+    ///
+    /// \brief Nearest neighbor search used to match the features.
+    enum class Method {
+        /// Exact search in a single kd-tree.
+        Exact = 0,
+        /// Approximate search in a forest of randomized kd-trees.
+        KDForest = 1,
+    };
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param method Nearest neighbor search used to match the features.
+    /// \param num_trees Number of randomized kd-trees of the KDForest method.
+    /// \param checks Number of points the KDForest method compares each query
+    /// with. More checks give a higher recall at a higher cost.
+    FeatureMatchingOption(Method method = Method::Exact,
+                          int num_trees = 4,
+                          int checks = 1024)
+        : method_(method), num_trees_(num_trees), checks_(checks) {}
+    ~FeatureMatchingOption() {}
+
+public:
+    /// Nearest neighbor search used to match the features.
+    Method method_;
+    /// Number of randomized kd-trees of the KDForest method.
+    int num_trees_;
+    /// Number of points the KDForest method compares each query with.
+    int checks_;
+};
+
+/// \brief Function to find the nearest target feature of each source feature.
+///
+/// \param source_features Source features.
+/// \param target_features Target features.
+/// \param mutual_filter Keep only the correspondences whose source feature is
+/// also the nearest source feature of their target feature.
+/// \param option Options for the nearest neighbor search.
+/// \return Correspondences (source index, target index), ordered by source
+/// index. Without mutual filter, the i-th correspondence is the one of the
+/// i-th source feature.
+CorrespondenceSet CorrespondencesFromFeatures(
+        const Feature &source_features,
+        const Feature &target_features,
+        bool mutual_filter = false,
+        const FeatureMatchingOption &option = FeatureMatchingOption());
+
+/// \brief Function to find the correspondences of CorrespondencesFromFeatures()
+/// both without and with mutual filter, from a single search of the nearest
+/// target features.
+///
+/// \param source_features Source features.
+/// \param target_features Target features.
+/// \param option Options for the nearest neighbor search.
+/// \return The correspondences without mutual filter, and the ones that
+/// pass the mutual filter.
+std::pair<CorrespondenceSet, CorrespondenceSet>
+MutualCorrespondencesFromFeatures(
+        const Feature &source_features,
+        const Feature &target_features,
+        const FeatureMatchingOption &option = FeatureMatchingOption());
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 
@@ -204,48 +205,206 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 /// https ://github.com/RainerKuemmerle/g2o/blob/master/doc/g2o.pdf
 /// Eq (20) and Eq (21). (There is a typo in the equation though. B should be J)
 ///
-/// This function focuses the case that every edge has two nodes (not hyper
+/// This class focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
-    int n_nodes = (int)pose_graph.nodes_.size();
-    int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
+///
+/// H is block-sparse: it has a 6x6 block (i, j) only if i == j or an edge
+/// connects nodes i and j. Only the lower triangle of H is stored. Since the
+/// edges do not change while a pose graph is optimized, the sparsity pattern,
+/// and with it the symbolic factorization of H, is computed once.
+class PoseGraphLinearSystem {
+public:
+    explicit PoseGraphLinearSystem(const PoseGraph &pose_graph) {
+        int n_nodes = (int)pose_graph.nodes_.size();
+        int n_edges = (int)pose_graph.edges_.size();
+
+        // Block rows of each block column j, i.e. j followed by the nodes
+        // i > j connected to j, in increasing order.
+        std::vector<std::vector<int>> block_rows(n_nodes);
+        for (int j = 0; j < n_nodes; j++) {
+            block_rows[j].push_back(j);
+        }
+        for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            int i = std::max(t.source_node_id_, t.target_node_id_);
+            int j = std::min(t.source_node_id_, t.target_node_id_);
+            if (i != j) block_rows[j].push_back(i);
+        }
+        for (int j = 0; j < n_nodes; j++) {
+            std::sort(block_rows[j].begin() + 1, block_rows[j].end());
+            block_rows[j].erase(
+                    std::unique(block_rows[j].begin(), block_rows[j].end()),
+                    block_rows[j].end());
+        }
 
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+        // All columns of a block column have the same rows.
+        H_.resize(n_nodes * 6, n_nodes * 6);
+        Eigen::VectorXi column_sizes(n_nodes * 6);
+        for (int j = 0; j < n_nodes; j++) {
+            column_sizes.segment<6>(j * 6).setConstant(
+                    (int)block_rows[j].size() * 6);
+        }
+        H_.reserve(column_sizes);
+        for (int j = 0; j < n_nodes; j++) {
+            for (int c = 0; c < 6; c++) {
+                for (int i : block_rows[j]) {
+                    for (int r = 0; r < 6; r++) {
+                        H_.insert(i * 6 + r, j * 6 + c) = 0.0;
+                    }
+                }
+            }
+        }
+        H_.makeCompressed();
+        b_.resize(n_nodes * 6);
+
+        // Edges incident to each node, with the position of the other node
+        // in the block column of the node, or -1 if the other node comes
+        // first and the block is in the upper triangle.
+        node_edges_.resize(n_nodes);
+        for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            int s_id = t.source_node_id_;
+            int t_id = t.target_node_id_;
+            node_edges_[s_id].push_back(
+                    {iter_edge, BlockPosition(block_rows[s_id], t_id)});
+            if (t_id != s_id) {
+                node_edges_[t_id].push_back(
+                        {iter_edge, BlockPosition(block_rows[t_id], s_id)});
+            }
+        }
 
-        Eigen::Matrix4d X_inv, Ts, Tt_inv;
-        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+        edge_Hss_.resize(n_edges);
+        edge_Hst_.resize(n_edges);
+        edge_Htt_.resize(n_edges);
+        edge_bs_.resize(n_edges);
+        edge_bt_.resize(n_edges);
+        solver_.analyzePattern(H_);
+    }
+
+    /// Recomputes H and b at the current poses of \p pose_graph, which must
+    /// have the edges of the pose graph this system was built for.
+    void Compute(const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+        int n_nodes = (int)pose_graph.nodes_.size();
+        int n_edges = (int)pose_graph.edges_.size();
 
-        Eigen::Matrix6d Js, Jt;
-        std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
-        Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
-        Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
-        Eigen::Vector6d eT_Info = e.transpose() * t.information_;
-        double line_process_iter = t.confidence_;
-
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+#pragma omp parallel for schedule(static)
+        for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+            const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+            Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+
+            Eigen::Matrix4d X_inv, Ts, Tt_inv;
+            std::tie(X_inv, Ts, Tt_inv) =
+                    GetRelativePoses(pose_graph, iter_edge);
+
+            Eigen::Matrix6d Js, Jt;
+            std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
+            Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
+            Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
+            Eigen::Vector6d eT_Info = e.transpose() * t.information_;
+            double line_process_iter = t.confidence_;
+
+            edge_Hss_[iter_edge].noalias() = line_process_iter * JsT_Info * Js;
+            edge_Hst_[iter_edge].noalias() = line_process_iter * JsT_Info * Jt;
+            edge_Htt_[iter_edge].noalias() = line_process_iter * JtT_Info * Jt;
+            edge_bs_[iter_edge].noalias() =
+                    -line_process_iter * Js.transpose() * eT_Info;
+            edge_bt_[iter_edge].noalias() =
+                    -line_process_iter * Jt.transpose() * eT_Info;
+        }
+
+        // Each node owns its block column of H and its block of b.
+        const int *outer = H_.outerIndexPtr();
+        double *values = H_.valuePtr();
+#pragma omp parallel for schedule(static)
+        for (int j = 0; j < n_nodes; j++) {
+            std::fill(values + outer[j * 6], values + outer[j * 6 + 6], 0.0);
+            b_.block<6, 1>(j * 6, 0).setZero();
+            for (const IncidentEdge &incident : node_edges_[j]) {
+                int iter_edge = incident.edge_id_;
+                const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+                const Eigen::Matrix6d &Hst = edge_Hst_[iter_edge];
+                Eigen::Matrix6d block_jj = Eigen::Matrix6d::Zero();
+                if (t.source_node_id_ == j) {
+                    block_jj += edge_Hss_[iter_edge];
+                    b_.block<6, 1>(j * 6, 0) += edge_bs_[iter_edge];
+                    // Block (target, source) is Hst^T.
+                    if (incident.other_position_ > 0) {
+                        AddBlock(j, incident.other_position_,
+                                 Hst.transpose());
+                    }
+                }
+                if (t.target_node_id_ == j) {
+                    block_jj += edge_Htt_[iter_edge];
+                    b_.block<6, 1>(j * 6, 0) += edge_bt_[iter_edge];
+                    if (incident.other_position_ > 0) {
+                        AddBlock(j, incident.other_position_, Hst);
+                    }
+                }
+                if (t.source_node_id_ == t.target_node_id_) {
+                    block_jj += Hst + Hst.transpose();
+                }
+                AddBlock(j, 0, block_jj);
+            }
+        }
     }
-    return std::make_tuple(std::move(H), std::move(b));
-}
+
+    /// Solves (H + lambda * I) delta = b, reusing the symbolic factorization.
+    bool Solve(double lambda, Eigen::VectorXd &delta) {
+        if (lambda == 0.0) {
+            solver_.factorize(H_);
+        } else {
+            H_LM_ = H_;
+            for (int k = 0; k < H_LM_.cols(); k++) {
+                H_LM_.coeffRef(k, k) += lambda;
+            }
+            solver_.factorize(H_LM_);
+        }
+        if (solver_.info() != Eigen::Success) {
+            utility::LogWarning("Sparse LDLT factorization failed.");
+            return false;
+        }
+        delta = solver_.solve(b_);
+        return solver_.info() == Eigen::Success;
+    }
+
+    Eigen::VectorXd GetHessianDiagonal() const { return H_.diagonal(); }
+
+    const Eigen::VectorXd &GetRightTerm() const { return b_; }
+
+private:
+    struct IncidentEdge {
+        int edge_id_;
+        int other_position_;
+    };
+
+    static int BlockPosition(const std::vector<int> &block_rows, int i) {
+        auto it = std::lower_bound(block_rows.begin() + 1, block_rows.end(), i);
+        if (it == block_rows.end() || *it != i) return -1;
+        return (int)(it - block_rows.begin());
+    }
+
+    /// Adds \p block to the block at \p position of block column \p j.
+    void AddBlock(int j, int position, const Eigen::Matrix6d &block) {
+        const int *outer = H_.outerIndexPtr();
+        double *values = H_.valuePtr();
+        for (int c = 0; c < 6; c++) {
+            Eigen::Map<Eigen::Vector6d> column(values + outer[j * 6 + c] +
+                                               position * 6);
+            column += block.col(c);
+        }
+    }
+
+    Eigen::SparseMatrix<double> H_;
+    Eigen::SparseMatrix<double> H_LM_;
+    Eigen::VectorXd b_;
+    std::vector<std::vector<IncidentEdge>> node_edges_;
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> edge_Hss_;
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> edge_Hst_;
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> edge_Htt_;
+    std::vector<Eigen::Vector6d, utility::Vector6d_allocator> edge_bs_;
+    std::vector<Eigen::Vector6d, utility::Vector6d_allocator> edge_bt_;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver_;
+};
 
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
@@ -511,16 +670,15 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
+    PoseGraphLinearSystem system(pose_graph);
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    system.Compute(pose_graph, zeta);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
     bool stop = false;
-    if (CheckRightTerm(b, criteria)) return;
+    if (CheckRightTerm(system.GetRightTerm(), criteria)) return;
 
     utility::Timer timer_overall;
     timer_overall.Start();
@@ -529,13 +687,12 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         utility::Timer timer_iter;
         timer_iter.Start();
 
-        Eigen::VectorXd delta(H.cols());
-        bool solver_success = false;
-
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver. A zero increment stops
+        // the optimization if H is singular.
+        Eigen::VectorXd delta;
+        if (!system.Solve(0.0, delta)) {
+            delta = Eigen::VectorXd::Zero(n_nodes * 6);
+        }
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -558,9 +715,9 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             x = UpdatePoseVector(pose_graph);
             valid_edges_num = UpdateConfidence(pose_graph, zeta,
                                                line_process_weight, option);
-            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+            system.Compute(pose_graph, zeta);
 
-            stop = stop || CheckRightTerm(b, criteria);
+            stop = stop || CheckRightTerm(system.GetRightTerm(), criteria);
             if (stop) break;
         }
         timer_iter.Stop();
@@ -602,14 +759,12 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
+    PoseGraphLinearSystem system(pose_graph);
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    system.Compute(pose_graph, zeta);
 
-    Eigen::VectorXd H_diag = H.diagonal();
+    Eigen::VectorXd H_diag = system.GetHessianDiagonal();
     double tau = 1e-5;
     double current_lambda = tau * H_diag.maxCoeff();
     double ni = 2.0;
@@ -619,7 +774,7 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                       current_residual, current_lambda);
 
     bool stop = false;
-    stop = stop || CheckRightTerm(b, criteria);
+    stop = stop || CheckRightTerm(system.GetRightTerm(), criteria);
     if (stop) return;
 
     utility::Timer timer_overall;
@@ -629,14 +784,12 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
-            bool solver_success = false;
-
-            // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            // Solve (H + lambda * I) @ delta == b using a sparse solver
+            Eigen::VectorXd delta;
+            if (!system.Solve(current_lambda, delta)) {
+                delta = Eigen::VectorXd::Zero(n_nodes * 6);
+            }
+            const Eigen::VectorXd &b = system.GetRightTerm();
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -667,9 +820,10 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     x = UpdatePoseVector(pose_graph);
                     valid_edges_num = UpdateConfidence(
                             pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                    system.Compute(pose_graph, zeta);
 
-                    stop = stop || CheckRightTerm(b, criteria);
+                    stop = stop || CheckRightTerm(system.GetRightTerm(),
+                                                  criteria);
                     if (stop) break;
                 } else {
                     current_lambda *= ni;
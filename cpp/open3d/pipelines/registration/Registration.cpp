@@ -26,11 +26,20 @@
 
 #include "open3d/pipelines/registration/Registration.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <tuple>
+
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace pipelines {
@@ -93,12 +102,14 @@ static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
     RegistrationResult result(transformation);
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
     double error2 = 0.0;
     int good = 0;
     double max_dis2 = max_correspondence_distance * max_correspondence_distance;
     for (const auto &c : corres) {
-        double dis2 =
-                (source.points_[c[0]] - target.points_[c[1]]).squaredNorm();
+        double dis2 = (R * source.points_[c[0]] + t - target.points_[c[1]])
+                              .squaredNorm();
         if (dis2 < max_dis2) {
             good++;
             error2 += dis2;
@@ -115,6 +126,167 @@ static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     return result;
 }
 
+/// Number of correspondences scored between two early rejection tests of a
+/// RANSAC hypothesis.
+static const int RANSAC_SCORING_BLOCK_SIZE = 256;
+
+/// Counts the inlier correspondences of \p transformation, transforming the
+/// source points on the fly, and adds their squared distances to \p error2.
+/// Returns -1 as soon as the hypothesis cannot have more than
+/// \p best_num_inliers inliers, or, if \p early_rejection_sigma > 0, as soon
+/// as its inlier ratio on the correspondences scored so far is more than
+/// \p early_rejection_sigma standard deviations below the best inlier ratio.
+static int CountRANSACInliers(const geometry::PointCloud &source,
+                              const geometry::PointCloud &target,
+                              const CorrespondenceSet &corres,
+                              double max_correspondence_distance,
+                              const Eigen::Matrix4d &transformation,
+                              int best_num_inliers,
+                              double early_rejection_sigma,
+                              double &error2) {
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+    const double max_dis2 =
+            max_correspondence_distance * max_correspondence_distance;
+    const int num_corres = static_cast<int>(corres.size());
+    const double best_ratio = (double)best_num_inliers / (double)num_corres;
+    int good = 0;
+    error2 = 0.0;
+    for (int begin = 0; begin < num_corres;
+         begin += RANSAC_SCORING_BLOCK_SIZE) {
+        int end = std::min(begin + RANSAC_SCORING_BLOCK_SIZE, num_corres);
+        for (int i = begin; i < end; i++) {
+            const Eigen::Vector2i &c = corres[i];
+            double dis2 = (R * source.points_[c[0]] + t - target.points_[c[1]])
+                                  .squaredNorm();
+            if (dis2 < max_dis2) {
+                good++;
+                error2 += dis2;
+            }
+        }
+        if (good + (num_corres - end) < best_num_inliers) {
+            return -1;
+        }
+        if (early_rejection_sigma > 0.0 && end < num_corres) {
+            double expected = end * best_ratio;
+            double sigma = std::sqrt(expected * (1.0 - best_ratio));
+            if (good < expected - early_rejection_sigma * sigma) {
+                return -1;
+            }
+        }
+    }
+    return good;
+}
+
+static void CheckTargetForEstimation(
+        const geometry::PointCloud &target,
+        const TransformationEstimation &estimation) {
+    if ((estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::PointToPlane ||
+         estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::ColoredICP) &&
+        (!target.HasNormals())) {
+        utility::LogError(
+                "TransformationEstimationPointToPlane and "
+                "TransformationEstimationColoredICP "
+                "require pre-computed normal vectors for target PointCloud.");
+    }
+}
+
+/// Runs ICP on \p pcd, the source already transformed by \p transformation,
+/// against \p target indexed by \p target_kdtree. \p num_iterations is set
+/// to the number of transformation updates.
+static RegistrationResult RegistrationICPWithKDTree(
+        geometry::PointCloud &pcd,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria,
+        int &num_iterations) {
+    Eigen::Matrix4d transformation = init;
+    RegistrationResult result;
+    result = GetRegistrationResultAndCorrespondences(
+            pcd, target, target_kdtree, max_correspondence_distance,
+            transformation);
+    num_iterations = 0;
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          result.fitness_, result.inlier_rmse_);
+        Eigen::Matrix4d update = estimation.ComputeTransformation(
+                pcd, target, result.correspondence_set_);
+        transformation = update * transformation;
+        pcd.Transform(update);
+        num_iterations++;
+        RegistrationResult backup = result;
+        result = GetRegistrationResultAndCorrespondences(
+                pcd, target, target_kdtree, max_correspondence_distance,
+                transformation);
+
+        if (std::abs(backup.fitness_ - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+    return result;
+}
+
+/// Downsamples \p source and \p target to each of \p voxel_sizes. A level
+/// with a voxel size <= 0 uses the input clouds. Each level is downsampled
+/// from the next finer one, and downsampled target normals are renormalized.
+static std::tuple<std::vector<std::shared_ptr<const geometry::PointCloud>>,
+                  std::vector<std::shared_ptr<const geometry::PointCloud>>>
+BuildPyramid(const geometry::PointCloud &source,
+             const geometry::PointCloud &target,
+             const std::vector<double> &voxel_sizes) {
+    const size_t num_levels = voxel_sizes.size();
+    std::vector<std::shared_ptr<const geometry::PointCloud>> source_levels(
+            num_levels),
+            target_levels(num_levels);
+    // The inputs are not owned by the pyramid.
+    auto no_delete = [](const geometry::PointCloud *) {};
+    std::shared_ptr<const geometry::PointCloud> source_finer(&source,
+                                                             no_delete);
+    std::shared_ptr<const geometry::PointCloud> target_finer(&target,
+                                                             no_delete);
+
+    std::vector<size_t> order(num_levels);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return voxel_sizes[a] < voxel_sizes[b];
+    });
+    double finer_voxel_size = 0.0;
+    for (size_t level : order) {
+        double voxel_size = voxel_sizes[level];
+        if (voxel_size > finer_voxel_size) {
+            source_finer = source_finer->VoxelDownSample(voxel_size);
+            auto target_level = target_finer->VoxelDownSample(voxel_size);
+            if (target_level->HasNormals()) {
+                target_level->NormalizeNormals();
+            }
+            target_finer = target_level;
+            finer_voxel_size = voxel_size;
+        }
+        source_levels[level] = source_finer;
+        target_levels[level] = target_finer;
+    }
+    return std::make_tuple(source_levels, target_levels);
+}
+
+RegistrationTarget::RegistrationTarget(const geometry::PointCloud &target)
+    : RegistrationTarget(std::make_shared<geometry::PointCloud>(target)) {}
+
+RegistrationTarget::RegistrationTarget(
+        std::shared_ptr<const geometry::PointCloud> target)
+    : target_(std::move(target)), kdtree_(new geometry::KDTreeFlann()) {
+    kdtree_->SetGeometry(*target_);
+}
+
+RegistrationTarget::~RegistrationTarget() {}
+
 RegistrationResult EvaluateRegistration(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -131,6 +303,21 @@ RegistrationResult EvaluateRegistration(
             pcd, target, kdtree, max_correspondence_distance, transformation);
 }
 
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d
+                &transformation /* = Eigen::Matrix4d::Identity()*/) {
+    geometry::PointCloud pcd = source;
+    if (!transformation.isIdentity()) {
+        pcd.Transform(transformation);
+    }
+    return GetRegistrationResultAndCorrespondences(
+            pcd, target.GetPointCloud(), target.GetKDTree(),
+            max_correspondence_distance, transformation);
+}
+
 RegistrationResult RegistrationICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -143,44 +330,202 @@ RegistrationResult RegistrationICP(
     if (max_correspondence_distance <= 0.0) {
         utility::LogError("Invalid max_correspondence_distance.");
     }
-    if ((estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::PointToPlane ||
-         estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::ColoredICP) &&
-        (!target.HasNormals())) {
-        utility::LogError(
-                "TransformationEstimationPointToPlane and "
-                "TransformationEstimationColoredICP "
-                "require pre-computed normal vectors for target PointCloud.");
-    }
+    CheckTargetForEstimation(target, estimation);
 
-    Eigen::Matrix4d transformation = init;
     geometry::KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (!init.isIdentity()) {
         pcd.Transform(init);
     }
-    RegistrationResult result;
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
-    for (int i = 0; i < criteria.max_iteration_; i++) {
-        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
-                          result.fitness_, result.inlier_rmse_);
-        Eigen::Matrix4d update = estimation.ComputeTransformation(
-                pcd, target, result.correspondence_set_);
-        transformation = update * transformation;
-        pcd.Transform(update);
-        RegistrationResult backup = result;
-        result = GetRegistrationResultAndCorrespondences(
-                pcd, target, kdtree, max_correspondence_distance,
-                transformation);
+    int num_iterations;
+    return RegistrationICPWithKDTree(pcd, target, kdtree,
+                                     max_correspondence_distance, init,
+                                     estimation, criteria, num_iterations);
+}
 
-        if (std::abs(backup.fitness_ - result.fitness_) <
-                    criteria.relative_fitness_ &&
-            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
-                    criteria.relative_rmse_) {
-            break;
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    CheckTargetForEstimation(target.GetPointCloud(), estimation);
+
+    geometry::PointCloud pcd = source;
+    if (!init.isIdentity()) {
+        pcd.Transform(init);
+    }
+    int num_iterations;
+    return RegistrationICPWithKDTree(
+            pcd, target.GetPointCloud(), target.GetKDTree(),
+            max_correspondence_distance, init, estimation, criteria,
+            num_iterations);
+}
+
+/// Runs one registration per item against \p target, with the source of the
+/// i-th item given by \p get_source(i). Shared by the RegistrationICPBatch
+/// overloads.
+template <typename GetSource>
+static std::vector<RegistrationResult> RegistrationICPBatchImpl(
+        int num_items,
+        GetSource get_source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &inits,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    CheckTargetForEstimation(target.GetPointCloud(), estimation);
+
+    // One registration per thread: the correspondence search nested in each
+    // registration runs on its calling thread.
+    std::vector<RegistrationResult> results(num_items);
+    // Exceptions must not escape the OpenMP region, so the first one is
+    // rethrown after the loop.
+    std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < num_items; i++) {
+        try {
+            geometry::PointCloud pcd = get_source(i);
+            if (!inits[i].isIdentity()) {
+                pcd.Transform(inits[i]);
+            }
+            int num_iterations;
+            results[i] = RegistrationICPWithKDTree(
+                    pcd, target.GetPointCloud(), target.GetKDTree(),
+                    max_correspondence_distance, inits[i], estimation,
+                    criteria, num_iterations);
+        } catch (...) {
+#pragma omp critical
+            {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return results;
+}
+
+std::vector<RegistrationResult> RegistrationICPBatch(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &inits,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    return RegistrationICPBatchImpl(
+            (int)inits.size(),
+            [&](int) -> const geometry::PointCloud & { return source; },
+            target, max_correspondence_distance, inits, estimation, criteria);
+}
+
+std::vector<RegistrationResult> RegistrationICPBatch(
+        const std::vector<std::shared_ptr<const geometry::PointCloud>>
+                &sources,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &inits,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    if (sources.size() != inits.size()) {
+        utility::LogError(
+                "Number of sources ({}) does not match the number of initial "
+                "transformations ({}).",
+                sources.size(), inits.size());
+    }
+    return RegistrationICPBatchImpl(
+            (int)sources.size(),
+            [&](int i) -> const geometry::PointCloud & { return *sources[i]; },
+            target, max_correspondence_distance, inits, estimation, criteria);
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        std::vector<ICPLevelStatistics> *level_statistics /* = nullptr*/) {
+    const size_t num_levels = voxel_sizes.size();
+    if (num_levels == 0) {
+        utility::LogError("voxel_sizes must not be empty.");
+    }
+    if (criteria_list.size() != num_levels ||
+        max_correspondence_distances.size() != num_levels) {
+        utility::LogError(
+                "voxel_sizes, criteria_list and max_correspondence_distances "
+                "must have the same length, but got {}, {} and {}.",
+                num_levels, criteria_list.size(),
+                max_correspondence_distances.size());
+    }
+    for (size_t i = 0; i < num_levels; i++) {
+        if (max_correspondence_distances[i] <= 0.0) {
+            utility::LogError("Invalid max_correspondence_distance.");
+        }
+    }
+    CheckTargetForEstimation(target, estimation);
+
+    std::vector<std::shared_ptr<const geometry::PointCloud>> source_levels,
+            target_levels;
+    std::tie(source_levels, target_levels) =
+            BuildPyramid(source, target, voxel_sizes);
+
+    if (level_statistics != nullptr) {
+        level_statistics->assign(num_levels, ICPLevelStatistics());
+    }
+    Eigen::Matrix4d transformation = init;
+    RegistrationResult result(transformation);
+    for (size_t level = 0; level < num_levels; level++) {
+        utility::Timer timer;
+        timer.Start();
+
+        const geometry::PointCloud &level_target = *target_levels[level];
+        geometry::KDTreeFlann kdtree;
+        kdtree.SetGeometry(level_target);
+        geometry::PointCloud pcd = *source_levels[level];
+        if (!transformation.isIdentity()) {
+            pcd.Transform(transformation);
+        }
+        int num_iterations;
+        result = RegistrationICPWithKDTree(
+                pcd, level_target, kdtree, max_correspondence_distances[level],
+                transformation, estimation, criteria_list[level],
+                num_iterations);
+        transformation = result.transformation_;
+
+        timer.Stop();
+        utility::LogDebug(
+                "Multi-scale ICP level {:d}: voxel size {:.4f}, {:d} "
+                "iterations, Fitness {:.4f}, RMSE {:.4f}, time {:.3f} ms",
+                level, voxel_sizes[level], num_iterations, result.fitness_,
+                result.inlier_rmse_, timer.GetDuration());
+        if (level_statistics != nullptr) {
+            ICPLevelStatistics &statistics = (*level_statistics)[level];
+            statistics.voxel_size_ = voxel_sizes[level];
+            statistics.num_iterations_ = num_iterations;
+            statistics.fitness_ = result.fitness_;
+            statistics.inlier_rmse_ = result.inlier_rmse_;
+            statistics.time_ms_ = timer.GetDuration();
         }
     }
     return result;
@@ -203,72 +548,109 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         return RegistrationResult();
     }
 
-    RegistrationResult best_result;
-    int exit_itr = -1;
+    // With early rejection, the correspondences are scored in random order,
+    // so that any prefix of them is a random subset.
+    const CorrespondenceSet *scoring_corres = &corres;
+    CorrespondenceSet shuffled_corres;
+    if (criteria.early_rejection_sigma_ > 0.0) {
+        shuffled_corres = corres;
+        std::mt19937 generator(std::random_device{}());
+        std::shuffle(shuffled_corres.begin(), shuffled_corres.end(),
+                     generator);
+        scoring_corres = &shuffled_corres;
+    }
+
+    // Hypotheses are numbered across threads, and the number of hypotheses
+    // to test and the best inlier count so far are shared, so that every
+    // thread stops as soon as the confidence is reached by any of them.
+    std::atomic<int> next_itr(0);
+    std::atomic<int> exit_itr(criteria.max_iteration_);
+    std::atomic<int> best_num_inliers(0);
+    int best_good = 0;
+    double best_error2 = 0.0;
+    Eigen::Matrix4d best_transformation = Eigen::Matrix4d::Identity();
 
 #pragma omp parallel
     {
         CorrespondenceSet ransac_corres(ransac_n);
-        RegistrationResult best_result_local;
-        int exit_itr_local = criteria.max_iteration_;
+        int best_good_local = 0;
+        double best_error2_local = 0.0;
+        Eigen::Matrix4d best_transformation_local = Eigen::Matrix4d::Identity();
+
+        for (int itr = next_itr++; itr < exit_itr; itr = next_itr++) {
+            for (int j = 0; j < ransac_n; j++) {
+                ransac_corres[j] = corres[utility::UniformRandInt(
+                        0, static_cast<int>(corres.size()) - 1)];
+            }
 
-#pragma omp for nowait
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (itr < exit_itr_local) {
-                for (int j = 0; j < ransac_n; j++) {
-                    ransac_corres[j] = corres[utility::UniformRandInt(
-                            0, static_cast<int>(corres.size()) - 1)];
-                }
+            Eigen::Matrix4d transformation = estimation.ComputeTransformation(
+                    source, target, ransac_corres);
 
-                Eigen::Matrix4d transformation =
-                        estimation.ComputeTransformation(source, target,
-                                                         ransac_corres);
-
-                // Check transformation: inexpensive
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (!checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
+            // Check transformation: inexpensive
+            bool check = true;
+            for (const auto &checker : checkers) {
+                if (!checker.get().Check(source, target, ransac_corres,
+                                         transformation)) {
+                    check = false;
+                    break;
                 }
-                if (!check) continue;
-
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto result = EvaluateRANSACBasedOnCorrespondence(
-                        pcd, target, corres, max_correspondence_distance,
-                        transformation);
-
-                if (result.IsBetterRANSACThan(best_result_local)) {
-                    best_result_local = result;
-
-                    // Update exit condition if necessary
-                    double exit_itr_d =
-                            std::log(1.0 - criteria.confidence_) /
-                            std::log(1.0 - std::pow(result.fitness_, ransac_n));
-                    exit_itr_local =
-                            exit_itr_d < double(criteria.max_iteration_)
-                                    ? static_cast<int>(std::ceil(exit_itr_d))
-                                    : exit_itr_local;
+            }
+            if (!check) continue;
+
+            double error2;
+            int good = CountRANSACInliers(
+                    source, target, *scoring_corres,
+                    max_correspondence_distance, transformation,
+                    best_num_inliers, criteria.early_rejection_sigma_, error2);
+            if (good <= 0 || good < best_good_local ||
+                (good == best_good_local && error2 >= best_error2_local)) {
+                continue;
+            }
+            best_good_local = good;
+            best_error2_local = error2;
+            best_transformation_local = transformation;
+
+            int best = best_num_inliers;
+            while (good > best &&
+                   !best_num_inliers.compare_exchange_weak(best, good)) {
+            }
+
+            // Update exit condition if necessary
+            double fitness = (double)good / (double)corres.size();
+            double exit_itr_d = std::log(1.0 - criteria.confidence_) /
+                                std::log(1.0 - std::pow(fitness, ransac_n));
+            if (exit_itr_d < double(criteria.max_iteration_)) {
+                int exit_itr_new = static_cast<int>(std::ceil(exit_itr_d));
+                int exit_itr_old = exit_itr;
+                while (exit_itr_new < exit_itr_old &&
+                       !exit_itr.compare_exchange_weak(exit_itr_old,
+                                                       exit_itr_new)) {
                 }
-            }  // if < exit_itr_local
-        }      // for loop
+            }
+        }
 #pragma omp critical
         {
-            if (best_result_local.IsBetterRANSACThan(best_result)) {
-                best_result = best_result_local;
-            }
-            if (exit_itr_local > exit_itr) {
-                exit_itr = exit_itr_local;
+            if (best_good_local > best_good ||
+                (best_good_local == best_good &&
+                 best_error2_local < best_error2)) {
+                best_good = best_good_local;
+                best_error2 = best_error2_local;
+                best_transformation = best_transformation_local;
             }
         }
     }
+
+    // Only the best hypothesis gets its correspondence set.
+    RegistrationResult best_result;
+    if (best_good > 0) {
+        best_result = EvaluateRANSACBasedOnCorrespondence(
+                source, target, corres, max_correspondence_distance,
+                best_transformation);
+    }
     utility::LogDebug(
             "RANSAC exits at {:d}-th iteration: inlier ratio {:e}, "
             "RMSE {:e}",
-            exit_itr, best_result.fitness_, best_result.inlier_rmse_);
+            exit_itr.load(), best_result.fitness_, best_result.inlier_rmse_);
     return best_result;
 }
 
@@ -285,51 +667,20 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
-        /* = RANSACConvergenceCriteria()*/) {
+        /* = RANSACConvergenceCriteria()*/,
+        const FeatureMatchingOption &matching_option
+        /* = FeatureMatchingOption()*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
 
-    int num_src_pts = int(source.points_.size());
-    int num_tgt_pts = int(target.points_.size());
-
-    geometry::KDTreeFlann kdtree_target(target_feature);
-    pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
-
-#pragma omp parallel for
-    for (int i = 0; i < num_src_pts; i++) {
-        std::vector<int> corres_tmp(1);
-        std::vector<double> dist_tmp(1);
-
-        kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
-        int j = corres_tmp[0];
-        corres_ij[i] = Eigen::Vector2i(i, j);
-    }
-
-    // Do reverse check if mutual_filter is enabled
+    CorrespondenceSet corres_ij;
     if (mutual_filter) {
-        geometry::KDTreeFlann kdtree_source(source_feature);
-        pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
-
-#pragma omp parallel for
-        for (int j = 0; j < num_tgt_pts; ++j) {
-            std::vector<int> corres_tmp(1);
-            std::vector<double> dist_tmp(1);
-            kdtree_source.SearchKNN(
-                    Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
-            int i = corres_tmp[0];
-            corres_ji[j] = Eigen::Vector2i(i, j);
-        }
-
-        pipelines::registration::CorrespondenceSet corres_mutual;
-        for (int i = 0; i < num_src_pts; ++i) {
-            int j = corres_ij[i](1);
-            if (corres_ji[j](0) == i) {
-                corres_mutual.emplace_back(i, j);
-            }
-        }
+        // The fallback reuses the unfiltered correspondences of the same
+        // search.
+        CorrespondenceSet corres_mutual;
+        std::tie(corres_ij, corres_mutual) = MutualCorrespondencesFromFeatures(
+                source_feature, target_feature, matching_option);
 
         // Empirically mutual correspondence set should not be too small
         if (int(corres_mutual.size()) >= ransac_n * 3) {
@@ -342,8 +693,10 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         utility::LogDebug(
                 "Too few correspondences after mutual filter, fall back to "
                 "original correspondences.");
+    } else {
+        corres_ij = CorrespondencesFromFeatures(source_feature, target_feature,
+                                                false, matching_option);
     }
-
     return RegistrationRANSACBasedOnCorrespondence(
             source, target, corres_ij, max_correspondence_distance, estimation,
             ransac_n, checkers, criteria);
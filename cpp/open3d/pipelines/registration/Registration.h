@@ -27,10 +27,12 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
 #include <tuple>
 #include <vector>
 
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
+#include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Eigen.h"
 
@@ -38,11 +40,11 @@ namespace open3d {
 
 namespace geometry {
 class PointCloud;
-}
+class KDTreeFlann;
+}  // namespace geometry
 
 namespace pipelines {
 namespace registration {
-class Feature;
 
 /// \class ICPConvergenceCriteria
 ///
@@ -96,9 +98,16 @@ public:
     /// \param confidence Desired probability of success. Used for estimating
     /// early termination by k = log(1 - confidence)/log(1 -
     /// inlier_ratio^{ransac_n}).
+    /// \param early_rejection_sigma If > 0, a hypothesis is rejected as soon
+    /// as its inlier ratio on the correspondences scored so far is more than
+    /// \p early_rejection_sigma standard deviations below the best inlier
+    /// ratio.
     RANSACConvergenceCriteria(int max_iteration = 100000,
-                              double confidence = 0.999)
-        : max_iteration_(max_iteration), confidence_(confidence) {}
+                              double confidence = 0.999,
+                              double early_rejection_sigma = 0.0)
+        : max_iteration_(max_iteration),
+          confidence_(confidence),
+          early_rejection_sigma_(early_rejection_sigma) {}
 
     ~RANSACConvergenceCriteria() {}
 
@@ -107,6 +116,12 @@ public:
     int max_iteration_;
     /// Desired probability of success.
     double confidence_;
+    /// Number of standard deviations below the best inlier ratio at which a
+    /// hypothesis is rejected before all correspondences are scored, testing
+    /// the correspondences in random order. 0 disables the test: a hypothesis
+    /// is then only rejected early once it cannot beat the best one, which
+    /// does not change the result.
+    double early_rejection_sigma_;
 };
 
 /// \class RegistrationResult
@@ -140,6 +155,58 @@ public:
     double fitness_;
 };
 
+/// \class RegistrationTarget
+///
+/// \brief Target point cloud of registrations, with its KD-tree.
+///
+/// The KD-tree is built once on construction and is only read by the
+/// registrations against the target, so one RegistrationTarget can be shared
+/// by concurrent registrations, e.g. of many scans against one static map.
+class RegistrationTarget {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The target point cloud, which is copied.
+    explicit RegistrationTarget(const geometry::PointCloud &target);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The target point cloud, which is shared and must not be
+    /// modified while the RegistrationTarget is used.
+    explicit RegistrationTarget(
+            std::shared_ptr<const geometry::PointCloud> target);
+    virtual ~RegistrationTarget();
+    RegistrationTarget(const RegistrationTarget &) = delete;
+    RegistrationTarget &operator=(const RegistrationTarget &) = delete;
+
+public:
+    /// Returns the target point cloud.
+    const geometry::PointCloud &GetPointCloud() const { return *target_; }
+    /// Returns the KD-tree of the target point cloud.
+    const geometry::KDTreeFlann &GetKDTree() const { return *kdtree_; }
+
+protected:
+    std::shared_ptr<const geometry::PointCloud> target_;
+    std::unique_ptr<geometry::KDTreeFlann> kdtree_;
+};
+
+/// \class ICPLevelStatistics
+///
+/// Class that contains the statistics of one level of a multi-scale ICP.
+class ICPLevelStatistics {
+public:
+    /// Voxel size of the level. 0 if the level is at full resolution.
+    double voxel_size_ = 0.0;
+    /// Number of ICP iterations run at the level.
+    int num_iterations_ = 0;
+    /// Fitness at the end of the level.
+    double fitness_ = 0.0;
+    /// Inlier RMSE at the end of the level.
+    double inlier_rmse_ = 0.0;
+    /// Time spent on the level in milliseconds, including building its target
+    /// KD-tree.
+    double time_ms_ = 0.0;
+};
+
 /// \brief Function for evaluating registration between point clouds.
 ///
 /// \param source The source point cloud.
@@ -154,6 +221,20 @@ RegistrationResult EvaluateRegistration(
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation = Eigen::Matrix4d::Identity());
 
+/// \brief Function for evaluating registration between point clouds, with a
+/// prebuilt target KD-tree.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud and its KD-tree.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance. \param transformation The 4x4 transformation matrix to transform
+/// source to target.
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation = Eigen::Matrix4d::Identity());
+
 /// \brief Functions for ICP registration.
 ///
 /// \param source The source point cloud.
@@ -173,6 +254,97 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Functions for ICP registration, with a prebuilt target KD-tree.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud and its KD-tree.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance. \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief Function for ICP registration of one source from many initial
+/// transformations, e.g. the candidates of a global registration.
+///
+/// The registrations run in parallel, one per thread, and share the KD-tree
+/// of \p target.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud and its KD-tree.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param inits Initial transformation estimations.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+/// \return The registration result of each initial transformation.
+std::vector<RegistrationResult> RegistrationICPBatch(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &inits,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief Function for ICP registration of many sources against one target.
+///
+/// The registrations run in parallel, one per thread, and share the KD-tree
+/// of \p target.
+///
+/// \param sources The source point clouds.
+/// \param target The target point cloud and its KD-tree.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param inits Initial transformation estimation of each source.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+/// \return The registration result of each source.
+std::vector<RegistrationResult> RegistrationICPBatch(
+        const std::vector<std::shared_ptr<const geometry::PointCloud>>
+                &sources,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &inits,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief Function for coarse-to-fine ICP registration.
+///
+/// Both point clouds are voxel downsampled once to each of \p voxel_sizes,
+/// and ICP runs on the levels in the given order, typically from the largest
+/// voxel size to the smallest, each level starting from the transformation
+/// estimated by the previous one. A KD-tree is built once per target level.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param voxel_sizes Voxel size of each level. A level with a voxel size
+/// <= 0 runs on the input point clouds.
+/// \param criteria_list Convergence criteria of each level.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance of each level.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param level_statistics If not null, set to the statistics of each level.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
+        const std::vector<double> &max_correspondence_distances,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        std::vector<ICPLevelStatistics> *level_statistics = nullptr);
+
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
 ///
@@ -211,6 +383,8 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param ransac_n Fit ransac with `ransac_n` correspondences.
 /// \param checkers Correspondence checker.
 /// \param criteria Convergence criteria.
+/// \param matching_option Options for the nearest neighbor search that
+/// matches the features. The default is an exact search.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -224,7 +398,9 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
         const RANSACConvergenceCriteria &criteria =
-                RANSACConvergenceCriteria());
+                RANSACConvergenceCriteria(),
+        const FeatureMatchingOption &matching_option =
+                FeatureMatchingOption());
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
@@ -34,6 +34,7 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/core/kernel/VoxelDownSample.h"
 #include "open3d/core/linalg/Matmul.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
@@ -148,6 +149,66 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     return *this;
 }
 
+core::Tensor PointCloud::ClusterDBSCAN(double eps, size_t min_points) const {
+    const core::Tensor &points = GetPoints();
+    if (points.GetDtype() != core::Dtype::Float32 &&
+        points.GetDtype() != core::Dtype::Float64) {
+        utility::LogError("Points must be Float32 or Float64, but got {}.",
+                          points.GetDtype().ToString());
+    }
+    if (eps <= 0) {
+        utility::LogError("eps must be positive, but got {}.", eps);
+    }
+    core::Tensor labels;
+    kernel::pointcloud::ClusterDBSCAN(points.Contiguous(), eps, min_points,
+                                      labels);
+    return labels;
+}
+
+PointCloud PointCloud::VoxelDownSample(double voxel_size,
+                                       VoxelDownSampleMode mode) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive, but got {}.",
+                          voxel_size);
+    }
+    const core::Tensor &points = GetPoints();
+    if (points.GetLength() == 0) {
+        return Clone();
+    }
+
+    const core::Tensor origin = GetMinBound().Sub(voxel_size * 0.5);
+    core::Tensor order, splits;
+    core::kernel::VoxelSegments(points, voxel_size, origin, order, splits);
+    const int64_t num_voxels = splits.GetLength() - 1;
+
+    PointCloud pcd_down(device_);
+    if (mode == VoxelDownSampleMode::Mean) {
+        for (const auto &kv : point_attr_) {
+            pcd_down.SetPointAttr(
+                    kv.first,
+                    core::kernel::VoxelMean(kv.second, order, splits));
+        }
+        return pcd_down;
+    }
+
+    core::Tensor selected;
+    if (mode == VoxelDownSampleMode::First) {
+        selected = order.IndexGet({splits.Slice(0, 0, num_voxels)});
+    } else {
+        core::Tensor centers;
+        core::kernel::VoxelCenters(points, voxel_size, origin, order, splits,
+                                   centers, selected);
+        pcd_down.SetPoints(centers);
+    }
+    for (const auto &kv : point_attr_) {
+        if (mode == VoxelDownSampleMode::Center && kv.first == "points") {
+            continue;
+        }
+        pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({selected}));
+    }
+    return pcd_down;
+}
+
 PointCloud PointCloud::CreateFromDepthImage(const Image &depth,
                                             const core::Tensor &intrinsics,
                                             const core::Tensor &extrinsics,
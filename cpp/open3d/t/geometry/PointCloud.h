@@ -42,6 +42,8 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+using open3d::geometry::VoxelDownSampleMode;
+
 /// \class PointCloud
 /// \brief A pointcloud contains a set of 3D points.
 ///
@@ -292,6 +294,33 @@ public:
     /// \return Rotated pointcloud
     PointCloud &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Cluster PointCloud using the DBSCAN algorithm
+    /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
+    /// in Large Spatial Databases with Noise", 1996
+    ///
+    /// The neighborhoods are searched in parallel and never stored; the core
+    /// points are merged with a concurrent union-find. The labels are the
+    /// same as the legacy PointCloud::ClusterDBSCAN. Only CPU is supported.
+    ///
+    /// \param eps Density parameter that is used to find neighbouring points.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \return Int32 tensor of shape {N} with the point labels, -1 indicates
+    /// noise.
+    core::Tensor ClusterDBSCAN(double eps, size_t min_points) const;
+
+    /// \brief Downsamples the point cloud with a voxel grid.
+    ///
+    /// Every attribute is reduced with \p mode. The voxels are the ones of
+    /// the legacy PointCloud::VoxelDownSample, and the result is sorted by
+    /// voxel. CUDA point clouds are processed on the CPU.
+    ///
+    /// \param voxel_size Edge length of the voxels.
+    /// \param mode How the points of a voxel are merged. With
+    /// VoxelDownSampleMode::Mean, integer attributes are truncated.
+    PointCloud VoxelDownSample(
+            double voxel_size,
+            VoxelDownSampleMode mode = VoxelDownSampleMode::Mean) const;
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
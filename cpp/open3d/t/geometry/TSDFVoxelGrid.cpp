@@ -245,6 +245,49 @@ TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh() {
     return mesh;
 }
 
+std::unordered_map<std::string, Image> TSDFVoxelGrid::RayCast(
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        int width,
+        int height,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        float weight_threshold) {
+    const int64_t num_blocks = block_hashmap_->Size();
+    const int64_t capacity = block_hashmap_->GetCapacity();
+    if (num_blocks != raycast_block_count_ ||
+        capacity != raycast_block_capacity_) {
+        core::Tensor active_addrs;
+        block_hashmap_->GetActiveIndices(active_addrs);
+        active_addrs = active_addrs.To(core::Dtype::Int64);
+        core::Tensor active_keys =
+                block_hashmap_->GetKeyTensor().IndexGet({active_addrs});
+        kernel::tsdf::BuildBlockLookup(active_keys, active_addrs,
+                                       raycast_block_codes_,
+                                       raycast_block_addrs_);
+        raycast_block_count_ = num_blocks;
+        raycast_block_capacity_ = capacity;
+    }
+
+    core::Tensor depth_map, vertex_map, normal_map, color_map;
+    kernel::tsdf::RayCast(raycast_block_codes_, raycast_block_addrs_,
+                          block_hashmap_->GetValueTensor(), depth_map,
+                          vertex_map, normal_map, color_map, intrinsics,
+                          extrinsics, height, width, block_resolution_,
+                          voxel_size_, sdf_trunc_, depth_scale, depth_min,
+                          depth_max, weight_threshold);
+
+    std::unordered_map<std::string, Image> images;
+    images.emplace("depth", Image(depth_map));
+    images.emplace("vertex", Image(vertex_map));
+    images.emplace("normal", Image(normal_map));
+    if (color_map.NumElements() != 0) {
+        images.emplace("color", Image(color_map));
+    }
+    return images;
+}
+
 TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
@@ -90,6 +90,26 @@ public:
     /// Extract mesh near iso-surfaces with Marching Cubes.
     TriangleMesh ExtractSurfaceMesh();
 
+    /// Render the iso-surface from a camera by marching rays through the
+    /// voxel blocks. Rays skip unallocated blocks as a whole.
+    /// Returns Float32 images of the given size with keys "depth" (1 channel,
+    /// multiplied by \p depth_scale), "vertex" and "normal" (3 channels, in
+    /// the camera coordinate frame), and "color" (3 channels in [0, 1]) if the
+    /// voxels have colors. Pixels without a surface hit are zero.
+    /// \param intrinsics Pinhole camera matrix of shape {3, 3}.
+    /// \param extrinsics World to camera transform of shape {4, 4}.
+    /// \param weight_threshold Voxels with smaller or equal weights are
+    /// treated as unobserved.
+    std::unordered_map<std::string, Image> RayCast(
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            int width,
+            int height,
+            float depth_scale = 1000.0f,
+            float depth_min = 0.1f,
+            float depth_max = 3.0f,
+            float weight_threshold = 3.0f);
+
     /// Convert TSDFVoxelGrid to the target device.
     /// \param device The targeted device to convert to.
     /// \param copy If true, a new TSDFVoxelGrid is always created; if false,
@@ -134,6 +154,15 @@ protected:
 
     std::shared_ptr<core::Hashmap> block_hashmap_;
 
+    /// Block lookup of RayCast, see kernel::tsdf::BuildBlockLookup. Blocks
+    /// are never erased, and only move when the block hashmap is rehashed,
+    /// so the lookup is rebuilt when Integrate changed the block count or the
+    /// capacity of the block hashmap.
+    core::Tensor raycast_block_codes_;
+    core::Tensor raycast_block_addrs_;
+    int64_t raycast_block_count_ = -1;
+    int64_t raycast_block_capacity_ = -1;
+
     std::unordered_map<std::string, core::Dtype> attr_dtype_map_;
 };
 }  // namespace geometry
@@ -64,6 +64,18 @@ void Unproject(const core::Tensor& depth,
         utility::LogError("Unimplemented device");
     }
 }
+
+void ClusterDBSCAN(const core::Tensor& points,
+                   double eps,
+                   size_t min_points,
+                   core::Tensor& labels) {
+    core::Device device = points.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ClusterDBSCANCPU(points, eps, min_points, labels);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
@@ -60,6 +60,19 @@ void UnprojectCUDA(const core::Tensor& depth,
                    float depth_max,
                    int64_t stride);
 #endif
+
+/// Labels the points with DBSCAN, streaming the neighborhoods through a
+/// union-find of the core points. \p labels is an Int32 tensor of shape {N}
+/// and -1 marks noise. Only CPU is implemented.
+void ClusterDBSCAN(const core::Tensor& points,
+                   double eps,
+                   size_t min_points,
+                   core::Tensor& labels);
+
+void ClusterDBSCANCPU(const core::Tensor& points,
+                      double eps,
+                      size_t min_points,
+                      core::Tensor& labels);
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
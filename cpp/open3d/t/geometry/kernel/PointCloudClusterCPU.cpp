@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/CoreUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelFor.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/ConcurrentUnionFind.h"
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace pointcloud {
+
+/// Calls \p func(j) for each point j closer than \p eps to \p pos, in the
+/// hash grid of a FixedRadiusIndex built with radius eps, until \p func
+/// returns false.
+template <typename scalar_t, typename func_t>
+static void ForEachNeighbor(const utility::MiniVec<scalar_t, 3> &pos,
+                            scalar_t eps,
+                            scalar_t inv_voxel_size,
+                            int64_t hash_table_size,
+                            const int64_t *splits_ptr,
+                            const int64_t *index_ptr,
+                            const scalar_t *sorted_ptr,
+                            func_t func) {
+    const utility::MiniVec<int, 3> voxel_min =
+            core::nns::ComputeVoxelIndex(pos - eps, inv_voxel_size);
+    const utility::MiniVec<int, 3> voxel_max =
+            core::nns::ComputeVoxelIndex(pos + eps, inv_voxel_size);
+    int64_t buckets[27];
+    int num_buckets = 0;
+    for (int z = voxel_min[2]; z <= voxel_max[2]; ++z) {
+        for (int y = voxel_min[1]; y <= voxel_max[1]; ++y) {
+            for (int x = voxel_min[0]; x <= voxel_max[0]; ++x) {
+                const int64_t bucket = static_cast<int64_t>(
+                        core::nns::SpatialHash(x, y, z) % hash_table_size);
+                if (std::find(buckets, buckets + num_buckets, bucket) ==
+                    buckets + num_buckets) {
+                    buckets[num_buckets++] = bucket;
+                }
+            }
+        }
+    }
+
+    const scalar_t eps2 = eps * eps;
+    for (int k = 0; k < num_buckets; ++k) {
+        for (int64_t j = splits_ptr[buckets[k]]; j < splits_ptr[buckets[k] + 1];
+             ++j) {
+            const scalar_t *p = sorted_ptr + 3 * j;
+            const scalar_t dx = p[0] - pos[0];
+            const scalar_t dy = p[1] - pos[1];
+            const scalar_t dz = p[2] - pos[2];
+            if (dx * dx + dy * dy + dz * dz < eps2 && !func(index_ptr[j])) {
+                return;
+            }
+        }
+    }
+}
+
+void ClusterDBSCANCPU(const core::Tensor &points,
+                      double eps,
+                      size_t min_points,
+                      core::Tensor &labels) {
+    const int64_t num_points = points.GetLength();
+    labels = core::Tensor::Full({num_points}, -1, core::Dtype::Int32,
+                                points.GetDevice());
+    if (num_points == 0) {
+        return;
+    }
+    int32_t *labels_ptr = static_cast<int32_t *>(labels.GetDataPtr());
+
+    core::nns::FixedRadiusIndex index(points, eps);
+    const core::Tensor &cell_splits = index.GetHashTableCellSplits();
+    const int64_t hash_table_size = cell_splits.GetLength() - 1;
+    const int64_t *splits_ptr =
+            static_cast<const int64_t *>(cell_splits.GetDataPtr());
+    const int64_t *index_ptr = static_cast<const int64_t *>(
+            index.GetHashTableIndex().GetDataPtr());
+
+    std::vector<char> is_core(num_points);
+    utility::ConcurrentUnionFind<int64_t> union_find(num_points);
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        using Vec3_t = utility::MiniVec<scalar_t, 3>;
+        const scalar_t *points_ptr =
+                static_cast<const scalar_t *>(points.GetDataPtr());
+        const scalar_t *sorted_ptr = static_cast<const scalar_t *>(
+                index.GetSortedPoints().GetDataPtr());
+        const scalar_t r = static_cast<scalar_t>(eps);
+        const scalar_t inv_voxel_size = static_cast<scalar_t>(0.5 / eps);
+        auto for_each_neighbor = [&](int64_t i, auto func) {
+            ForEachNeighbor(Vec3_t(points_ptr + 3 * i), r, inv_voxel_size,
+                            hash_table_size, splits_ptr, index_ptr, sorted_ptr,
+                            func);
+        };
+
+        // Core points, counting their neighbors up to min_points.
+        core::kernel::ParallelFor(
+                num_points, 256, [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        size_t count = 0;
+                        for_each_neighbor(i, [&](int64_t) {
+                            return ++count < min_points;
+                        });
+                        is_core[i] = count >= min_points;
+                    }
+                });
+
+        // Neighborhoods are symmetric, so each pair of core points is merged
+        // from its larger index.
+        core::kernel::ParallelFor(
+                num_points, 256, [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        if (!is_core[i]) {
+                            continue;
+                        }
+                        for_each_neighbor(i, [&](int64_t j) {
+                            if (j < i && is_core[j]) {
+                                union_find.Union(i, j);
+                            }
+                            return true;
+                        });
+                    }
+                });
+
+        // The root of each cluster is its smallest core point, so numbering
+        // the roots in order labels the clusters like the serial expansion.
+        int32_t cluster_label = 0;
+        for (int64_t i = 0; i < num_points; ++i) {
+            if (is_core[i] && union_find.Find(i) == i) {
+                labels_ptr[i] = cluster_label++;
+            }
+        }
+        core::kernel::ParallelFor(
+                num_points, 4096, [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        const int64_t root =
+                                is_core[i] ? union_find.Find(i) : i;
+                        if (root != i) {
+                            labels_ptr[i] = labels_ptr[root];
+                        }
+                    }
+                });
+
+        // Border points join the cluster with the smallest label among their
+        // core neighbors.
+        core::kernel::ParallelFor(
+                num_points, 256, [&](int64_t start, int64_t end) {
+                    for (int64_t i = start; i < end; ++i) {
+                        if (is_core[i]) {
+                            continue;
+                        }
+                        int32_t label = -1;
+                        for_each_neighbor(i, [&](int64_t j) {
+                            if (is_core[j] &&
+                                (label == -1 || labels_ptr[j] < label)) {
+                                label = labels_ptr[j];
+                            }
+                            return true;
+                        });
+                        labels_ptr[i] = label;
+                    }
+                });
+    });
+}
+
+}  // namespace pointcloud
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
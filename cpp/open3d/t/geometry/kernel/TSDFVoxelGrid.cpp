@@ -74,7 +74,9 @@ void Integrate(const core::Tensor& depth,
                float depth_max) {
     core::Device device = depth.GetDevice();
 
-    if (color.GetDevice() != device) {
+    // Color is optional for depth-only integration.
+    bool has_color = color.NumElements() != 0;
+    if (has_color && color.GetDevice() != device) {
         utility::LogError("Incompatible color device type for depth and color");
     }
     if (block_indices.GetDevice() != device ||
@@ -85,7 +87,8 @@ void Integrate(const core::Tensor& depth,
     }
 
     core::Tensor depthf32 = depth.To(core::Dtype::Float32);
-    core::Tensor colorf32 = color.To(core::Dtype::Float32);
+    core::Tensor colorf32 =
+            has_color ? color.To(core::Dtype::Float32) : core::Tensor();
     core::Tensor intrinsicsf32 = intrinsics.To(device, core::Dtype::Float32);
     core::Tensor extrinsicsf32 = extrinsics.To(device, core::Dtype::Float32);
 
@@ -171,6 +174,71 @@ void ExtractSurfaceMesh(const core::Tensor& block_indices,
         utility::LogError("Unimplemented device");
     }
 }
+
+void BuildBlockLookup(const core::Tensor& block_keys,
+                      const core::Tensor& block_addrs,
+                      core::Tensor& block_codes,
+                      core::Tensor& sorted_block_addrs) {
+    // Ray casting runs on the host, see RayCast.
+    core::Device host("CPU:0");
+    BuildBlockLookupCPU(block_keys.To(host), block_addrs.To(host), block_codes,
+                        sorted_block_addrs);
+}
+
+void RayCast(const core::Tensor& block_codes,
+             const core::Tensor& block_addrs,
+             const core::Tensor& block_values,
+             core::Tensor& depth_map,
+             core::Tensor& vertex_map,
+             core::Tensor& normal_map,
+             core::Tensor& color_map,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t height,
+             int64_t width,
+             int64_t block_resolution,
+             float voxel_size,
+             float sdf_trunc,
+             float depth_scale,
+             float depth_min,
+             float depth_max,
+             float weight_threshold) {
+    core::Device device = block_values.GetDevice();
+    core::Device host("CPU:0");
+    if (block_codes.GetDevice() != host || block_addrs.GetDevice() != host) {
+        utility::LogError("The block lookup of RayCast must be on the host.");
+    }
+
+    core::Tensor intrinsicsf32 = intrinsics.To(host, core::Dtype::Float32);
+    core::Tensor extrinsicsf32 = extrinsics.To(host, core::Dtype::Float32);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RayCastCPU(block_codes, block_addrs, block_values, depth_map,
+                   vertex_map, normal_map, color_map, intrinsicsf32,
+                   extrinsicsf32, height, width, block_resolution, voxel_size,
+                   sdf_trunc, depth_scale, depth_min, depth_max,
+                   weight_threshold);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        // There is no CUDA ray casting kernel yet, so cast a CPU copy of the
+        // blocks and move the maps back.
+        RayCastCPU(block_codes, block_addrs, block_values.To(host),
+                   depth_map, vertex_map, normal_map, color_map, intrinsicsf32,
+                   extrinsicsf32, height, width, block_resolution, voxel_size,
+                   sdf_trunc, depth_scale, depth_min, depth_max,
+                   weight_threshold);
+        depth_map = depth_map.To(device);
+        vertex_map = vertex_map.To(device);
+        normal_map = normal_map.To(device);
+        color_map = color_map.To(device);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
 }  // namespace tsdf
 }  // namespace kernel
 }  // namespace geometry
@@ -78,6 +78,36 @@ void ExtractSurfaceMesh(const core::Tensor& block_indices,
                         int64_t block_resolution,
                         float voxel_size);
 
+/// Builds the block lookup of RayCast on the host: the {N, 3} Int32
+/// \p block_keys are packed into {N} Int64 \p block_codes sorted in
+/// ascending order, and \p sorted_block_addrs are the Int64 addresses of
+/// \p block_addrs in the same order.
+void BuildBlockLookup(const core::Tensor& block_keys,
+                      const core::Tensor& block_addrs,
+                      core::Tensor& block_codes,
+                      core::Tensor& sorted_block_addrs);
+
+/// \p block_codes and \p block_addrs are the host lookup built by
+/// BuildBlockLookup().
+void RayCast(const core::Tensor& block_codes,
+             const core::Tensor& block_addrs,
+             const core::Tensor& block_values,
+             core::Tensor& depth_map,
+             core::Tensor& vertex_map,
+             core::Tensor& normal_map,
+             core::Tensor& color_map,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t height,
+             int64_t width,
+             int64_t block_resolution,
+             float voxel_size,
+             float sdf_trunc,
+             float depth_scale,
+             float depth_min,
+             float depth_max,
+             float weight_threshold);
+
 void TouchCPU(const core::Tensor& points,
               core::Tensor& voxel_block_coords,
               int64_t voxel_grid_resolution,
@@ -121,6 +151,30 @@ void ExtractSurfaceMeshCPU(const core::Tensor& block_indices,
                            int64_t block_resolution,
                            float voxel_size);
 
+void BuildBlockLookupCPU(const core::Tensor& block_keys,
+                         const core::Tensor& block_addrs,
+                         core::Tensor& block_codes,
+                         core::Tensor& sorted_block_addrs);
+
+void RayCastCPU(const core::Tensor& block_codes,
+                const core::Tensor& block_addrs,
+                const core::Tensor& block_values,
+                core::Tensor& depth_map,
+                core::Tensor& vertex_map,
+                core::Tensor& normal_map,
+                core::Tensor& color_map,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                int64_t height,
+                int64_t width,
+                int64_t block_resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_scale,
+                float depth_min,
+                float depth_max,
+                float weight_threshold);
+
 #ifdef BUILD_CUDA_MODULE
 void TouchCUDA(const core::Tensor& points,
                core::Tensor& voxel_block_coords,
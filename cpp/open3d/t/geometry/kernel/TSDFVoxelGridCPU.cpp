@@ -26,6 +26,10 @@
 
 #include <tbb/concurrent_unordered_set.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
@@ -124,6 +128,364 @@ void TouchCPU(const core::Tensor& points,
         block_coords_ptr[offset + 2] = static_cast<int>(it->z_);
     }
 }
+
+// Block coordinates in [-kBlockCoordOffset, kBlockCoordOffset) are packed
+// into 21 bits each of an Int64 code.
+static constexpr int64_t kBlockCoordOffset = int64_t(1) << 20;
+
+static bool IsBlockCoordPackable(int xb, int yb, int zb) {
+    return xb >= -kBlockCoordOffset && xb < kBlockCoordOffset &&
+           yb >= -kBlockCoordOffset && yb < kBlockCoordOffset &&
+           zb >= -kBlockCoordOffset && zb < kBlockCoordOffset;
+}
+
+static int64_t PackBlockCoord(int xb, int yb, int zb) {
+    return ((xb + kBlockCoordOffset) << 42) | ((yb + kBlockCoordOffset) << 21) |
+           (zb + kBlockCoordOffset);
+}
+
+void BuildBlockLookupCPU(const core::Tensor& block_keys,
+                         const core::Tensor& block_addrs,
+                         core::Tensor& block_codes,
+                         core::Tensor& sorted_block_addrs) {
+    core::Tensor keys = block_keys.Contiguous();
+    const int* keys_ptr = static_cast<const int*>(keys.GetDataPtr());
+    int64_t n_blocks = keys.GetLength();
+
+    core::Tensor codes({n_blocks}, core::Dtype::Int64, keys.GetDevice());
+    int64_t* codes_ptr = static_cast<int64_t*>(codes.GetDataPtr());
+    std::atomic<bool> packable(true);
+    core::kernel::CPULauncher::LaunchGeneralKernel(
+            n_blocks, [&](int64_t workload_idx) {
+                const int* key = keys_ptr + 3 * workload_idx;
+                if (!IsBlockCoordPackable(key[0], key[1], key[2])) {
+                    packable = false;
+                    return;
+                }
+                codes_ptr[workload_idx] =
+                        PackBlockCoord(key[0], key[1], key[2]);
+            });
+    if (!packable) {
+        utility::LogError(
+                "Block coordinates must be in [{}, {}) for ray casting.",
+                -kBlockCoordOffset, kBlockCoordOffset);
+    }
+
+    if (n_blocks == 0) {
+        block_codes = codes;
+        sorted_block_addrs = codes.Clone();
+        return;
+    }
+    core::Tensor order = codes.ArgSort();
+    block_codes = codes.IndexGet({order});
+    sorted_block_addrs = block_addrs.To(core::Dtype::Int64).IndexGet({order});
+}
+
+// Looks up voxels by their global voxel coordinates. Blocks are binary
+// searched in the sorted block codes. The last block is cached, since
+// consecutive samples along a ray mostly fall in the same block.
+template <typename voxel_t>
+class VoxelBlockLookup {
+public:
+    VoxelBlockLookup(const int64_t* block_codes,
+                     const int64_t* block_addrs,
+                     int64_t n_blocks,
+                     const NDArrayIndexer& block_values_indexer,
+                     int resolution)
+        : block_codes_(block_codes),
+          block_addrs_(block_addrs),
+          n_blocks_(n_blocks),
+          block_values_indexer_(block_values_indexer),
+          resolution_(resolution) {}
+
+    int FloorDiv(int x) const {
+        return x >= 0 ? x / resolution_ : -((-x - 1) / resolution_) - 1;
+    }
+
+    // Returns the address of block (xb, yb, zb), or -1 if it is missing.
+    int64_t GetBlockAddr(int xb, int yb, int zb) {
+        if (!cached_ || xb != xb_ || yb != yb_ || zb != zb_) {
+            addr_ = -1;
+            if (IsBlockCoordPackable(xb, yb, zb)) {
+                const int64_t code = PackBlockCoord(xb, yb, zb);
+                const int64_t* end = block_codes_ + n_blocks_;
+                const int64_t* it = std::lower_bound(block_codes_, end, code);
+                if (it != end && *it == code) {
+                    addr_ = block_addrs_[it - block_codes_];
+                }
+            }
+            xb_ = xb;
+            yb_ = yb;
+            zb_ = zb;
+            cached_ = true;
+        }
+        return addr_;
+    }
+
+    voxel_t* GetVoxelAt(int x, int y, int z) {
+        int xb = FloorDiv(x), yb = FloorDiv(y), zb = FloorDiv(z);
+        int64_t addr = GetBlockAddr(xb, yb, zb);
+        if (addr < 0) return nullptr;
+        return block_values_indexer_.GetDataPtrFromCoord<voxel_t>(
+                x - xb * resolution_, y - yb * resolution_,
+                z - zb * resolution_, addr);
+    }
+
+    // Trilinear TSDF at a continuous voxel coordinate. Fails if any of the 8
+    // voxels around it is missing or has a weight <= weight_threshold.
+    bool GetTSDFAt(float x, float y, float z, float weight_threshold,
+                   float* tsdf) {
+        int x0 = static_cast<int>(std::floor(x));
+        int y0 = static_cast<int>(std::floor(y));
+        int z0 = static_cast<int>(std::floor(z));
+        float rx = x - x0, ry = y - y0, rz = z - z0;
+        float sum = 0;
+        for (int i = 0; i < 8; ++i) {
+            int dx = i & 1, dy = (i >> 1) & 1, dz = (i >> 2) & 1;
+            voxel_t* voxel = GetVoxelAt(x0 + dx, y0 + dy, z0 + dz);
+            if (voxel == nullptr || voxel->GetWeight() <= weight_threshold) {
+                return false;
+            }
+            sum += (dx ? rx : 1 - rx) * (dy ? ry : 1 - ry) *
+                   (dz ? rz : 1 - rz) * voxel->GetTSDF();
+        }
+        *tsdf = sum;
+        return true;
+    }
+
+private:
+    const int64_t* block_codes_;
+    const int64_t* block_addrs_;
+    int64_t n_blocks_;
+    const NDArrayIndexer& block_values_indexer_;
+    int resolution_;
+
+    bool cached_ = false;
+    int xb_ = 0;
+    int yb_ = 0;
+    int zb_ = 0;
+    int64_t addr_ = -1;
+};
+
+void RayCastCPU(const core::Tensor& block_codes,
+                const core::Tensor& block_addrs,
+                const core::Tensor& block_values,
+                core::Tensor& depth_map,
+                core::Tensor& vertex_map,
+                core::Tensor& normal_map,
+                core::Tensor& color_map,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                int64_t height,
+                int64_t width,
+                int64_t block_resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_scale,
+                float depth_min,
+                float depth_max,
+                float weight_threshold) {
+    int resolution = static_cast<int>(block_resolution);
+    core::Device device = block_values.GetDevice();
+
+    // Sorted block codes -> block addresses in block_values.
+    core::Tensor codes = block_codes.Contiguous();
+    core::Tensor addrs = block_addrs.Contiguous();
+    const int64_t* codes_ptr = static_cast<const int64_t*>(codes.GetDataPtr());
+    const int64_t* addrs_ptr = static_cast<const int64_t*>(addrs.GetDataPtr());
+    int64_t n_blocks = codes.GetLength();
+
+    // The extrinsics map world to camera; rays need the inverse rigid
+    // transform, and normals the world to camera rotation.
+    core::Tensor extrinsics_c = extrinsics.Contiguous();
+    const float* e = static_cast<const float*>(extrinsics_c.GetDataPtr());
+    std::vector<float> pose(16, 0);
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            pose[r * 4 + c] = e[c * 4 + r];
+        }
+        pose[r * 4 + 3] =
+                -(e[r] * e[3] + e[4 + r] * e[7] + e[8 + r] * e[11]);
+    }
+    pose[15] = 1;
+    TransformIndexer transform_indexer(
+            intrinsics, core::Tensor(pose, {4, 4}, core::Dtype::Float32),
+            1.0f);
+    float ox, oy, oz;
+    transform_indexer.RigidTransform(0, 0, 0, &ox, &oy, &oz);
+
+    depth_map = core::Tensor::Zeros({height, width, 1}, core::Dtype::Float32,
+                                    device);
+    vertex_map = core::Tensor::Zeros({height, width, 3}, core::Dtype::Float32,
+                                     device);
+    normal_map = core::Tensor::Zeros({height, width, 3}, core::Dtype::Float32,
+                                     device);
+    float* depth_ptr = static_cast<float*>(depth_map.GetDataPtr());
+    float* vertex_ptr = static_cast<float*>(vertex_map.GetDataPtr());
+    float* normal_ptr = static_cast<float*>(normal_map.GetDataPtr());
+
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
+    const float inv_voxel_size = 1.0f / voxel_size;
+
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                float* color_ptr = nullptr;
+                color_map = core::Tensor();
+                if (voxel_t::HasColor()) {
+                    color_map = core::Tensor::Zeros(
+                            {height, width, 3}, core::Dtype::Float32, device);
+                    color_ptr = static_cast<float*>(color_map.GetDataPtr());
+                }
+
+                core::kernel::CPULauncher::LaunchGeneralKernel(
+                        height * width, [&](int64_t workload_idx) {
+                            VoxelBlockLookup<voxel_t> lookup(
+                                    codes_ptr, addrs_ptr, n_blocks,
+                                    voxel_block_buffer_indexer, resolution);
+
+                            // Ray through the pixel, parameterized by the
+                            // camera depth t.
+                            float xc, yc, zc, px, py, pz;
+                            transform_indexer.Unproject(
+                                    static_cast<float>(workload_idx % width),
+                                    static_cast<float>(workload_idx / width),
+                                    1.0f, &xc, &yc, &zc);
+                            transform_indexer.RigidTransform(xc, yc, zc, &px,
+                                                             &py, &pz);
+                            const float o[3] = {ox, oy, oz};
+                            const float d[3] = {px - ox, py - oy, pz - oz};
+                            const float d_norm = std::sqrt(
+                                    d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+
+                            float t = depth_min, t_prev = depth_min;
+                            float tsdf = 0, tsdf_prev = 0;
+                            bool has_prev = false, hit = false;
+                            while (t < depth_max) {
+                                int v[3], b[3];
+                                for (int i = 0; i < 3; ++i) {
+                                    v[i] = static_cast<int>(std::floor(
+                                            (o[i] + t * d[i]) * inv_voxel_size +
+                                            0.5f));
+                                    b[i] = lookup.FloorDiv(v[i]);
+                                }
+                                int64_t addr =
+                                        lookup.GetBlockAddr(b[0], b[1], b[2]);
+                                if (addr < 0) {
+                                    // Skip the whole missing block.
+                                    float t_exit = depth_max;
+                                    for (int i = 0; i < 3; ++i) {
+                                        if (d[i] == 0) continue;
+                                        float bound =
+                                                ((b[i] + (d[i] > 0)) *
+                                                         resolution -
+                                                 0.5f) *
+                                                voxel_size;
+                                        t_exit = std::min(
+                                                t_exit, (bound - o[i]) / d[i]);
+                                    }
+                                    t = std::max(t_exit, t) +
+                                        0.01f * voxel_size / d_norm;
+                                    has_prev = false;
+                                    continue;
+                                }
+
+                                voxel_t* voxel = lookup.GetVoxelAt(v[0], v[1],
+                                                                   v[2]);
+                                if (voxel->GetWeight() <= weight_threshold) {
+                                    has_prev = false;
+                                    t += voxel_size / d_norm;
+                                    continue;
+                                }
+                                tsdf = voxel->GetTSDF();
+                                if (has_prev && tsdf_prev > 0 && tsdf <= 0) {
+                                    hit = true;
+                                    break;
+                                }
+                                has_prev = true;
+                                tsdf_prev = tsdf;
+                                t_prev = t;
+                                t += std::max(tsdf * sdf_trunc, voxel_size) /
+                                     d_norm;
+                            }
+                            if (!hit) return;
+
+                            // Locate the zero crossing, with trilinear TSDFs
+                            // when both ends have them.
+                            auto TSDFAt = [&](float ts, float* f) {
+                                return lookup.GetTSDFAt(
+                                        (o[0] + ts * d[0]) * inv_voxel_size,
+                                        (o[1] + ts * d[1]) * inv_voxel_size,
+                                        (o[2] + ts * d[2]) * inv_voxel_size,
+                                        weight_threshold, f);
+                            };
+                            float f_prev, f_curr;
+                            if (TSDFAt(t_prev, &f_prev) && TSDFAt(t, &f_curr) &&
+                                f_prev > 0 && f_curr <= 0) {
+                                tsdf_prev = f_prev;
+                                tsdf = f_curr;
+                            }
+                            float t_hit = t_prev + (t - t_prev) * tsdf_prev /
+                                                           (tsdf_prev - tsdf);
+
+                            depth_ptr[workload_idx] = t_hit * depth_scale;
+                            float* vertex = vertex_ptr + 3 * workload_idx;
+                            vertex[0] = xc * t_hit;
+                            vertex[1] = yc * t_hit;
+                            vertex[2] = t_hit;
+
+                            // TSDF gradient, rotated to the camera frame.
+                            float g[3], n[3] = {0, 0, 0};
+                            for (int i = 0; i < 3; ++i) {
+                                g[i] = (o[i] + t_hit * d[i]) * inv_voxel_size;
+                            }
+                            bool has_normal = true;
+                            for (int i = 0; i < 3 && has_normal; ++i) {
+                                float fp = 0, fn = 0;
+                                has_normal = lookup.GetTSDFAt(
+                                                     g[0] + (i == 0),
+                                                     g[1] + (i == 1),
+                                                     g[2] + (i == 2),
+                                                     weight_threshold, &fp) &&
+                                             lookup.GetTSDFAt(
+                                                     g[0] - (i == 0),
+                                                     g[1] - (i == 1),
+                                                     g[2] - (i == 2),
+                                                     weight_threshold, &fn);
+                                if (has_normal) {
+                                    n[i] = fp - fn;
+                                }
+                            }
+                            float n_norm = std::sqrt(n[0] * n[0] + n[1] * n[1] +
+                                                     n[2] * n[2]);
+                            if (has_normal && n_norm > 0) {
+                                float* normal = normal_ptr + 3 * workload_idx;
+                                for (int r = 0; r < 3; ++r) {
+                                    normal[r] = (e[r * 4 + 0] * n[0] +
+                                                 e[r * 4 + 1] * n[1] +
+                                                 e[r * 4 + 2] * n[2]) /
+                                                n_norm;
+                                }
+                            }
+
+                            if (color_ptr != nullptr) {
+                                voxel_t* voxel = lookup.GetVoxelAt(
+                                        static_cast<int>(
+                                                std::floor(g[0] + 0.5f)),
+                                        static_cast<int>(
+                                                std::floor(g[1] + 0.5f)),
+                                        static_cast<int>(
+                                                std::floor(g[2] + 0.5f)));
+                                if (voxel != nullptr) {
+                                    float* color = color_ptr + 3 * workload_idx;
+                                    color[0] = voxel->GetR() / 255.0f;
+                                    color[1] = voxel->GetG() / 255.0f;
+                                    color[2] = voxel->GetB() / 255.0f;
+                                }
+                            }
+                        },
+                        width);
+            });
+}
 }  // namespace tsdf
 }  // namespace kernel
 }  // namespace geometry
@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/ComputeTransform.h"
+
+#include <string>
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// The kernels dereference the correspondences without further checks.
+static void AssertIndicesInRange(const core::Tensor &indices,
+                                 int64_t num_points,
+                                 const std::string &name) {
+    const int64_t min_index = indices.Min({0}).Item<int64_t>();
+    const int64_t max_index = indices.Max({0}).Item<int64_t>();
+    if (min_index < 0 || max_index >= num_points) {
+        utility::LogError(
+                "{} correspondence indices must be in [0, {}), but got values "
+                "in [{}, {}].",
+                name, num_points, min_index, max_index);
+    }
+}
+
+static void AssertCorrespondences(const core::Tensor &source_points,
+                                  const core::Tensor &target_points,
+                                  const core::Tensor &source_indices,
+                                  const core::Tensor &target_indices) {
+    core::Device device = source_points.GetDevice();
+    core::Dtype dtype = source_points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError("Unsupported dtype {} of source points.",
+                          dtype.ToString());
+    }
+    source_points.AssertShapeCompatible({utility::nullopt, 3});
+    target_points.AssertShapeCompatible({utility::nullopt, 3});
+    target_points.AssertDtype(dtype);
+    target_points.AssertDevice(device);
+    source_indices.AssertDtype(core::Dtype::Int64);
+    source_indices.AssertDevice(device);
+    target_indices.AssertDtype(core::Dtype::Int64);
+    target_indices.AssertDevice(device);
+    target_indices.AssertShape(source_indices.GetShape());
+    if (source_indices.NumDims() != 1 || source_indices.GetLength() == 0) {
+        utility::LogError(
+                "Correspondence indices must have shape {{C}} with C > 0, but "
+                "got {}.",
+                source_indices.GetShape().ToString());
+    }
+    AssertIndicesInRange(source_indices, source_points.GetLength(), "Source");
+    AssertIndicesInRange(target_indices, target_points.GetLength(), "Target");
+}
+
+/// Determinant of a row-major 3x3 matrix.
+static double Det3x3(const double *m) {
+    return m[0] * (m[4] * m[8] - m[5] * m[7]) -
+           m[1] * (m[3] * m[8] - m[5] * m[6]) +
+           m[2] * (m[3] * m[7] - m[4] * m[6]);
+}
+
+core::Tensor ComputePosePointToPlane(const core::Tensor &source_points,
+                                     const core::Tensor &target_points,
+                                     const core::Tensor &target_normals,
+                                     const core::Tensor &source_indices,
+                                     const core::Tensor &target_indices,
+                                     double &residual) {
+    AssertCorrespondences(source_points, target_points, source_indices,
+                          target_indices);
+    target_normals.AssertShape(target_points.GetShape());
+    target_normals.AssertDtype(source_points.GetDtype());
+    target_normals.AssertDevice(source_points.GetDevice());
+
+    double reduction[28] = {0};
+    core::Device::DeviceType device_type = source_points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePosePointToPlaneCPU(
+                source_points.Contiguous(), target_points.Contiguous(),
+                target_normals.Contiguous(), source_indices.Contiguous(),
+                target_indices.Contiguous(), reduction);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    // The normal equations are solved in double precision on the host.
+    core::Device host("CPU:0");
+    core::Tensor JtJ = core::Tensor::Empty({6, 6}, core::Dtype::Float64, host);
+    core::Tensor Jtr = core::Tensor::Empty({6, 1}, core::Dtype::Float64, host);
+    double *JtJ_ptr = static_cast<double *>(JtJ.GetDataPtr());
+    double *Jtr_ptr = static_cast<double *>(Jtr.GetDataPtr());
+    int k = 0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = i; j < 6; ++j) {
+            JtJ_ptr[i * 6 + j] = JtJ_ptr[j * 6 + i] = reduction[k++];
+        }
+    }
+    for (int i = 0; i < 6; ++i) {
+        Jtr_ptr[i] = reduction[21 + i];
+    }
+    residual = reduction[27];
+
+    return JtJ.Solve(Jtr).Reshape({6}).To(source_points.GetDevice(),
+                                          source_points.GetDtype());
+}
+
+std::pair<core::Tensor, core::Tensor> ComputeRtPointToPoint(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &source_indices,
+        const core::Tensor &target_indices,
+        double &residual) {
+    AssertCorrespondences(source_points, target_points, source_indices,
+                          target_indices);
+
+    double origin[6] = {0};
+    double reduction[16] = {0};
+    core::Device::DeviceType device_type = source_points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeRtPointToPointCPU(
+                source_points.Contiguous(), target_points.Contiguous(),
+                source_indices.Contiguous(), target_indices.Contiguous(),
+                origin, reduction);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    // Sxy = sum((target - muy) * (source - mux)^T) / C, computed from the
+    // points relative to origin, as Sxy does not depend on the origin.
+    const double num_corres = static_cast<double>(source_indices.GetLength());
+    core::Device host("CPU:0");
+    core::Tensor mux = core::Tensor::Empty({3}, core::Dtype::Float64, host);
+    core::Tensor muy = core::Tensor::Empty({3}, core::Dtype::Float64, host);
+    core::Tensor Sxy = core::Tensor::Empty({3, 3}, core::Dtype::Float64, host);
+    double *mux_ptr = static_cast<double *>(mux.GetDataPtr());
+    double *muy_ptr = static_cast<double *>(muy.GetDataPtr());
+    double *Sxy_ptr = static_cast<double *>(Sxy.GetDataPtr());
+    double mux_rel[3], muy_rel[3];
+    for (int i = 0; i < 3; ++i) {
+        mux_rel[i] = reduction[i] / num_corres;
+        muy_rel[i] = reduction[3 + i] / num_corres;
+        mux_ptr[i] = origin[i] + mux_rel[i];
+        muy_ptr[i] = origin[3 + i] + muy_rel[i];
+    }
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            Sxy_ptr[i * 3 + j] = reduction[6 + i * 3 + j] / num_corres -
+                                 muy_rel[i] * mux_rel[j];
+        }
+    }
+    residual = reduction[15];
+
+    core::Tensor U, D, VT;
+    std::tie(U, D, VT) = Sxy.SVD();
+    U = U.Contiguous();
+    VT = VT.Contiguous();
+    core::Tensor S = core::Tensor::Eye(3, core::Dtype::Float64, host);
+    if (Det3x3(static_cast<const double *>(U.GetDataPtr())) *
+                Det3x3(static_cast<const double *>(VT.GetDataPtr())) <
+        0) {
+        S[-1][-1] = -1;
+    }
+    core::Tensor R = U.Matmul(S.Matmul(VT));
+    core::Tensor t = muy - R.Matmul(mux.Reshape({3, 1})).Reshape({3});
+
+    core::Device device = source_points.GetDevice();
+    core::Dtype dtype = source_points.GetDtype();
+    return std::make_pair(R.To(device, dtype), t.To(device, dtype));
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
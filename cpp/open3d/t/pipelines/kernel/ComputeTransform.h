@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <utility>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// \brief Computes the pose that minimizes the point to plane distances of
+/// the correspondences, by solving the 6x6 normal equations JtJ x = Jtr. JtJ,
+/// Jtr and the residual are accumulated in a single pass over the
+/// correspondences.
+///
+/// \param source_points Source points, a tensor of shape {N, 3}.
+/// \param target_points Target points, a tensor of shape {M, 3}, with the
+/// dtype of \p source_points.
+/// \param target_normals Target normals, a tensor of shape {M, 3}, with the
+/// dtype of \p source_points.
+/// \param source_indices Indices of the source points of the
+/// correspondences, a tensor of shape {C}, dtype Int64.
+/// \param target_indices Indices of the target points of the
+/// correspondences, a tensor of shape {C}, dtype Int64.
+/// \param residual Output, sum of the squared point to plane distances of
+/// the correspondences.
+/// \return Pose [alpha, beta, gamma, tx, ty, tz], a tensor of shape {6}, with
+/// the dtype of \p source_points.
+core::Tensor ComputePosePointToPlane(const core::Tensor &source_points,
+                                     const core::Tensor &target_points,
+                                     const core::Tensor &target_normals,
+                                     const core::Tensor &source_indices,
+                                     const core::Tensor &target_indices,
+                                     double &residual);
+
+/// \brief Computes the rotation and translation that minimize the point to
+/// point distances of the correspondences, in closed form
+/// (https://ieeexplore.ieee.org/document/88573). The means and the
+/// cross-covariance of the correspondences are accumulated in a single pass.
+///
+/// \param source_points Source points, a tensor of shape {N, 3}.
+/// \param target_points Target points, a tensor of shape {M, 3}, with the
+/// dtype of \p source_points.
+/// \param source_indices Indices of the source points of the
+/// correspondences, a tensor of shape {C}, dtype Int64.
+/// \param target_indices Indices of the target points of the
+/// correspondences, a tensor of shape {C}, dtype Int64.
+/// \param residual Output, sum of the squared point to point distances of
+/// the correspondences.
+/// \return Pair of rotation, a tensor of shape {3, 3}, and translation, a
+/// tensor of shape {3}, with the dtype of \p source_points.
+std::pair<core::Tensor, core::Tensor> ComputeRtPointToPoint(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &source_indices,
+        const core::Tensor &target_indices,
+        double &residual);
+
+/// Accumulates the upper triangle of JtJ (21 values, row by row), Jtr (6
+/// values) and the residual of point to plane correspondences into
+/// \p reduction, an array of 28 doubles.
+void ComputePosePointToPlaneCPU(const core::Tensor &source_points,
+                                const core::Tensor &target_points,
+                                const core::Tensor &target_normals,
+                                const core::Tensor &source_indices,
+                                const core::Tensor &target_indices,
+                                double *reduction);
+
+/// Accumulates the sums of the source points (3 values), of the target
+/// points (3 values), of target * source^T (9 values, row-major) and the
+/// residual of point to point correspondences into \p reduction, an array of
+/// 16 doubles. The points in the sums are relative to the source and target
+/// points of the first correspondence, written to \p origin, an array of 6
+/// doubles.
+void ComputeRtPointToPointCPU(const core::Tensor &source_points,
+                              const core::Tensor &target_points,
+                              const core::Tensor &source_indices,
+                              const core::Tensor &target_indices,
+                              double *origin,
+                              double *reduction);
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
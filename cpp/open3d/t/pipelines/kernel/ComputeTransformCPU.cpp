@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/ComputeTransform.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "open3d/core/CoreUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelFor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Number of correspondences summed by a task of ReduceCorrespondences().
+static constexpr int64_t kCorrespondenceBatchSize = 4096;
+
+/// Calls func(i, sums) for each correspondence i, which adds its terms to the
+/// N partial sums, and adds up the partial sums into \p reduction. Each batch
+/// of correspondences has its own partial sums, so that the result does not
+/// depend on the number of threads.
+template <int N, typename func_t>
+static void ReduceCorrespondences(int64_t num_corres,
+                                  double *reduction,
+                                  const func_t &func) {
+    const int64_t num_batches =
+            (num_corres + kCorrespondenceBatchSize - 1) /
+            kCorrespondenceBatchSize;
+    std::vector<std::array<double, N>> batch_sums(num_batches);
+    core::kernel::ParallelFor(num_batches, 1, [&](int64_t start, int64_t end) {
+        for (int64_t b = start; b < end; ++b) {
+            std::array<double, N> &sums = batch_sums[b];
+            sums.fill(0);
+            const int64_t batch_end = std::min(
+                    (b + 1) * kCorrespondenceBatchSize, num_corres);
+            for (int64_t i = b * kCorrespondenceBatchSize; i < batch_end;
+                 ++i) {
+                func(i, sums.data());
+            }
+        }
+    });
+    std::fill(reduction, reduction + N, 0.0);
+    for (const std::array<double, N> &sums : batch_sums) {
+        for (int k = 0; k < N; ++k) {
+            reduction[k] += sums[k];
+        }
+    }
+}
+
+void ComputePosePointToPlaneCPU(const core::Tensor &source_points,
+                                const core::Tensor &target_points,
+                                const core::Tensor &target_normals,
+                                const core::Tensor &source_indices,
+                                const core::Tensor &target_indices,
+                                double *reduction) {
+    const int64_t *source_indices_ptr =
+            static_cast<const int64_t *>(source_indices.GetDataPtr());
+    const int64_t *target_indices_ptr =
+            static_cast<const int64_t *>(target_indices.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(source_points.GetDtype(), [&]() {
+        const scalar_t *source_ptr =
+                static_cast<const scalar_t *>(source_points.GetDataPtr());
+        const scalar_t *target_ptr =
+                static_cast<const scalar_t *>(target_points.GetDataPtr());
+        const scalar_t *normals_ptr =
+                static_cast<const scalar_t *>(target_normals.GetDataPtr());
+
+        ReduceCorrespondences<28>(
+                source_indices.GetLength(), reduction,
+                [&](int64_t i, double *sums) {
+                    const scalar_t *s = source_ptr + 3 * source_indices_ptr[i];
+                    const scalar_t *t = target_ptr + 3 * target_indices_ptr[i];
+                    const scalar_t *n = normals_ptr + 3 * target_indices_ptr[i];
+                    // J = [s x n, n], r = (t - s) . n.
+                    const double J[6] = {
+                            double(s[1]) * n[2] - double(s[2]) * n[1],
+                            double(s[2]) * n[0] - double(s[0]) * n[2],
+                            double(s[0]) * n[1] - double(s[1]) * n[0],
+                            double(n[0]),
+                            double(n[1]),
+                            double(n[2])};
+                    const double r = (double(t[0]) - s[0]) * n[0] +
+                                     (double(t[1]) - s[1]) * n[1] +
+                                     (double(t[2]) - s[2]) * n[2];
+                    int k = 0;
+                    for (int a = 0; a < 6; ++a) {
+                        for (int b = a; b < 6; ++b) {
+                            sums[k++] += J[a] * J[b];
+                        }
+                    }
+                    for (int a = 0; a < 6; ++a) {
+                        sums[21 + a] += J[a] * r;
+                    }
+                    sums[27] += r * r;
+                });
+    });
+}
+
+void ComputeRtPointToPointCPU(const core::Tensor &source_points,
+                              const core::Tensor &target_points,
+                              const core::Tensor &source_indices,
+                              const core::Tensor &target_indices,
+                              double *origin,
+                              double *reduction) {
+    const int64_t *source_indices_ptr =
+            static_cast<const int64_t *>(source_indices.GetDataPtr());
+    const int64_t *target_indices_ptr =
+            static_cast<const int64_t *>(target_indices.GetDataPtr());
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(source_points.GetDtype(), [&]() {
+        const scalar_t *source_ptr =
+                static_cast<const scalar_t *>(source_points.GetDataPtr());
+        const scalar_t *target_ptr =
+                static_cast<const scalar_t *>(target_points.GetDataPtr());
+
+        // Points are taken relative to the first correspondence, so that the
+        // cross-covariance does not cancel far from the origin.
+        const scalar_t *s0 = source_ptr + 3 * source_indices_ptr[0];
+        const scalar_t *t0 = target_ptr + 3 * target_indices_ptr[0];
+        for (int a = 0; a < 3; ++a) {
+            origin[a] = s0[a];
+            origin[3 + a] = t0[a];
+        }
+
+        ReduceCorrespondences<16>(
+                source_indices.GetLength(), reduction,
+                [&](int64_t i, double *sums) {
+                    const scalar_t *s = source_ptr + 3 * source_indices_ptr[i];
+                    const scalar_t *t = target_ptr + 3 * target_indices_ptr[i];
+                    double sc[3], tc[3];
+                    for (int a = 0; a < 3; ++a) {
+                        sc[a] = double(s[a]) - origin[a];
+                        tc[a] = double(t[a]) - origin[3 + a];
+                    }
+                    for (int a = 0; a < 3; ++a) {
+                        sums[a] += sc[a];
+                        sums[3 + a] += tc[a];
+                        for (int b = 0; b < 3; ++b) {
+                            sums[6 + a * 3 + b] += tc[a] * sc[b];
+                        }
+                        const double d = double(t[a]) - s[a];
+                        sums[15] += d * d;
+                    }
+                });
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/Correspondence.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Reallocates \p buffer unless it already has the requested properties.
+static void PrepareBuffer(core::Tensor &buffer,
+                          int64_t length,
+                          core::Dtype dtype,
+                          const core::Device &device) {
+    if (buffer.NumDims() != 1 || buffer.GetLength() != length ||
+        buffer.GetDtype() != dtype || buffer.GetDevice() != device ||
+        !buffer.IsContiguous()) {
+        buffer = core::Tensor::Empty({length}, dtype, device);
+    }
+}
+
+void ComputeCorrespondences(const core::Tensor &source_points,
+                            const core::nns::FixedRadiusIndex &target_index,
+                            double max_correspondence_distance,
+                            core::Tensor &source_indices,
+                            core::Tensor &target_indices,
+                            core::Tensor &distances,
+                            int64_t &num_correspondences,
+                            double &squared_error) {
+    core::Device device = source_points.GetDevice();
+    core::Dtype dtype = source_points.GetDtype();
+    source_points.AssertShapeCompatible({utility::nullopt, 3});
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError("Unsupported dtype {} of source points.",
+                          dtype.ToString());
+    }
+    if (target_index.GetDevice() != device ||
+        target_index.GetDtype() != dtype) {
+        utility::LogError(
+                "Target index ({}, {}) does not match the source points ({}, "
+                "{}).",
+                target_index.GetDevice().ToString(),
+                target_index.GetDtype().ToString(), device.ToString(),
+                dtype.ToString());
+    }
+    if (max_correspondence_distance <= 0 ||
+        max_correspondence_distance > target_index.GetRadius()) {
+        utility::LogError(
+                "max_correspondence_distance {} must be positive and no "
+                "larger than the radius {} of the target index.",
+                max_correspondence_distance, target_index.GetRadius());
+    }
+
+    const int64_t num_points = source_points.GetLength();
+    PrepareBuffer(source_indices, num_points, core::Dtype::Int64, device);
+    PrepareBuffer(target_indices, num_points, core::Dtype::Int64, device);
+    PrepareBuffer(distances, num_points, dtype, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeCorrespondencesCPU(source_points.Contiguous(), target_index,
+                                  max_correspondence_distance, source_indices,
+                                  target_indices, distances,
+                                  num_correspondences, squared_error);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
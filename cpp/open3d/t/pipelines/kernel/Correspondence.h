@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// \brief Finds for each source point its nearest target point within
+/// \p max_correspondence_distance, and accumulates the squared distances of
+/// the correspondences found, in a single pass over the source points.
+///
+/// The correspondences are written, ordered by source index, to the first
+/// \p num_correspondences entries of the output buffers. The buffers are
+/// reallocated only if they do not match the number of source points, so
+/// that they can be reused across ICP iterations.
+///
+/// \param source_points Source points, a tensor of shape {N, 3}, dtype
+/// Float32 or Float64.
+/// \param target_index Fixed radius index of the target points, built with a
+/// radius no smaller than \p max_correspondence_distance.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param source_indices Buffer of shape {N}, dtype Int64, for the indices of
+/// the source points.
+/// \param target_indices Buffer of shape {N}, dtype Int64, for the indices of
+/// the corresponding target points.
+/// \param distances Buffer of shape {N}, with the dtype of the points, for the
+/// squared distances of the correspondences.
+/// \param num_correspondences Output, number of correspondences found.
+/// \param squared_error Output, sum of the squared distances of the
+/// correspondences.
+void ComputeCorrespondences(const core::Tensor &source_points,
+                            const core::nns::FixedRadiusIndex &target_index,
+                            double max_correspondence_distance,
+                            core::Tensor &source_indices,
+                            core::Tensor &target_indices,
+                            core::Tensor &distances,
+                            int64_t &num_correspondences,
+                            double &squared_error);
+
+void ComputeCorrespondencesCPU(const core::Tensor &source_points,
+                               const core::nns::FixedRadiusIndex &target_index,
+                               double max_correspondence_distance,
+                               core::Tensor &source_indices,
+                               core::Tensor &target_indices,
+                               core::Tensor &distances,
+                               int64_t &num_correspondences,
+                               double &squared_error);
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
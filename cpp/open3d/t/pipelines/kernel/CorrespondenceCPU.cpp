@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/Correspondence.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "open3d/core/CoreUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelFor.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Number of source points processed by a task of
+/// ComputeCorrespondencesCPU().
+static constexpr int64_t kSourceBatchSize = 1024;
+
+/// Returns the index of the nearest target point within the buckets touched by
+/// the ball of radius \p r around \p pos, or -1 if the buckets are empty. Ties
+/// are broken by the smaller index.
+template <typename scalar_t>
+static int64_t FindNearestTarget(const utility::MiniVec<scalar_t, 3> &pos,
+                                 scalar_t r,
+                                 scalar_t inv_voxel_size,
+                                 int64_t hash_table_size,
+                                 const int64_t *splits_ptr,
+                                 const int64_t *index_ptr,
+                                 const scalar_t *target_ptr,
+                                 scalar_t &nearest_distance) {
+    const utility::MiniVec<int, 3> voxel_min =
+            core::nns::ComputeVoxelIndex(pos - r, inv_voxel_size);
+    const utility::MiniVec<int, 3> voxel_max =
+            core::nns::ComputeVoxelIndex(pos + r, inv_voxel_size);
+    int64_t buckets[27];
+    int num_buckets = 0;
+    for (int z = voxel_min[2]; z <= voxel_max[2]; ++z) {
+        for (int y = voxel_min[1]; y <= voxel_max[1]; ++y) {
+            for (int x = voxel_min[0]; x <= voxel_max[0]; ++x) {
+                const int64_t bucket = static_cast<int64_t>(
+                        core::nns::SpatialHash(x, y, z) % hash_table_size);
+                if (std::find(buckets, buckets + num_buckets, bucket) ==
+                    buckets + num_buckets) {
+                    buckets[num_buckets++] = bucket;
+                }
+            }
+        }
+    }
+
+    int64_t nearest_index = -1;
+    nearest_distance = std::numeric_limits<scalar_t>::max();
+    for (int k = 0; k < num_buckets; ++k) {
+        for (int64_t j = splits_ptr[buckets[k]]; j < splits_ptr[buckets[k] + 1];
+             ++j) {
+            const scalar_t *p = target_ptr + 3 * j;
+            const scalar_t dx = p[0] - pos[0];
+            const scalar_t dy = p[1] - pos[1];
+            const scalar_t dz = p[2] - pos[2];
+            const scalar_t distance = dx * dx + dy * dy + dz * dz;
+            if (distance < nearest_distance ||
+                (distance == nearest_distance &&
+                 index_ptr[j] < nearest_index)) {
+                nearest_distance = distance;
+                nearest_index = index_ptr[j];
+            }
+        }
+    }
+    return nearest_index;
+}
+
+void ComputeCorrespondencesCPU(const core::Tensor &source_points,
+                               const core::nns::FixedRadiusIndex &target_index,
+                               double max_correspondence_distance,
+                               core::Tensor &source_indices,
+                               core::Tensor &target_indices,
+                               core::Tensor &distances,
+                               int64_t &num_correspondences,
+                               double &squared_error) {
+    const int64_t num_points = source_points.GetLength();
+    const int64_t num_batches =
+            (num_points + kSourceBatchSize - 1) / kSourceBatchSize;
+    const core::Tensor &cell_splits = target_index.GetHashTableCellSplits();
+    const int64_t hash_table_size = cell_splits.GetLength() - 1;
+    const int64_t *splits_ptr =
+            static_cast<const int64_t *>(cell_splits.GetDataPtr());
+    const int64_t *index_ptr = static_cast<const int64_t *>(
+            target_index.GetHashTableIndex().GetDataPtr());
+    int64_t *source_indices_ptr =
+            static_cast<int64_t *>(source_indices.GetDataPtr());
+    int64_t *target_indices_ptr =
+            static_cast<int64_t *>(target_indices.GetDataPtr());
+
+    // Number of correspondences and sum of squared distances of each batch.
+    std::vector<int64_t> batch_counts(num_batches);
+    std::vector<double> batch_errors(num_batches);
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(source_points.GetDtype(), [&]() {
+        using Vec3_t = utility::MiniVec<scalar_t, 3>;
+        const scalar_t *source_ptr =
+                static_cast<const scalar_t *>(source_points.GetDataPtr());
+        const scalar_t *target_ptr = static_cast<const scalar_t *>(
+                target_index.GetSortedPoints().GetDataPtr());
+        scalar_t *distances_ptr =
+                static_cast<scalar_t *>(distances.GetDataPtr());
+        const scalar_t r = static_cast<scalar_t>(max_correspondence_distance);
+        const scalar_t threshold = r * r;
+        const scalar_t inv_voxel_size =
+                static_cast<scalar_t>(0.5 / target_index.GetRadius());
+
+        // Each batch compacts its correspondences to the front of its own
+        // range of the output buffers.
+        core::kernel::ParallelFor(
+                num_batches, 1, [&](int64_t start, int64_t end) {
+                    for (int64_t b = start; b < end; ++b) {
+                        const int64_t begin = b * kSourceBatchSize;
+                        const int64_t batch_end = std::min(
+                                begin + kSourceBatchSize, num_points);
+                        int64_t count = 0;
+                        double error = 0;
+                        for (int64_t i = begin; i < batch_end; ++i) {
+                            scalar_t distance;
+                            const int64_t nearest = FindNearestTarget(
+                                    Vec3_t(source_ptr + 3 * i), r,
+                                    inv_voxel_size, hash_table_size,
+                                    splits_ptr, index_ptr, target_ptr,
+                                    distance);
+                            if (nearest >= 0 && distance < threshold) {
+                                source_indices_ptr[begin + count] = i;
+                                target_indices_ptr[begin + count] = nearest;
+                                distances_ptr[begin + count] = distance;
+                                error += distance;
+                                ++count;
+                            }
+                        }
+                        batch_counts[b] = count;
+                        batch_errors[b] = error;
+                    }
+                });
+
+        // Moves the batches together. Each batch moves towards the front,
+        // over batches that have already been moved, so this runs in order.
+        int64_t offset = 0;
+        for (int64_t b = 0; b < num_batches; ++b) {
+            const int64_t begin = b * kSourceBatchSize;
+            const int64_t count = batch_counts[b];
+            if (offset != begin && count > 0) {
+                std::memmove(source_indices_ptr + offset,
+                             source_indices_ptr + begin,
+                             count * sizeof(int64_t));
+                std::memmove(target_indices_ptr + offset,
+                             target_indices_ptr + begin,
+                             count * sizeof(int64_t));
+                std::memmove(distances_ptr + offset, distances_ptr + begin,
+                             count * sizeof(scalar_t));
+            }
+            offset += count;
+        }
+    });
+
+    num_correspondences = 0;
+    squared_error = 0;
+    for (int64_t b = 0; b < num_batches; ++b) {
+        num_correspondences += batch_counts[b];
+        squared_error += batch_errors[b];
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void ComputeFPFHFeature(const core::Tensor &points,
+                        const core::Tensor &normals,
+                        const core::Tensor &neighbor_indices,
+                        const core::Tensor &neighbor_row_splits,
+                        const core::Tensor &neighbor_distances,
+                        core::Tensor &fpfhs) {
+    core::Device device = points.GetDevice();
+    core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError("Unsupported dtype {} of points.", dtype.ToString());
+    }
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    const int64_t num_points = points.GetLength();
+    normals.AssertShape(points.GetShape());
+    normals.AssertDtype(dtype);
+    normals.AssertDevice(device);
+    neighbor_indices.AssertShapeCompatible({utility::nullopt});
+    neighbor_indices.AssertDtype(core::Dtype::Int64);
+    neighbor_indices.AssertDevice(device);
+    neighbor_row_splits.AssertShape({num_points + 1});
+    neighbor_row_splits.AssertDtype(core::Dtype::Int64);
+    neighbor_row_splits.AssertDevice(device);
+    neighbor_distances.AssertShape(neighbor_indices.GetShape());
+    neighbor_distances.AssertDtype(dtype);
+    neighbor_distances.AssertDevice(device);
+
+    fpfhs = core::Tensor::Empty({num_points, 33}, core::Dtype::Float32,
+                                device);
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeFPFHFeatureCPU(points.Contiguous(), normals.Contiguous(),
+                              neighbor_indices.Contiguous(),
+                              neighbor_row_splits.Contiguous(),
+                              neighbor_distances.Contiguous(), fpfhs);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
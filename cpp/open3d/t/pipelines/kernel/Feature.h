@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// \brief Computes the Fast Point Feature Histograms (FPFH) of points from
+/// their precomputed neighbors.
+///
+/// The neighbors are given in compressed row format: the neighbors of point i
+/// are neighbor_indices[neighbor_row_splits[i]:neighbor_row_splits[i + 1]].
+/// They are searched once and used both for the simplified point feature
+/// histograms (SPFH) of the points and for weighting the SPFH of the
+/// neighbors. A point may be listed among its own neighbors, it is skipped.
+///
+/// \param points Points, a tensor of shape {N, 3}, dtype Float32 or Float64.
+/// \param normals Normals, a tensor of shape {N, 3}, with the dtype of
+/// \p points.
+/// \param neighbor_indices Indices of the neighbors, a tensor of shape {M},
+/// dtype Int64.
+/// \param neighbor_row_splits Row splits of the neighbors, a tensor of shape
+/// {N + 1}, dtype Int64.
+/// \param neighbor_distances Squared distances of the neighbors, a tensor of
+/// shape {M}, with the dtype of \p points.
+/// \param fpfhs Output, a tensor of shape {N, 33}, dtype Float32. Row i holds
+/// the three 11-bin histograms of point i.
+void ComputeFPFHFeature(const core::Tensor &points,
+                        const core::Tensor &normals,
+                        const core::Tensor &neighbor_indices,
+                        const core::Tensor &neighbor_row_splits,
+                        const core::Tensor &neighbor_distances,
+                        core::Tensor &fpfhs);
+
+void ComputeFPFHFeatureCPU(const core::Tensor &points,
+                           const core::Tensor &normals,
+                           const core::Tensor &neighbor_indices,
+                           const core::Tensor &neighbor_row_splits,
+                           const core::Tensor &neighbor_distances,
+                           core::Tensor &fpfhs);
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
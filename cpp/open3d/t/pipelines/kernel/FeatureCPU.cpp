@@ -0,0 +1,272 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/core/CoreUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPUVectorization.h"
+#include "open3d/core/kernel/ParallelFor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Number of bins of the histogram of each of the three pair features.
+static constexpr int kNumBins = 11;
+/// Dimension of the FPFH features.
+static constexpr int kFeatureDim = 3 * kNumBins;
+/// Minimum number of points processed by a task.
+static constexpr int64_t kPointGrainSize = 256;
+/// Number of neighbors whose pair features are computed by one vectorized
+/// loop.
+static constexpr int kNeighborBatchSize = 64;
+
+/// Branch-free approximation of std::atan2, with an error below 1e-5 rad,
+/// which can be vectorized.
+static inline float Atan2Approx(float y, float x) {
+    const float ax = std::abs(x);
+    const float ay = std::abs(y);
+    const float max_xy = std::max(ax, ay);
+    const float a = max_xy > 0.0f ? std::min(ax, ay) / max_xy : 0.0f;
+    const float s = a * a;
+    float r = ((-0.0464964749f * s + 0.15931422f) * s - 0.327622764f) * s * a +
+              a;
+    r = ay > ax ? 1.57079637f - r : r;
+    r = x < 0.0f ? 3.14159274f - r : r;
+    return y < 0.0f ? -r : r;
+}
+
+/// Returns the histogram bin of \p value, which is in [min_value, min_value +
+/// kNumBins / scale].
+static inline int ToBin(float value, float min_value, float scale) {
+    const int bin = static_cast<int>(std::floor((value - min_value) * scale));
+    return std::min(std::max(bin, 0), kNumBins - 1);
+}
+
+/// Computes the histogram bins of the three pair features of point \p p1
+/// with normal \p n1 and each of \p num neighbors, whose points and normals
+/// are given by coordinate in \p neighbors: x, y, z of the points, then x, y,
+/// z of the normals. The features are those of the legacy FPFH: the angle
+/// f0 in [-pi, pi] and the cosines f1 and f2 in [-1, 1]. They are all 0 for
+/// degenerate pairs.
+static inline void ComputePairFeatureBins(
+        const float p1[3],
+        const float n1[3],
+        int num,
+        const float neighbors[6][kNeighborBatchSize],
+        int bins[3][kNeighborBatchSize]) {
+    const float kPi = 3.14159265f;
+    OPEN3D_SIMD_LOOP
+    for (int t = 0; t < num; ++t) {
+        const float n2x = neighbors[3][t], n2y = neighbors[4][t],
+                    n2z = neighbors[5][t];
+        float dx = neighbors[0][t] - p1[0];
+        float dy = neighbors[1][t] - p1[1];
+        float dz = neighbors[2][t] - p1[2];
+        const float d = std::sqrt(dx * dx + dy * dy + dz * dz);
+        const float inv_d = d > 0.0f ? 1.0f / d : 0.0f;
+        const float angle1 = (n1[0] * dx + n1[1] * dy + n1[2] * dz) * inv_d;
+        const float angle2 = (n2x * dx + n2y * dy + n2z * dz) * inv_d;
+
+        // The source of the pair is the point whose normal makes the smaller
+        // angle with the line joining the points.
+        const bool swap = std::abs(angle1) < std::abs(angle2);
+        const float ux = swap ? n2x : n1[0], uy = swap ? n2y : n1[1],
+                    uz = swap ? n2z : n1[2];
+        const float mx = swap ? n1[0] : n2x, my = swap ? n1[1] : n2y,
+                    mz = swap ? n1[2] : n2z;
+        const float sign = swap ? -1.0f : 1.0f;
+        dx *= sign;
+        dy *= sign;
+        dz *= sign;
+        const float f2 = swap ? -angle2 : angle1;
+
+        // Darboux frame (u, v, w).
+        float vx = dy * uz - dz * uy;
+        float vy = dz * ux - dx * uz;
+        float vz = dx * uy - dy * ux;
+        const float v_norm = std::sqrt(vx * vx + vy * vy + vz * vz);
+        const float inv_v_norm = v_norm > 0.0f ? 1.0f / v_norm : 0.0f;
+        vx *= inv_v_norm;
+        vy *= inv_v_norm;
+        vz *= inv_v_norm;
+        const float wx = uy * vz - uz * vy;
+        const float wy = uz * vx - ux * vz;
+        const float wz = ux * vy - uy * vx;
+        const float f1 = vx * mx + vy * my + vz * mz;
+        const float f0 = Atan2Approx(wx * mx + wy * my + wz * mz,
+                                     ux * mx + uy * my + uz * mz);
+
+        const bool valid = d > 0.0f && v_norm > 0.0f;
+        bins[0][t] = ToBin(valid ? f0 : 0.0f, -kPi, kNumBins / (2.0f * kPi));
+        bins[1][t] = ToBin(valid ? f1 : 0.0f, -1.0f, kNumBins * 0.5f);
+        bins[2][t] = ToBin(valid ? f2 : 0.0f, -1.0f, kNumBins * 0.5f);
+    }
+}
+
+/// Computes the simplified point feature histogram (SPFH) of each point into
+/// \p spfhs, kFeatureDim floats per point.
+template <typename scalar_t>
+static void ComputeSPFHFeatures(const scalar_t *points,
+                                const scalar_t *normals,
+                                int64_t num_points,
+                                const int64_t *neighbor_indices,
+                                const int64_t *neighbor_row_splits,
+                                float *spfhs) {
+    core::kernel::ParallelFor(
+            num_points, kPointGrainSize, [&](int64_t start, int64_t end) {
+                core::kernel::LaunchVectorized([&]() {
+                    float neighbors[6][kNeighborBatchSize];
+                    int bins[3][kNeighborBatchSize];
+                    for (int64_t i = start; i < end; ++i) {
+                        float *spfh = spfhs + i * kFeatureDim;
+                        std::fill(spfh, spfh + kFeatureDim, 0.0f);
+                        const int64_t begin = neighbor_row_splits[i];
+                        const int64_t stop = neighbor_row_splits[i + 1];
+                        int64_t num_neighbors = 0;
+                        for (int64_t k = begin; k < stop; ++k) {
+                            num_neighbors += neighbor_indices[k] != i;
+                        }
+                        if (num_neighbors == 0) {
+                            continue;
+                        }
+                        const float hist_incr = 100.0f / num_neighbors;
+                        const float p1[3] = {
+                                static_cast<float>(points[3 * i]),
+                                static_cast<float>(points[3 * i + 1]),
+                                static_cast<float>(points[3 * i + 2])};
+                        const float n1[3] = {
+                                static_cast<float>(normals[3 * i]),
+                                static_cast<float>(normals[3 * i + 1]),
+                                static_cast<float>(normals[3 * i + 2])};
+                        for (int64_t k = begin; k < stop;) {
+                            int num = 0;
+                            for (; k < stop && num < kNeighborBatchSize; ++k) {
+                                const int64_t j = neighbor_indices[k];
+                                if (j == i) continue;
+                                for (int c = 0; c < 3; ++c) {
+                                    neighbors[c][num] = static_cast<float>(
+                                            points[3 * j + c]);
+                                    neighbors[3 + c][num] = static_cast<float>(
+                                            normals[3 * j + c]);
+                                }
+                                ++num;
+                            }
+                            ComputePairFeatureBins(p1, n1, num, neighbors,
+                                                   bins);
+                            for (int t = 0; t < num; ++t) {
+                                spfh[bins[0][t]] += hist_incr;
+                                spfh[kNumBins + bins[1][t]] += hist_incr;
+                                spfh[2 * kNumBins + bins[2][t]] += hist_incr;
+                            }
+                        }
+                    }
+                });
+            });
+}
+
+/// Computes the FPFH of each point from the SPFH of its neighbors, weighted
+/// by the inverse of their squared distances, as the legacy FPFH.
+template <typename scalar_t>
+static void ComputeFPFHFeatures(int64_t num_points,
+                                const int64_t *neighbor_indices,
+                                const int64_t *neighbor_row_splits,
+                                const scalar_t *neighbor_distances,
+                                const float *spfhs,
+                                float *fpfhs) {
+    core::kernel::ParallelFor(
+            num_points, kPointGrainSize, [&](int64_t start, int64_t end) {
+                core::kernel::LaunchVectorized([&]() {
+                    for (int64_t i = start; i < end; ++i) {
+                        float *fpfh = fpfhs + i * kFeatureDim;
+                        std::fill(fpfh, fpfh + kFeatureDim, 0.0f);
+                        for (int64_t k = neighbor_row_splits[i];
+                             k < neighbor_row_splits[i + 1]; ++k) {
+                            const int64_t j = neighbor_indices[k];
+                            const float dist =
+                                    static_cast<float>(neighbor_distances[k]);
+                            if (j == i || dist == 0.0f) continue;
+                            const float weight = 1.0f / dist;
+                            const float *spfh = spfhs + j * kFeatureDim;
+                            OPEN3D_SIMD_LOOP
+                            for (int b = 0; b < kFeatureDim; ++b) {
+                                fpfh[b] += spfh[b] * weight;
+                            }
+                        }
+                        const float *spfh = spfhs + i * kFeatureDim;
+                        for (int h = 0; h < 3; ++h) {
+                            float *hist = fpfh + h * kNumBins;
+                            float sum = 0.0f;
+                            for (int b = 0; b < kNumBins; ++b) {
+                                sum += hist[b];
+                            }
+                            const float scale = sum != 0.0f ? 100.0f / sum : 0;
+                            for (int b = 0; b < kNumBins; ++b) {
+                                hist[b] = hist[b] * scale +
+                                          spfh[h * kNumBins + b];
+                            }
+                        }
+                    }
+                });
+            });
+}
+
+void ComputeFPFHFeatureCPU(const core::Tensor &points,
+                           const core::Tensor &normals,
+                           const core::Tensor &neighbor_indices,
+                           const core::Tensor &neighbor_row_splits,
+                           const core::Tensor &neighbor_distances,
+                           core::Tensor &fpfhs) {
+    const int64_t num_points = points.GetLength();
+    core::Tensor spfhs =
+            core::Tensor::Empty({num_points, kFeatureDim},
+                                core::Dtype::Float32, points.GetDevice());
+    const int64_t *indices_ptr =
+            static_cast<const int64_t *>(neighbor_indices.GetDataPtr());
+    const int64_t *row_splits_ptr =
+            static_cast<const int64_t *>(neighbor_row_splits.GetDataPtr());
+    float *spfhs_ptr = static_cast<float *>(spfhs.GetDataPtr());
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(points.GetDtype(), [&]() {
+        ComputeSPFHFeatures(
+                static_cast<const scalar_t *>(points.GetDataPtr()),
+                static_cast<const scalar_t *>(normals.GetDataPtr()),
+                num_points, indices_ptr, row_splits_ptr, spfhs_ptr);
+        ComputeFPFHFeatures(
+                num_points, indices_ptr, row_splits_ptr,
+                static_cast<const scalar_t *>(neighbor_distances.GetDataPtr()),
+                spfhs_ptr, static_cast<float *>(fpfhs.GetDataPtr()));
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
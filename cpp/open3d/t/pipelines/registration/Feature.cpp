@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+core::Tensor ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const utility::optional<int> max_nn /* = 100 */,
+        const utility::optional<double> radius /* = utility::nullopt */) {
+    if (!input.HasPointNormals()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    if (!max_nn.has_value() && !radius.has_value()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] At least one of max_nn and radius must "
+                "be given.");
+    }
+    const core::Tensor &points = input.GetPoints();
+    const int64_t num_points = points.GetLength();
+    core::nns::NearestNeighborSearch tree(points);
+
+    // Neighbors in compressed row format.
+    core::Tensor indices, distances, row_splits;
+    if (radius.has_value() && !max_nn.has_value()) {
+        core::Tensor num_neighbors;
+        tree.FixedRadiusIndex(radius.value());
+        std::tie(indices, distances, num_neighbors) =
+                tree.FixedRadiusSearch(points, radius.value());
+        row_splits = core::Tensor::Concatenate(
+                {core::Tensor::Zeros({1}, core::Dtype::Int64,
+                                     points.GetDevice()),
+                 num_neighbors.CumSum(0)});
+    } else {
+        if (radius.has_value()) {
+            // As in registration, HybridSearch compares squared distances
+            // with the radius.
+            tree.HybridIndex();
+            std::tie(indices, distances) = tree.HybridSearch(
+                    points, radius.value() * radius.value(), max_nn.value());
+        } else {
+            tree.KnnIndex();
+            std::tie(indices, distances) =
+                    tree.KnnSearch(points, max_nn.value());
+        }
+        // Rows of {N, max_nn} neighbors are padded with -1.
+        core::Tensor valid = indices.Ne(-1);
+        row_splits = core::Tensor::Concatenate(
+                {core::Tensor::Zeros({1}, core::Dtype::Int64,
+                                     points.GetDevice()),
+                 valid.To(core::Dtype::Int64).Sum({1}).CumSum(0)});
+        indices = indices.IndexGet({valid});
+        distances = distances.IndexGet({valid});
+    }
+    utility::LogDebug("[ComputeFPFHFeature] {:d} points, {:d} neighbors.",
+                      num_points, indices.GetLength());
+
+    core::Tensor fpfhs;
+    kernel::ComputeFPFHFeature(points, input.GetPointNormals(), indices,
+                               row_splits, distances, fpfhs);
+    return fpfhs;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
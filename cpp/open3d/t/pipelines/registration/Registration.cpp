@@ -26,138 +26,208 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <vector>
+
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/Correspondence.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace t {
 namespace pipelines {
 namespace registration {
 
-static RegistrationResult GetRegistrationResultAndCorrespondences(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        open3d::core::nns::NearestNeighborSearch &target_nns,
-        double max_correspondence_distance,
-        const core::Tensor &transformation) {
-    core::Device device = source.GetDevice();
-    core::Dtype dtype = core::Dtype::Float32;
-    source.GetPoints().AssertDtype(dtype);
-    target.GetPoints().AssertDtype(dtype);
-    if (target.GetDevice() != device) {
-        utility::LogError(
-                "Target Pointcloud device {} != Source Pointcloud's device {}.",
-                target.GetDevice().ToString(), device.ToString());
+/// FixedRadiusIndex buckets the target points in voxels of size 2 * radius,
+/// and each query scans the voxels around it. When the voxels are large
+/// relative to the extent of the target, every query scans a large part of
+/// the target, and the KDTree of the hybrid search is faster.
+static bool IsFixedRadiusIndexEfficient(const core::Tensor &points,
+                                        double radius) {
+    constexpr double kMaxPointsPerVoxel = 64.0;
+    const int64_t num_points = points.GetLength();
+    if (num_points == 0) {
+        return true;
     }
-    transformation.AssertShape({4, 4});
-    transformation.AssertDtype(dtype);
-    core::Tensor transformation_device = transformation.To(device);
-
-    RegistrationResult result(transformation_device);
-    if (max_correspondence_distance <= 0.0) {
-        return result;
+    const std::vector<double> extent =
+            (points.Max({0}) - points.Min({0}))
+                    .To(core::Dtype::Float64)
+                    .ToFlatVector<double>();
+    double num_voxels = 1.0;
+    for (double length : extent) {
+        num_voxels *= std::max(1.0, std::ceil(length / (2.0 * radius)));
     }
+    return static_cast<double>(num_points) / num_voxels <= kMaxPointsPerVoxel;
+}
 
-    bool check = target_nns.HybridIndex();
-    if (!check) {
-        utility::LogError(
-                "[Tensor: EvaluateRegistration: "
-                "GetRegistrationResultAndCorrespondences: "
-                "NearestNeighborSearch::HybridSearch] "
-                "Index is not set.");
-    }
-    // max_correspondece_dist in HybridSearch tensor implementation
-    // is square root of that used in legacy implementation.
-    max_correspondence_distance =
-            max_correspondence_distance * max_correspondence_distance;
-
-    std::pair<core::Tensor, core::Tensor> result_nns = target_nns.HybridSearch(
-            source.GetPoints(), max_correspondence_distance, 1);
-
-    result.correspondence_select_bool_ =
-            (result_nns.first.Ne(-1)).Reshape({-1});
-    result.correspondence_set_ =
-            result_nns.first.IndexGet({result.correspondence_select_bool_})
-                    .Reshape({-1});
-    core::Tensor dist_select =
-            result_nns.second.IndexGet({result.correspondence_select_bool_})
-                    .Reshape({-1});
-
-    // Reduction sum of "distances" for error.
-    double squared_error =
-            static_cast<double>(dist_select.Sum({0}).Item<float>());
-    result.fitness_ =
-            static_cast<double>(result.correspondence_set_.GetShape()[0]) /
-            static_cast<double>(
-                    result.correspondence_select_bool_.GetShape()[0]);
-    result.inlier_rmse_ = std::sqrt(
-            squared_error /
-            static_cast<double>(result.correspondence_set_.GetShape()[0]));
-    result.transformation_ = transformation;
-    return result;
+RegistrationTarget::RegistrationTarget(const geometry::PointCloud &target,
+                                       double max_correspondence_distance)
+    : target_(target),
+      max_correspondence_distance_(max_correspondence_distance) {
+    target.GetPoints().AssertDtype(core::Dtype::Float32);
+    if (max_correspondence_distance_ <= 0.0) {
+        return;
+    }
+    if (target.GetDevice().GetType() == core::Device::DeviceType::CPU &&
+        IsFixedRadiusIndexEfficient(target.GetPoints(),
+                                    max_correspondence_distance_)) {
+        fixed_radius_index_.reset(new core::nns::FixedRadiusIndex(
+                target.GetPoints(), max_correspondence_distance_));
+    } else {
+        nns_.reset(new core::nns::NearestNeighborSearch(target.GetPoints()));
+        if (!nns_->HybridIndex()) {
+            utility::LogError(
+                    "[Tensor: RegistrationTarget: "
+                    "NearestNeighborSearch::HybridIndex] "
+                    "Index is not set.");
+        }
+    }
 }
 
-RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
-                                        const geometry::PointCloud &target,
-                                        double max_correspondence_distance,
-                                        const core::Tensor &transformation) {
-    core::Device device = source.GetDevice();
-    core::Dtype dtype = core::Dtype::Float32;
-    source.GetPoints().AssertDtype(dtype);
-    target.GetPoints().AssertDtype(dtype);
-    if (target.GetDevice() != device) {
-        utility::LogError(
-                "Target Pointcloud device {} != Source Pointcloud's device {}.",
-                target.GetDevice().ToString(), device.ToString());
+RegistrationTarget::~RegistrationTarget() {}
+
+namespace {
+
+/// Finds the correspondences of source point clouds in the target of a
+/// RegistrationTarget, whose index is shared. On the CPU, the correspondences
+/// are found by the fused kernel::ComputeCorrespondences() into buffers that
+/// are owned by the finder and reused across calls, so that ICP iterations
+/// after the first one do not allocate.
+class CorrespondenceFinder {
+public:
+    CorrespondenceFinder(const RegistrationTarget &target,
+                         double max_correspondence_distance)
+        : target_(target),
+          max_correspondence_distance_(max_correspondence_distance) {
+        if (max_correspondence_distance_ >
+            target_.GetMaxCorrespondenceDistance()) {
+            utility::LogError(
+                    "max_correspondence_distance {} is larger than the "
+                    "max_correspondence_distance {} of the RegistrationTarget.",
+                    max_correspondence_distance_,
+                    target_.GetMaxCorrespondenceDistance());
+        }
     }
-    transformation.AssertShape({4, 4});
-    transformation.AssertDtype(dtype);
-    core::Tensor transformation_device = transformation.To(device);
 
-    open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+    /// Returns the correspondences of \p source, which is already transformed
+    /// by \p transformation, with their fitness and inlier RMSE.
+    RegistrationResult Find(const geometry::PointCloud &source,
+                            const core::Tensor &transformation) {
+        RegistrationResult result(transformation);
+        if (max_correspondence_distance_ <= 0.0) {
+            return result;
+        }
 
-    geometry::PointCloud source_transformed = source.Clone();
-    source_transformed.Transform(transformation_device);
-    return GetRegistrationResultAndCorrespondences(
-            source_transformed, target, target_nns, max_correspondence_distance,
-            transformation_device);
+        int64_t num_correspondences = 0;
+        double squared_error = 0.0;
+        if (target_.GetFixedRadiusIndex() != nullptr) {
+            kernel::ComputeCorrespondences(
+                    source.GetPoints(), *target_.GetFixedRadiusIndex(),
+                    max_correspondence_distance_, source_indices_,
+                    target_indices_, distances_, num_correspondences,
+                    squared_error);
+            result.correspondence_source_indices_ =
+                    source_indices_.Slice(0, 0, num_correspondences);
+            result.correspondence_set_ =
+                    target_indices_.Slice(0, 0, num_correspondences);
+        } else {
+            // max_correspondece_dist in HybridSearch tensor implementation
+            // is square root of that used in legacy implementation.
+            const double max_distance_squared = max_correspondence_distance_ *
+                                                max_correspondence_distance_;
+            std::pair<core::Tensor, core::Tensor> result_nns =
+                    target_.GetNearestNeighborSearch()->HybridSearch(
+                            source.GetPoints(), max_distance_squared, 1);
+            core::Tensor select_bool = result_nns.first.Ne(-1).Reshape({-1});
+            result.correspondence_source_indices_ =
+                    select_bool.NonZero().Reshape({-1});
+            result.correspondence_set_ =
+                    result_nns.first.IndexGet({select_bool}).Reshape({-1});
+            num_correspondences = result.correspondence_set_.GetLength();
+            squared_error = static_cast<double>(
+                    result_nns.second.IndexGet({select_bool})
+                            .Sum({0})
+                            .Item<float>());
+        }
+
+        if (num_correspondences > 0) {
+            result.fitness_ =
+                    static_cast<double>(num_correspondences) /
+                    static_cast<double>(source.GetPoints().GetLength());
+            result.inlier_rmse_ = std::sqrt(
+                    squared_error / static_cast<double>(num_correspondences));
+        }
+        return result;
+    }
+
+private:
+    const RegistrationTarget &target_;
+    double max_correspondence_distance_;
+    /// Reusable output buffers of kernel::ComputeCorrespondences().
+    core::Tensor source_indices_;
+    core::Tensor target_indices_;
+    core::Tensor distances_;
+};
+
+/// Fills the deprecated correspondence_select_bool_ of a \p result returned
+/// to the caller, for a source of \p num_source_points points.
+RegistrationResult FillCorrespondenceSelectBool(RegistrationResult result,
+                                                int64_t num_source_points) {
+    const core::Tensor &source_indices = result.correspondence_source_indices_;
+    core::Device device = result.transformation_.GetDevice();
+    // IndexSet does not dispatch Bool.
+    core::Tensor select = core::Tensor::Zeros({num_source_points},
+                                              core::Dtype::UInt8, device);
+    if (source_indices.NumElements() > 0) {
+        select.IndexSet({source_indices},
+                        core::Tensor::Ones({source_indices.GetLength()},
+                                           core::Dtype::UInt8, device));
+    }
+    result.correspondence_select_bool_ = select.To(core::Dtype::Bool);
+    return result;
 }
 
-RegistrationResult RegistrationICP(const geometry::PointCloud &source,
-                                   const geometry::PointCloud &target,
-                                   double max_correspondence_distance,
-                                   const core::Tensor &init,
-                                   const TransformationEstimation &estimation,
-                                   const ICPConvergenceCriteria &criteria) {
-    core::Device device = source.GetDevice();
+void CheckSourceAndTarget(const geometry::PointCloud &source,
+                          const geometry::PointCloud &target) {
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
     target.GetPoints().AssertDtype(dtype);
-    if (target.GetDevice() != device) {
+    if (target.GetDevice() != source.GetDevice()) {
         utility::LogError(
                 "Target Pointcloud device {} != Source Pointcloud's device {}.",
-                target.GetDevice().ToString(), device.ToString());
+                target.GetDevice().ToString(), source.GetDevice().ToString());
     }
-    init.AssertShape({4, 4});
-    init.AssertDtype(dtype);
-    core::Tensor transformation_device = init.To(device);
+}
 
-    open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
-    geometry::PointCloud source_transformed = source.Clone();
-    source_transformed.Transform(transformation_device);
+/// Runs ICP on \p source_transformed, the source already transformed by
+/// \p init, against the target of \p finder. \p num_iterations is set to the
+/// number of transformation updates.
+RegistrationResult RegistrationICPWithFinder(
+        geometry::PointCloud &source_transformed,
+        const geometry::PointCloud &target,
+        CorrespondenceFinder &finder,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria,
+        int &num_iterations) {
+    core::Tensor transformation_device = init;
 
     // TODO: Default constructor absent in RegistrationResult class.
     RegistrationResult result(transformation_device);
 
-    result = GetRegistrationResultAndCorrespondences(
-            source_transformed, target, target_nns, max_correspondence_distance,
-            transformation_device);
+    result = finder.Find(source_transformed, transformation_device);
     CorrespondenceSet corres = std::make_pair(
-            result.correspondence_select_bool_, result.correspondence_set_);
+            result.correspondence_source_indices_, result.correspondence_set_);
 
+    num_iterations = 0;
     for (int i = 0; i < criteria.max_iteration_; i++) {
         utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
                           result.fitness_, result.inlier_rmse_);
@@ -165,14 +235,13 @@ RegistrationResult RegistrationICP(const geometry::PointCloud &source,
                 source_transformed, target, corres);
         transformation_device = update.Matmul(transformation_device);
         source_transformed.Transform(update);
+        num_iterations++;
 
         double prev_fitness_ = result.fitness_;
         double prev_inliner_rmse_ = result.inlier_rmse_;
 
-        result = GetRegistrationResultAndCorrespondences(
-                source_transformed, target, target_nns,
-                max_correspondence_distance, transformation_device);
-        corres = std::make_pair(result.correspondence_select_bool_,
+        result = finder.Find(source_transformed, transformation_device);
+        corres = std::make_pair(result.correspondence_source_indices_,
                                 result.correspondence_set_);
 
         if (std::abs(prev_fitness_ - result.fitness_) <
@@ -185,6 +254,197 @@ RegistrationResult RegistrationICP(const geometry::PointCloud &source,
     return result;
 }
 
+/// Downsamples \p pcd to the mean of the points, and of the normals if any,
+/// in each voxel of size \p voxel_size. The normals are normalized again.
+geometry::PointCloud VoxelDownSample(const geometry::PointCloud &pcd,
+                                     double voxel_size) {
+    geometry::PointCloud pcd_points(pcd.GetPoints());
+    if (pcd.HasPointNormals()) {
+        pcd_points.SetPointNormals(pcd.GetPointNormals());
+    }
+    geometry::PointCloud pcd_down = pcd_points.VoxelDownSample(voxel_size);
+    if (pcd_down.HasPointNormals()) {
+        core::Tensor normals = pcd_down.GetPointNormals();
+        pcd_down.SetPointNormals(normals.Div(
+                normals.Mul(normals).Sum({1}, true).Sqrt().Add(1e-12)));
+    }
+    return pcd_down;
+}
+
+/// Downsamples \p source and \p target to each of \p voxel_sizes. A level
+/// with a voxel size <= 0 uses the input clouds. Each level is downsampled
+/// from the next finer one.
+std::pair<std::vector<geometry::PointCloud>, std::vector<geometry::PointCloud>>
+BuildPyramid(const geometry::PointCloud &source,
+             const geometry::PointCloud &target,
+             const std::vector<double> &voxel_sizes) {
+    const size_t num_levels = voxel_sizes.size();
+    // Point clouds are shallow copies, so the levels share their tensors.
+    std::vector<geometry::PointCloud> source_levels(num_levels, source),
+            target_levels(num_levels, target);
+
+    std::vector<size_t> order(num_levels);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return voxel_sizes[a] < voxel_sizes[b];
+    });
+    geometry::PointCloud source_finer = source, target_finer = target;
+    double finer_voxel_size = 0.0;
+    for (size_t level : order) {
+        double voxel_size = voxel_sizes[level];
+        if (voxel_size > finer_voxel_size) {
+            source_finer = VoxelDownSample(source_finer, voxel_size);
+            target_finer = VoxelDownSample(target_finer, voxel_size);
+            finer_voxel_size = voxel_size;
+        }
+        source_levels[level] = source_finer;
+        target_levels[level] = target_finer;
+    }
+    return std::make_pair(source_levels, target_levels);
+}
+
+}  // namespace
+
+RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
+                                        const geometry::PointCloud &target,
+                                        double max_correspondence_distance,
+                                        const core::Tensor &transformation) {
+    RegistrationTarget registration_target(target,
+                                           max_correspondence_distance);
+    return EvaluateRegistration(source, registration_target,
+                                max_correspondence_distance, transformation);
+}
+
+RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
+                                        const RegistrationTarget &target,
+                                        double max_correspondence_distance,
+                                        const core::Tensor &transformation) {
+    CheckSourceAndTarget(source, target.GetPointCloud());
+    transformation.AssertShape({4, 4});
+    transformation.AssertDtype(core::Dtype::Float32);
+    core::Tensor transformation_device =
+            transformation.To(source.GetDevice());
+
+    CorrespondenceFinder finder(target, max_correspondence_distance);
+
+    geometry::PointCloud source_transformed = source.Clone();
+    source_transformed.Transform(transformation_device);
+    return FillCorrespondenceSelectBool(
+            finder.Find(source_transformed, transformation_device),
+            source.GetPoints().GetLength());
+}
+
+RegistrationResult RegistrationICP(const geometry::PointCloud &source,
+                                   const geometry::PointCloud &target,
+                                   double max_correspondence_distance,
+                                   const core::Tensor &init,
+                                   const TransformationEstimation &estimation,
+                                   const ICPConvergenceCriteria &criteria) {
+    RegistrationTarget registration_target(target,
+                                           max_correspondence_distance);
+    return RegistrationICP(source, registration_target,
+                           max_correspondence_distance, init, estimation,
+                           criteria);
+}
+
+RegistrationResult RegistrationICP(const geometry::PointCloud &source,
+                                   const RegistrationTarget &target,
+                                   double max_correspondence_distance,
+                                   const core::Tensor &init,
+                                   const TransformationEstimation &estimation,
+                                   const ICPConvergenceCriteria &criteria) {
+    CheckSourceAndTarget(source, target.GetPointCloud());
+    init.AssertShape({4, 4});
+    init.AssertDtype(core::Dtype::Float32);
+    core::Tensor transformation_device = init.To(source.GetDevice());
+
+    CorrespondenceFinder finder(target, max_correspondence_distance);
+    geometry::PointCloud source_transformed = source.Clone();
+    source_transformed.Transform(transformation_device);
+
+    int num_iterations;
+    return FillCorrespondenceSelectBool(
+            RegistrationICPWithFinder(source_transformed,
+                                      target.GetPointCloud(), finder,
+                                      transformation_device, estimation,
+                                      criteria, num_iterations),
+            source.GetPoints().GetLength());
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation,
+        std::vector<ICPLevelStatistics> *level_statistics) {
+    CheckSourceAndTarget(source, target);
+    init.AssertShape({4, 4});
+    init.AssertDtype(core::Dtype::Float32);
+
+    const size_t num_levels = voxel_sizes.size();
+    if (num_levels == 0) {
+        utility::LogError("voxel_sizes must not be empty.");
+    }
+    if (criteria_list.size() != num_levels ||
+        max_correspondence_distances.size() != num_levels) {
+        utility::LogError(
+                "voxel_sizes, criteria_list and max_correspondence_distances "
+                "must have the same length, but got {}, {} and {}.",
+                num_levels, criteria_list.size(),
+                max_correspondence_distances.size());
+    }
+
+    std::vector<geometry::PointCloud> source_levels, target_levels;
+    std::tie(source_levels, target_levels) =
+            BuildPyramid(source, target, voxel_sizes);
+
+    if (level_statistics != nullptr) {
+        level_statistics->assign(num_levels, ICPLevelStatistics());
+    }
+    core::Tensor transformation_device = init.To(source.GetDevice());
+    RegistrationResult result(transformation_device);
+    for (size_t level = 0; level < num_levels; level++) {
+        utility::Timer timer;
+        timer.Start();
+
+        const geometry::PointCloud &level_target = target_levels[level];
+        RegistrationTarget registration_target(
+                level_target, max_correspondence_distances[level]);
+        CorrespondenceFinder finder(registration_target,
+                                    max_correspondence_distances[level]);
+        geometry::PointCloud source_transformed =
+                source_levels[level].Clone();
+        source_transformed.Transform(transformation_device);
+
+        int num_iterations;
+        result = RegistrationICPWithFinder(
+                source_transformed, level_target, finder,
+                transformation_device, estimation, criteria_list[level],
+                num_iterations);
+        transformation_device = result.transformation_;
+
+        timer.Stop();
+        utility::LogDebug(
+                "Multi-scale ICP level {:d}: voxel size {:.4f}, {:d} "
+                "iterations, Fitness {:.4f}, RMSE {:.4f}, time {:.3f} ms",
+                level, voxel_sizes[level], num_iterations, result.fitness_,
+                result.inlier_rmse_, timer.GetDuration());
+        if (level_statistics != nullptr) {
+            ICPLevelStatistics &statistics = (*level_statistics)[level];
+            statistics.voxel_size_ = voxel_sizes[level];
+            statistics.num_iterations_ = num_iterations;
+            statistics.fitness_ = result.fitness_;
+            statistics.inlier_rmse_ = result.inlier_rmse_;
+            statistics.time_ms_ = timer.GetDuration();
+        }
+    }
+    return FillCorrespondenceSelectBool(
+            result, source_levels[num_levels - 1].GetPoints().GetLength());
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
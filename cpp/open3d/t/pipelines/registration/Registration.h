@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -33,6 +34,14 @@
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
+
+namespace core {
+namespace nns {
+class FixedRadiusIndex;
+class NearestNeighborSearch;
+}  // namespace nns
+}  // namespace core
+
 namespace t {
 
 namespace geometry {
@@ -96,14 +105,21 @@ public:
 public:
     /// The estimated transformation matrix.
     core::Tensor transformation_;
-    /// correspondence_select_bool_ is a {N,1} bool tensor (N is the number of
-    /// query points), with value true for source points having good
-    /// correspondence, and false otherwise
-    core::Tensor correspondence_select_bool_;
-    /// correspondence_set_ is a {C,1} shape Float32 tensor (C is the number
-    /// of good correspondences), where value at [i, 1] is the corresponding
-    /// index in the target, for query point [i, 1].
+    /// correspondence_source_indices_ is a {C,} Int64 tensor (C is the number
+    /// of good correspondences), with the indices of the source points having
+    /// good correspondence, in increasing order.
+    core::Tensor correspondence_source_indices_;
+    /// correspondence_set_ is a {C,} Int64 tensor, where value at [i] is the
+    /// index in the target corresponding to the source point
+    /// correspondence_source_indices_[i].
     core::Tensor correspondence_set_;
+    /// Deprecated: use correspondence_source_indices_ instead.
+    /// correspondence_select_bool_ is a {N,} Bool tensor (N is the number of
+    /// source points), with value true for source points having good
+    /// correspondence. It is only filled in the results returned by
+    /// EvaluateRegistration(), RegistrationICP() and
+    /// RegistrationMultiScaleICP(), not in the ones of each ICP iteration.
+    core::Tensor correspondence_select_bool_;
     /// RMSE of all inlier correspondences. Lower is better.
     double inlier_rmse_;
     /// For ICP: the overlapping area (# of inlier correspondences / # of points
@@ -111,6 +127,76 @@ public:
     double fitness_;
 };
 
+/// \class RegistrationTarget
+///
+/// \brief Target point cloud of registrations, with its nearest neighbor
+/// index.
+///
+/// The index is built once on construction and is only read by the
+/// registrations against the target. On the CPU, one RegistrationTarget can
+/// be shared by concurrent registrations, e.g. of many scans against one
+/// static map.
+class RegistrationTarget {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The target point cloud. Its tensors are shared, and must
+    /// not be modified while the RegistrationTarget is used.
+    /// \param max_correspondence_distance The largest maximum correspondence
+    /// points-pair distance of the registrations against the target.
+    RegistrationTarget(const geometry::PointCloud &target,
+                       double max_correspondence_distance);
+    ~RegistrationTarget();
+    RegistrationTarget(const RegistrationTarget &) = delete;
+    RegistrationTarget &operator=(const RegistrationTarget &) = delete;
+
+public:
+    /// Returns the target point cloud.
+    const geometry::PointCloud &GetPointCloud() const { return target_; }
+
+    /// Returns the largest maximum correspondence distance supported.
+    double GetMaxCorrespondenceDistance() const {
+        return max_correspondence_distance_;
+    }
+
+    /// Returns the FixedRadiusIndex of the target points, or null if the
+    /// target is on CUDA or max_correspondence_distance is too large relative
+    /// to the extent of the target for the index to be efficient.
+    const core::nns::FixedRadiusIndex *GetFixedRadiusIndex() const {
+        return fixed_radius_index_.get();
+    }
+
+    /// Returns the hybrid search index of the target points, or null if the
+    /// FixedRadiusIndex is used.
+    core::nns::NearestNeighborSearch *GetNearestNeighborSearch() const {
+        return nns_.get();
+    }
+
+private:
+    geometry::PointCloud target_;
+    double max_correspondence_distance_;
+    std::unique_ptr<core::nns::FixedRadiusIndex> fixed_radius_index_;
+    std::unique_ptr<core::nns::NearestNeighborSearch> nns_;
+};
+
+/// \class ICPLevelStatistics
+///
+/// Class that contains the statistics of one level of a multi-scale ICP.
+class ICPLevelStatistics {
+public:
+    /// Voxel size of the level. 0 if the level is at full resolution.
+    double voxel_size_ = 0.0;
+    /// Number of ICP iterations run at the level.
+    int num_iterations_ = 0;
+    /// Fitness at the end of the level.
+    double fitness_ = 0.0;
+    /// Inlier RMSE at the end of the level.
+    double inlier_rmse_ = 0.0;
+    /// Time spent on the level in milliseconds, including building its target
+    /// index.
+    double time_ms_ = 0.0;
+};
+
 /// \brief Function for evaluating registration between point clouds.
 ///
 /// \param source The source point cloud.
@@ -126,6 +212,22 @@ RegistrationResult EvaluateRegistration(
         const core::Tensor &transformation = core::Tensor::Eye(
                 4, core::Dtype::Float32, core::Device("CPU:0")));
 
+/// \brief Function for evaluating registration between point clouds, with a
+/// prebuilt target index.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud and its index.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance. Must not be larger than the one \p target was built with.
+/// \param transformation The 4x4 transformation matrix to transform
+/// source to target.
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const core::Tensor &transformation = core::Tensor::Eye(
+                4, core::Dtype::Float32, core::Device("CPU:0")));
+
 /// \brief Functions for ICP registration.
 ///
 /// \param source The source point cloud.
@@ -144,6 +246,53 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Functions for ICP registration, with a prebuilt target index.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud and its index.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance. Must not be larger than the one \p target was built with.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const RegistrationTarget &target,
+        double max_correspondence_distance,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief Function for coarse-to-fine ICP registration.
+///
+/// Both point clouds are voxel downsampled once to each of \p voxel_sizes,
+/// keeping the mean of the points and of the normals in each voxel. ICP runs
+/// on the levels in the given order, typically from the largest voxel size to
+/// the smallest, each level starting from the transformation estimated by the
+/// previous one. The target index is built once per level.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param voxel_sizes Voxel size of each level. A level with a voxel size
+/// <= 0 runs on the input point clouds.
+/// \param criteria_list Convergence criteria of each level.
+/// \param max_correspondence_distances Maximum correspondence points-pair
+/// distance of each level.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param level_statistics If not null, set to the statistics of each level.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
+        const std::vector<double> &max_correspondence_distances,
+        const core::Tensor &init,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(),
+        std::vector<ICPLevelStatistics> *level_statistics = nullptr);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
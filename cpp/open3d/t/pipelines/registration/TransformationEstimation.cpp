@@ -26,11 +26,25 @@
 
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
+#include <tuple>
+
+#include "open3d/core/TensorExpr.h"
+#include "open3d/t/pipelines/kernel/ComputeTransform.h"
+
 namespace open3d {
 namespace t {
 namespace pipelines {
 namespace registration {
 
+/// Returns the source indices of \p corres, whose first tensor may also be a
+/// bool mask.
+static core::Tensor GetSourceIndices(const CorrespondenceSet &corres) {
+    if (corres.first.GetDtype() == core::Dtype::Bool) {
+        return corres.first.NonZero().Reshape({-1});
+    }
+    return corres.first;
+}
+
 double TransformationEstimationPointToPoint::ComputeRMSE(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -50,9 +64,12 @@ double TransformationEstimationPointToPoint::ComputeRMSE(
     core::Tensor source_select = source.GetPoints().IndexGet({corres.first});
     core::Tensor target_select = target.GetPoints().IndexGet({corres.second});
 
-    core::Tensor error_t = (source_select - target_select);
-    error_t.Mul_(error_t);
-    error = static_cast<double>(error_t.Sum({0, 1}).Item<float>());
+    // Fused into a single pass without temporaries.
+    error = static_cast<double>(
+            (core::TensorExpr(source_select) - target_select)
+                    .Square()
+                    .Sum()
+                    .Item<float>());
     return std::sqrt(error / static_cast<double>(corres.second.GetShape()[0]));
 }
 
@@ -69,6 +86,17 @@ core::Tensor TransformationEstimationPointToPoint::ComputeTransformation(
                 "Target Pointcloud device {} != Source Pointcloud's device {}.",
                 target.GetDevice().ToString(), device.ToString());
     }
+
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        // Single pass over the correspondences.
+        double residual;
+        core::Tensor R, t;
+        std::tie(R, t) = t::pipelines::kernel::ComputeRtPointToPoint(
+                source.GetPoints(), target.GetPoints(),
+                GetSourceIndices(corres), corres.second, residual);
+        return t::pipelines::kernel::RtToTransformation(R, t);
+    }
+
     core::Tensor source_select = source.GetPoints().IndexGet({corres.first});
     core::Tensor target_select = target.GetPoints().IndexGet({corres.second});
 
@@ -114,10 +142,12 @@ double TransformationEstimationPointToPlane::ComputeRMSE(
     core::Tensor target_n_select =
             target.GetPointNormals().IndexGet({corres.second});
 
-    core::Tensor error_t =
-            (source_select - target_select).Mul_(target_n_select);
-    error_t.Mul_(error_t);
-    double error = static_cast<double>(error_t.Sum({0, 1}).Item<float>());
+    double error = static_cast<double>(
+            ((core::TensorExpr(source_select) - target_select) *
+             target_n_select)
+                    .Square()
+                    .Sum()
+                    .Item<float>());
     return std::sqrt(error / static_cast<double>(corres.second.GetShape()[0]));
 }
 
@@ -136,6 +166,16 @@ core::Tensor TransformationEstimationPointToPlane::ComputeTransformation(
                 target.GetDevice().ToString(), device.ToString());
     }
 
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        // Single pass over the correspondences.
+        double residual;
+        core::Tensor pose = t::pipelines::kernel::ComputePosePointToPlane(
+                source.GetPoints(), target.GetPoints(),
+                target.GetPointNormals(), GetSourceIndices(corres),
+                corres.second, residual);
+        return t::pipelines::kernel::PoseToTransformation(pose);
+    }
+
     core::Tensor source_select =
             source.GetPoints().IndexGet({corres.first}).To(dtype);
     core::Tensor target_select =
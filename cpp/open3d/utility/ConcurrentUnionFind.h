@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace open3d {
+namespace utility {
+
+/// \class ConcurrentUnionFind
+///
+/// \brief Lock-free union-find (disjoint set) over the elements
+/// [0, num_elements), whose Find() and Union() may be called from several
+/// threads at once.
+///
+/// Union() always links the larger root below the smaller one, so once all
+/// the unions are done, the root of each set is its smallest element
+/// regardless of the order of the unions. Find() shortens the paths it walks
+/// by path halving.
+template <typename index_t>
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(index_t num_elements)
+        : parent_(new std::atomic<index_t>[num_elements]) {
+        for (index_t i = 0; i < num_elements; ++i) {
+            parent_[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /// Returns the root of the set of \p x.
+    index_t Find(index_t x) {
+        index_t parent = parent_[x].load();
+        while (parent != x) {
+            index_t grandparent = parent_[parent].load();
+            if (grandparent != parent) {
+                // May fail if another thread moved x, which is fine.
+                parent_[x].compare_exchange_weak(parent, grandparent);
+            }
+            x = grandparent;
+            parent = parent_[x].load();
+        }
+        return x;
+    }
+
+    /// Merges the sets of \p x and \p y.
+    void Union(index_t x, index_t y) {
+        while (true) {
+            x = Find(x);
+            y = Find(y);
+            if (x == y) {
+                return;
+            }
+            if (x < y) {
+                std::swap(x, y);
+            }
+            // Retries if x stopped being a root in the meantime.
+            index_t expected = x;
+            if (parent_[x].compare_exchange_strong(expected, y)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::unique_ptr<std::atomic<index_t>[]> parent_;
+};
+
+}  // namespace utility
+}  // namespace open3d
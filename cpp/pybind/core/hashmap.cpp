@@ -29,6 +29,9 @@
 #include <pybind11/cast.h>
 #include <pybind11/pytypes.h>
 
+#include <string>
+#include <unordered_map>
+
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
@@ -40,6 +43,13 @@
 namespace open3d {
 namespace core {
 void pybind_core_hashmap(py::module& m) {
+    py::enum_<HashmapBackend>(m, "HashmapBackend",
+                              "Hash table implementation on CPU devices.")
+            .value("Default", HashmapBackend::Default)
+            .value("TBB", HashmapBackend::TBB)
+            .value("OpenAddressing", HashmapBackend::OpenAddressing)
+            .export_values();
+
     py::class_<Hashmap> hashmap(
             m, "Hashmap",
             "A Hashmap is a map from key to data wrapped by Tensors.");
@@ -48,19 +58,67 @@ void pybind_core_hashmap(py::module& m) {
                             const Dtype& dtype_value,
                             const py::handle& element_shape_key,
                             const py::handle& element_shape_value,
-                            const Device& device) {
+                            const Device& device,
+                            const HashmapBackend& backend) {
                     SizeVector element_shape_key_sv =
                             PyHandleToSizeVector(element_shape_key);
                     SizeVector element_shape_value_sv =
                             PyHandleToSizeVector(element_shape_value);
                     return Hashmap(init_capacity, dtype_key, dtype_value,
                                    element_shape_key_sv, element_shape_value_sv,
-                                   device);
+                                   device, backend);
                 }),
                 "init_capacity"_a, "dtype_key"_a, "dtype_value"_a,
                 "element_shape_key"_a = SizeVector({1}),
                 "element_shape_value"_a = SizeVector({1}),
-                "device"_a = Device("CPU:0"));
+                "device"_a = Device("CPU:0"),
+                "backend"_a = HashmapBackend::Default);
+
+    hashmap.def(py::init([](int64_t init_capacity, const Dtype& dtype_key,
+                            const py::handle& element_shape_key,
+                            const std::vector<Dtype>& dtypes_value,
+                            const std::vector<py::handle>& element_shapes_value,
+                            const Device& device,
+                            const HashmapBackend& backend) {
+                    SizeVector element_shape_key_sv =
+                            PyHandleToSizeVector(element_shape_key);
+                    std::vector<SizeVector> element_shapes_value_sv;
+                    for (const py::handle& shape : element_shapes_value) {
+                        element_shapes_value_sv.push_back(
+                                PyHandleToSizeVector(shape));
+                    }
+                    return Hashmap(init_capacity, dtype_key,
+                                   element_shape_key_sv, dtypes_value,
+                                   element_shapes_value_sv, device, backend);
+                }),
+                "init_capacity"_a, "dtype_key"_a, "element_shape_key"_a,
+                "dtypes_value"_a, "element_shapes_value"_a,
+                "device"_a = Device("CPU:0"),
+                "backend"_a = HashmapBackend::Default);
+
+    hashmap.def(py::init([](int64_t init_capacity, const Dtype& dtype_key,
+                            const py::handle& element_shape_key,
+                            const std::vector<Dtype>& dtypes_value,
+                            const std::vector<py::handle>& element_shapes_value,
+                            const std::vector<std::string>& value_names,
+                            const Device& device,
+                            const HashmapBackend& backend) {
+                    SizeVector element_shape_key_sv =
+                            PyHandleToSizeVector(element_shape_key);
+                    std::vector<SizeVector> element_shapes_value_sv;
+                    for (const py::handle& shape : element_shapes_value) {
+                        element_shapes_value_sv.push_back(
+                                PyHandleToSizeVector(shape));
+                    }
+                    return Hashmap(init_capacity, dtype_key,
+                                   element_shape_key_sv, dtypes_value,
+                                   element_shapes_value_sv, value_names, device,
+                                   backend);
+                }),
+                "init_capacity"_a, "dtype_key"_a, "element_shape_key"_a,
+                "dtypes_value"_a, "element_shapes_value"_a, "value_names"_a,
+                "device"_a = Device("CPU:0"),
+                "backend"_a = HashmapBackend::Default);
 
     hashmap.def("insert",
                 [](Hashmap& h, const Tensor& keys, const Tensor& values) {
@@ -69,6 +127,30 @@ void pybind_core_hashmap(py::module& m) {
                     return py::make_tuple(addrs, masks);
                 });
 
+    hashmap.def("insert", [](Hashmap& h, const Tensor& keys,
+                             const std::vector<Tensor>& values_soa) {
+        Tensor addrs, masks;
+        h.Insert(keys, values_soa, addrs, masks);
+        return py::make_tuple(addrs, masks);
+    });
+
+    hashmap.def("insert",
+                [](Hashmap& h, const Tensor& keys,
+                   const std::unordered_map<std::string, Tensor>& values_map) {
+                    if (values_map.size() != h.GetValueNames().size()) {
+                        utility::LogError(
+                                "Expected {} named value tensors, but got {}.",
+                                h.GetValueNames().size(), values_map.size());
+                    }
+                    std::vector<Tensor> values_soa(values_map.size());
+                    for (const auto& kv : values_map) {
+                        values_soa[h.GetValueBufferIndex(kv.first)] = kv.second;
+                    }
+                    Tensor addrs, masks;
+                    h.Insert(keys, values_soa, addrs, masks);
+                    return py::make_tuple(addrs, masks);
+                });
+
     hashmap.def("activate", [](Hashmap& h, const Tensor& keys) {
         Tensor addrs, masks;
         h.Activate(keys, addrs, masks);
@@ -94,10 +176,25 @@ void pybind_core_hashmap(py::module& m) {
     });
 
     hashmap.def("get_key_buffer", &Hashmap::GetKeyBuffer);
-    hashmap.def("get_value_buffer", &Hashmap::GetValueBuffer);
+    hashmap.def("get_value_buffer",
+                py::overload_cast<size_t>(&Hashmap::GetValueBuffer, py::const_),
+                "i"_a = 0);
+    hashmap.def("get_value_buffer",
+                py::overload_cast<const std::string&>(&Hashmap::GetValueBuffer,
+                                                      py::const_),
+                "name"_a);
+    hashmap.def("get_value_buffers", &Hashmap::GetValueBuffers);
+    hashmap.def("get_value_names", &Hashmap::GetValueNames);
 
     hashmap.def("get_key_tensor", &Hashmap::GetKeyTensor);
-    hashmap.def("get_value_tensor", &Hashmap::GetValueTensor);
+    hashmap.def("get_value_tensor",
+                py::overload_cast<size_t>(&Hashmap::GetValueTensor, py::const_),
+                "i"_a = 0);
+    hashmap.def("get_value_tensor",
+                py::overload_cast<const std::string&>(&Hashmap::GetValueTensor,
+                                                      py::const_),
+                "name"_a);
+    hashmap.def("get_value_tensors", &Hashmap::GetValueTensors);
 
     hashmap.def("rehash", &Hashmap::Rehash);
     hashmap.def("size", &Hashmap::Size);
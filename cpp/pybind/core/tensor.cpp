@@ -328,6 +328,8 @@ void pybind_core_tensor(py::module& m) {
             },
             "start"_a = py::none(), "stop"_a, "step"_a = py::none(),
             "dtype"_a = py::none(), "device"_a = py::none());
+    tensor.def_static("concatenate", &Tensor::Concatenate, "tensors"_a,
+                      "axis"_a = 0);
 
     // Device transfer.
     tensor.def(
@@ -397,6 +399,8 @@ void pybind_core_tensor(py::module& m) {
     // Numpy IO.
     tensor.def("save", &Tensor::Save);
     tensor.def_static("load", &Tensor::Load);
+    tensor.def_static("load_mmap", &Tensor::LoadMmap, "file_name"_a,
+                      "copy_on_write"_a = false);
 
     /// Linalg operations.
     tensor.def("matmul", &Tensor::Matmul);
@@ -564,6 +568,30 @@ void pybind_core_tensor(py::module& m) {
     BIND_REDUCTION_OP_NO_KEEPDIM(argmin, ArgMin);
     BIND_REDUCTION_OP_NO_KEEPDIM(argmax, ArgMax);
 
+    // Sorting, scans and segment reductions.
+    tensor.def("argsort", &Tensor::ArgSort);
+    tensor.def("sort", &Tensor::Sort);
+    tensor.def("unique", &Tensor::Unique, "return_inverse"_a = false,
+               "return_counts"_a = false);
+    tensor.def("cumsum", &Tensor::CumSum, "dim"_a);
+    tensor.def("segment_sum", &Tensor::SegmentSum, "segment_ids"_a,
+               "num_segments"_a = -1);
+    tensor.def("segment_mean", &Tensor::SegmentMean, "segment_ids"_a,
+               "num_segments"_a = -1);
+    tensor.def("segment_max", &Tensor::SegmentMax, "segment_ids"_a,
+               "num_segments"_a = -1);
+
+    // Gather, scatter and masked assignment.
+    tensor.def("gather", &Tensor::Gather, "indices"_a);
+    tensor.def("scatter_add_", &Tensor::ScatterAdd_, "indices"_a, "src"_a);
+    tensor.def("scatter_max_", &Tensor::ScatterMax_, "indices"_a, "src"_a);
+    tensor.def(
+            "masked_fill_",
+            [](Tensor& tensor, const Tensor& mask, const Tensor& value) {
+                return tensor.MaskedFill_(mask, value);
+            },
+            "mask"_a, "value"_a);
+
     // Comparison.
     tensor.def("allclose", &Tensor::AllClose, "other"_a, "rtol"_a = 1e-5,
                "atol"_a = 1e-8);
@@ -39,6 +39,16 @@ namespace open3d {
 namespace geometry {
 
 void pybind_pointcloud(py::module &m) {
+    py::enum_<VoxelDownSampleMode>(m, "VoxelDownSampleMode")
+            .value("Mean", VoxelDownSampleMode::Mean,
+                   "Mean of the points and of each attribute.")
+            .value("First", VoxelDownSampleMode::First,
+                   "The point with the smallest index, with its attributes.")
+            .value("Center", VoxelDownSampleMode::Center,
+                   "The voxel center, with the attributes of the point "
+                   "closest to it.")
+            .export_values();
+
     py::class_<PointCloud, PyGeometry3D<PointCloud>,
                std::shared_ptr<PointCloud>, Geometry3D>
             pointcloud(m, "PointCloud",
@@ -76,7 +86,7 @@ void pybind_pointcloud(py::module &m) {
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
                  "a voxel. Normals and colors are averaged if they exist.",
-                 "voxel_size"_a)
+                 "voxel_size"_a, "mode"_a = VoxelDownSampleMode::Mean)
             .def("voxel_down_sample_and_trace",
                  &PointCloud::VoxelDownSampleAndTrace,
                  "Function to downsample using "
@@ -170,11 +180,20 @@ void pybind_pointcloud(py::module &m) {
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
-                 "eps"_a, "min_points"_a, "print_progress"_a = false)
+                 "eps"_a, "min_points"_a, "print_progress"_a = false,
+                 "low_memory"_a = false)
             .def("segment_plane", &PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999)
+            .def("segment_planes", &PointCloud::SegmentPlanes,
+                 "Segments several planes in the point cloud with RANSAC, one "
+                 "after the other among the points left. Returns a list of "
+                 "(plane_model, inliers) tuples.",
+                 "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                 "num_iterations"_a = 100, "max_num_planes"_a = 10,
+                 "min_num_inliers"_a = 100, "probability"_a = 0.99999999)
             .def_static(
                     "create_from_depth_image",
                     &PointCloud::CreateFromDepthImage,
@@ -229,7 +248,7 @@ void pybind_pointcloud(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "PointCloud", "voxel_down_sample",
             {{"voxel_size", "Voxel size to downsample into."},
-             {"invert", "set to ``True`` to invert the selection of indices"}});
+             {"mode", "How the points of a voxel are merged."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "voxel_down_sample_and_trace",
             {{"voxel_size", "Voxel size to downsample into."},
@@ -299,7 +318,10 @@ void pybind_pointcloud(py::module &m) {
               "Density parameter that is used to find neighbouring points."},
              {"min_points", "Minimum number of points to form a cluster."},
              {"print_progress",
-              "If true the progress is visualized in the console."}});
+              "If true the progress is visualized in the console."},
+             {"low_memory",
+              "If true the neighborhoods are not stored and the core points "
+              "are merged with a parallel union-find."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "segment_plane",
             {{"distance_threshold",
@@ -308,7 +330,28 @@ void pybind_pointcloud(py::module &m) {
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Required confidence, in (0, 1], that at least one sample "
+              "consisted of inliers only. It is not an inlier ratio. With w "
+              "the inlier ratio of the best plane so far, the number of "
+              "iterations is lowered to log(1 - probability) / log(1 - "
+              "w^ransac_n)."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations for each plane."},
+             {"max_num_planes", "Maximum number of planes."},
+             {"min_num_inliers", "Minimum number of inliers of a plane."},
+             {"probability",
+              "Required confidence, in (0, 1], that at least one sample of "
+              "each round consisted of inliers only, as in segment_plane. It "
+              "is not an inlier ratio."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
@@ -62,6 +62,53 @@ void pybind_feature(py::module &m) {
     docstring::ClassMethodDocInject(m, "Feature", "resize",
                                     {{"dim", "Feature dimension per point."},
                                      {"n", "Number of points."}});
+
+    // open3d.registration.FeatureMatchingOption
+    py::class_<FeatureMatchingOption> matching_option(
+            m, "FeatureMatchingOption",
+            "Options for matching features to their nearest neighbors.");
+    py::detail::bind_copy_functions<FeatureMatchingOption>(matching_option);
+
+    // open3d.registration.FeatureMatchingOption.Method
+    py::enum_<FeatureMatchingOption::Method> matching_method(
+            matching_option, "Method", py::arithmetic());
+    matching_method.value("Exact", FeatureMatchingOption::Method::Exact)
+            .value("KDForest", FeatureMatchingOption::Method::KDForest)
+            .export_values();
+    matching_method.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for the nearest neighbor search used to "
+                       "match the features.";
+            }),
+            py::none(), py::none(), "");
+
+    matching_option
+            .def(py::init([](FeatureMatchingOption::Method method,
+                             int num_trees, int checks) {
+                     return new FeatureMatchingOption(method, num_trees,
+                                                      checks);
+                 }),
+                 "method"_a = FeatureMatchingOption::Method::Exact,
+                 "num_trees"_a = 4, "checks"_a = 1024)
+            .def_readwrite("method", &FeatureMatchingOption::method_,
+                           "Method: Nearest neighbor search used to match the "
+                           "features.")
+            .def_readwrite("num_trees", &FeatureMatchingOption::num_trees_,
+                           "int: Number of randomized kd-trees of the "
+                           "KDForest method.")
+            .def_readwrite("checks", &FeatureMatchingOption::checks_,
+                           "int: Number of points the KDForest method "
+                           "compares each query with. More checks give a "
+                           "higher recall at a higher cost.")
+            .def("__repr__", [](const FeatureMatchingOption &o) {
+                return fmt::format(
+                        "FeatureMatchingOption class with \nmethod={}"
+                        "\nnum_trees={}\nchecks={}",
+                        o.method_ == FeatureMatchingOption::Method::Exact
+                                ? "Exact"
+                                : "KDForest",
+                        o.num_trees_, o.checks_);
+            });
 }
 
 void pybind_feature_methods(py::module &m) {
@@ -72,6 +119,21 @@ void pybind_feature_methods(py::module &m) {
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
              {"search_param", "KDTree KNN search parameter."}});
+
+    m.def("correspondences_from_features", &CorrespondencesFromFeatures,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to find the nearest target feature of each source "
+          "feature",
+          "source_features"_a, "target_features"_a, "mutual_filter"_a = false,
+          "option"_a = FeatureMatchingOption());
+    docstring::FunctionDocInject(
+            m, "correspondences_from_features",
+            {{"source_features", "Source features."},
+             {"target_features", "Target features."},
+             {"mutual_filter",
+              "Keep only the correspondences whose source feature is also "
+              "the nearest source feature of their target feature."},
+             {"option", "Options for the nearest neighbor search."}});
 }
 
 }  // namespace registration
@@ -134,11 +134,13 @@ void pybind_registration_classes(py::module &m) {
             "computation time is acceptable.");
     py::detail::bind_copy_functions<RANSACConvergenceCriteria>(ransac_criteria);
     ransac_criteria
-            .def(py::init([](int max_iteration, double confidence) {
-                     return new RANSACConvergenceCriteria(max_iteration,
-                                                          confidence);
+            .def(py::init([](int max_iteration, double confidence,
+                             double early_rejection_sigma) {
+                     return new RANSACConvergenceCriteria(
+                             max_iteration, confidence, early_rejection_sigma);
                  }),
-                 "max_iteration"_a = 100000, "confidence"_a = 0.999)
+                 "max_iteration"_a = 100000, "confidence"_a = 0.999,
+                 "early_rejection_sigma"_a = 0.0)
             .def_readwrite("max_iteration",
                            &RANSACConvergenceCriteria::max_iteration_,
                            "Maximum iteration before iteration stops.")
@@ -146,12 +148,20 @@ void pybind_registration_classes(py::module &m) {
                     "confidence", &RANSACConvergenceCriteria::confidence_,
                     "Maximum times the validation has been run before the "
                     "iteration stops.")
+            .def_readwrite(
+                    "early_rejection_sigma",
+                    &RANSACConvergenceCriteria::early_rejection_sigma_,
+                    "Number of standard deviations below the best inlier "
+                    "ratio at which a hypothesis is rejected before all "
+                    "correspondences are scored. 0 disables the test.")
             .def("__repr__", [](const RANSACConvergenceCriteria &c) {
                 return fmt::format(
                         "RANSACConvergenceCriteria "
                         "class with max_iteration={:d}, "
-                        "and confidence={:e}",
-                        c.max_iteration_, c.confidence_);
+                        "confidence={:e}, "
+                        "and early_rejection_sigma={:e}",
+                        c.max_iteration_, c.confidence_,
+                        c.early_rejection_sigma_);
             });
 
     // open3d.registration.TransformationEstimation
@@ -423,17 +433,19 @@ must hold true for all edges.)");
                              bool decrease_mu,
                              double maximum_correspondence_distance,
                              int iteration_number, double tuple_scale,
-                             int maximum_tuple_count) {
+                             int maximum_tuple_count,
+                             const FeatureMatchingOption &matching_option) {
                      return new FastGlobalRegistrationOption(
                              division_factor, use_absolute_scale, decrease_mu,
                              maximum_correspondence_distance, iteration_number,
-                             tuple_scale, maximum_tuple_count);
+                             tuple_scale, maximum_tuple_count, matching_option);
                  }),
                  "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
                  "decrease_mu"_a = false,
                  "maximum_correspondence_distance"_a = 0.025,
                  "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
-                 "maximum_tuple_count"_a = 1000)
+                 "maximum_tuple_count"_a = 1000,
+                 "matching_option"_a = FeatureMatchingOption())
             .def_readwrite(
                     "division_factor",
                     &FastGlobalRegistrationOption::division_factor_,
@@ -461,6 +473,10 @@ must hold true for all edges.)");
             .def_readwrite("maximum_tuple_count",
                            &FastGlobalRegistrationOption::maximum_tuple_count_,
                            "float: Maximum tuple numbers.")
+            .def_readwrite("matching_option",
+                           &FastGlobalRegistrationOption::matching_option_,
+                           "FeatureMatchingOption: Options for the nearest "
+                           "neighbor search that matches the features.")
             .def("__repr__", [](const FastGlobalRegistrationOption &c) {
                 return fmt::format(
                         ""
@@ -512,6 +528,67 @@ must hold true for all edges.)");
                         rr.fitness_, rr.inlier_rmse_,
                         rr.correspondence_set_.size());
             });
+
+    // open3d.registration.RegistrationTarget
+    py::class_<RegistrationTarget, std::shared_ptr<RegistrationTarget>>
+            registration_target(
+                    m, "RegistrationTarget",
+                    "Target point cloud of registrations, with its KD-tree "
+                    "built once. It can be shared by concurrent "
+                    "registrations against the same target.");
+    registration_target
+            .def(py::init<const geometry::PointCloud &>(), "target"_a)
+            .def("get_point_cloud", &RegistrationTarget::GetPointCloud,
+                 py::return_value_policy::reference_internal,
+                 "Returns the target point cloud.")
+            .def("__repr__", [](const RegistrationTarget &t) {
+                return fmt::format("RegistrationTarget with {:d} points",
+                                   t.GetPointCloud().points_.size());
+            });
+
+    // open3d.registration.ColoredICPTarget
+    py::class_<ColoredICPTarget, std::shared_ptr<ColoredICPTarget>,
+               RegistrationTarget>
+            colored_icp_target(
+                    m, "ColoredICPTarget",
+                    "Target point cloud of Colored ICP, with its KD-tree and "
+                    "color gradients computed once.");
+    colored_icp_target
+            .def(py::init<const geometry::PointCloud &, double>(), "target"_a,
+                 "max_correspondence_distance"_a)
+            .def("__repr__", [](const ColoredICPTarget &t) {
+                return fmt::format("ColoredICPTarget with {:d} points",
+                                   t.GetPointCloud().points_.size());
+            });
+
+    // open3d.registration.ICPLevelStatistics
+    py::class_<ICPLevelStatistics> level_statistics(
+            m, "ICPLevelStatistics",
+            "Class that contains the statistics of one level of a "
+            "multi-scale ICP.");
+    py::detail::bind_default_constructor<ICPLevelStatistics>(level_statistics);
+    py::detail::bind_copy_functions<ICPLevelStatistics>(level_statistics);
+    level_statistics
+            .def_readwrite("voxel_size", &ICPLevelStatistics::voxel_size_,
+                           "float: Voxel size of the level. 0 if the level is "
+                           "at full resolution.")
+            .def_readwrite("num_iterations",
+                           &ICPLevelStatistics::num_iterations_,
+                           "int: Number of ICP iterations run at the level.")
+            .def_readwrite("fitness", &ICPLevelStatistics::fitness_,
+                           "float: Fitness at the end of the level.")
+            .def_readwrite("inlier_rmse", &ICPLevelStatistics::inlier_rmse_,
+                           "float: Inlier RMSE at the end of the level.")
+            .def_readwrite("time_ms", &ICPLevelStatistics::time_ms_,
+                           "float: Time spent on the level in milliseconds.")
+            .def("__repr__", [](const ICPLevelStatistics &s) {
+                return fmt::format(
+                        "ICPLevelStatistics with voxel_size={:e}"
+                        ", num_iterations={:d}, fitness={:e}"
+                        ", inlier_rmse={:e}, and time_ms={:e}",
+                        s.voxel_size_, s.num_iterations_, s.fitness_,
+                        s.inlier_rmse_, s.time_ms_);
+            });
 }
 
 // Registration functions have similar arguments, sharing arg docstrings
@@ -534,6 +611,7 @@ static const std::unordered_map<std::string, std::string>
                  "o3d.utility.Vector2iVector that stores indices of "
                  "corresponding point or feature arrays."},
                 {"criteria", "Convergence criteria"},
+                {"criteria_list", "Convergence criteria of each level."},
                 {"estimation_method",
                  "Estimation method. One of "
                  "(``"
@@ -543,40 +621,158 @@ static const std::unordered_map<std::string, std::string>
                  "``"
                  "TransformationEstimationForColoredICP``)"},
                 {"init", "Initial transformation estimation"},
+                {"inits",
+                 "o3d.utility.Matrix4dVector of initial transformation "
+                 "estimations."},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"kernel", "Robust Kernel used in the Optimization"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
+                {"max_correspondence_distances",
+                 "Maximum correspondence points-pair distance of each "
+                 "level."},
                 {"mutual_filter",
                  "Enables mutual filter such that the correspondence of the "
                  "source point's correspondence is itself."},
+                {"matching_option",
+                 "Options for the nearest neighbor search that matches the "
+                 "features."},
                 {"option", "Registration option"},
                 {"ransac_n", "Fit ransac with ``ransac_n`` correspondences"},
                 {"source_feature", "Source point cloud feature."},
                 {"source", "The source point cloud."},
+                {"sources", "List of source point clouds."},
                 {"target_feature", "Target point cloud feature."},
                 {"target", "The target point cloud."},
                 {"transformation",
                  "The 4x4 transformation matrix to transform ``source`` to "
-                 "``target``"}};
+                 "``target``"},
+                {"voxel_sizes",
+                 "Voxel size of each level, typically decreasing. A level "
+                 "with a voxel size <= 0 runs on the input point clouds."}};
 
 void pybind_registration_methods(py::module &m) {
-    m.def("evaluate_registration", &EvaluateRegistration,
+    m.def("evaluate_registration",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &, double,
+                            const Eigen::Matrix4d &>(&EvaluateRegistration),
           "Function for evaluating registration between point clouds",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "transformation"_a = Eigen::Matrix4d::Identity());
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
-
-    m.def("registration_icp", &RegistrationICP, "Function for ICP registration",
+    // Overloads taking a prebuilt target are added after the docstring
+    // injection, which does not parse overloaded functions. They release the
+    // GIL so that Python threads can share one target.
+    m.def("evaluate_registration",
+          py::overload_cast<const geometry::PointCloud &,
+                            const RegistrationTarget &, double,
+                            const Eigen::Matrix4d &>(&EvaluateRegistration),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for evaluating registration between point clouds, with "
+          "a prebuilt target KD-tree",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "transformation"_a = Eigen::Matrix4d::Identity());
+
+    m.def("registration_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &, double,
+                            const Eigen::Matrix4d &,
+                            const TransformationEstimation &,
+                            const ICPConvergenceCriteria &>(&RegistrationICP),
+          "Function for ICP registration", "source"_a, "target"_a,
+          "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "estimation_method"_a = TransformationEstimationPointToPoint(false),
           "criteria"_a = ICPConvergenceCriteria());
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
+    m.def("registration_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const RegistrationTarget &, double,
+                            const Eigen::Matrix4d &,
+                            const TransformationEstimation &,
+                            const ICPConvergenceCriteria &>(&RegistrationICP),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration, with a prebuilt target KD-tree",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a = TransformationEstimationPointToPoint(false),
+          "criteria"_a = ICPConvergenceCriteria());
+
+    m.def("registration_icp_batch",
+          py::overload_cast<
+                  const geometry::PointCloud &, const RegistrationTarget &,
+                  double,
+                  const std::vector<Eigen::Matrix4d,
+                                    utility::Matrix4d_allocator> &,
+                  const TransformationEstimation &,
+                  const ICPConvergenceCriteria &>(&RegistrationICPBatch),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration of one source from many initial "
+          "transformations, in parallel with a shared target KD-tree",
+          "source"_a, "target"_a, "max_correspondence_distance"_a, "inits"_a,
+          "estimation_method"_a = TransformationEstimationPointToPoint(false),
+          "criteria"_a = ICPConvergenceCriteria());
+    docstring::FunctionDocInject(m, "registration_icp_batch",
+                                 map_shared_argument_docstrings);
+    m.def(
+            "registration_icp_batch",
+            [](const std::vector<std::shared_ptr<geometry::PointCloud>>
+                       &sources,
+               const RegistrationTarget &target,
+               double max_correspondence_distance,
+               const std::vector<Eigen::Matrix4d,
+                                 utility::Matrix4d_allocator> &inits,
+               const TransformationEstimation &estimation_method,
+               const ICPConvergenceCriteria &criteria) {
+                std::vector<std::shared_ptr<const geometry::PointCloud>>
+                        const_sources(sources.begin(), sources.end());
+                py::gil_scoped_release release;
+                return RegistrationICPBatch(const_sources, target,
+                                            max_correspondence_distance, inits,
+                                            estimation_method, criteria);
+            },
+            "Function for ICP registration of many sources against one "
+            "target, in parallel with a shared target KD-tree",
+            "sources"_a, "target"_a, "max_correspondence_distance"_a,
+            "inits"_a,
+            "estimation_method"_a = TransformationEstimationPointToPoint(false),
+            "criteria"_a = ICPConvergenceCriteria());
+
+    m.def(
+            "registration_multi_scale_icp",
+            [](const geometry::PointCloud &source,
+               const geometry::PointCloud &target,
+               const std::vector<double> &voxel_sizes,
+               const std::vector<ICPConvergenceCriteria> &criteria_list,
+               const std::vector<double> &max_correspondence_distances,
+               const Eigen::Matrix4d &init,
+               const TransformationEstimation &estimation_method) {
+                std::vector<ICPLevelStatistics> level_statistics;
+                RegistrationResult result = RegistrationMultiScaleICP(
+                        source, target, voxel_sizes, criteria_list,
+                        max_correspondence_distances, init, estimation_method,
+                        &level_statistics);
+                return std::make_tuple(result, level_statistics);
+            },
+            "Function for coarse-to-fine ICP registration. Returns the "
+            "registration result and the statistics of each level.",
+            "source"_a, "target"_a, "voxel_sizes"_a, "criteria_list"_a,
+            "max_correspondence_distances"_a,
+            "init"_a = Eigen::Matrix4d::Identity(),
+            "estimation_method"_a =
+                    TransformationEstimationPointToPoint(false));
+    docstring::FunctionDocInject(m, "registration_multi_scale_icp",
+                                 map_shared_argument_docstrings);
 
-    m.def("registration_colored_icp", &RegistrationColoredICP,
+    m.def("registration_colored_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &, double,
+                            const Eigen::Matrix4d &,
+                            const TransformationEstimationForColoredICP &,
+                            const ICPConvergenceCriteria &>(
+                  &RegistrationColoredICP),
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -584,6 +780,20 @@ void pybind_registration_methods(py::module &m) {
           "criteria"_a = ICPConvergenceCriteria());
     docstring::FunctionDocInject(m, "registration_colored_icp",
                                  map_shared_argument_docstrings);
+    m.def("registration_colored_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const ColoredICPTarget &, double,
+                            const Eigen::Matrix4d &,
+                            const TransformationEstimationForColoredICP &,
+                            const ICPConvergenceCriteria &>(
+                  &RegistrationColoredICP),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Colored ICP registration, with a prebuilt target "
+          "KD-tree and color gradients",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a = TransformationEstimationForColoredICP(),
+          "criteria"_a = ICPConvergenceCriteria());
 
     m.def("registration_ransac_based_on_correspondence",
           &RegistrationRANSACBasedOnCorrespondence,
@@ -608,7 +818,8 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 3,
           "checkers"_a = std::vector<
                   std::reference_wrapper<const CorrespondenceChecker>>(),
-          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999));
+          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
+          "matching_option"_a = FeatureMatchingOption());
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
@@ -635,10 +846,12 @@ void pybind_registration_methods(py::module &m) {
 void pybind_registration(py::module &m) {
     py::module m_submodule =
             m.def_submodule("registration", "Registration pipeline.");
+    // Feature and FeatureMatchingOption are used as default arguments of the
+    // registration bindings, so they are registered first.
+    pybind_feature(m_submodule);
     pybind_registration_classes(m_submodule);
     pybind_registration_methods(m_submodule);
 
-    pybind_feature(m_submodule);
     pybind_feature_methods(m_submodule);
     pybind_global_optimization(m_submodule);
     pybind_global_optimization_methods(m_submodule);
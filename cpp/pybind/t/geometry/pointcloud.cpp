@@ -86,6 +86,15 @@ void pybind_pointcloud(py::module& m) {
                    "Scale points.");
     pointcloud.def("rotate", &PointCloud::Rotate, "R"_a, "center"_a,
                    "Rotate points and normals (if exist).");
+    pointcloud.def("voxel_down_sample", &PointCloud::VoxelDownSample,
+                   "voxel_size"_a, "mode"_a = VoxelDownSampleMode::Mean,
+                   "Downsamples the point cloud with a voxel grid, reducing "
+                   "every attribute with mode.");
+    pointcloud.def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                   py::call_guard<py::gil_scoped_release>(), "eps"_a,
+                   "min_points"_a,
+                   "Cluster points with DBSCAN. Returns an Int32 tensor of "
+                   "point labels, -1 indicates noise.");
     pointcloud.def_static(
             "create_from_depth_image", &PointCloud::CreateFromDepthImage,
             "depth"_a, "intrinsics"_a,
@@ -67,6 +67,10 @@ void pybind_tsdf_voxelgrid(py::module& m) {
                        &TSDFVoxelGrid::ExtractSurfacePoints);
     tsdf_voxelgrid.def("extract_surface_mesh",
                        &TSDFVoxelGrid::ExtractSurfaceMesh);
+    tsdf_voxelgrid.def("ray_cast", &TSDFVoxelGrid::RayCast, "intrinsics"_a,
+                       "extrinsics"_a, "width"_a, "height"_a,
+                       "depth_scale"_a = 1000.0f, "depth_min"_a = 0.1f,
+                       "depth_max"_a = 3.0f, "weight_threshold"_a = 3.0f);
 
     tsdf_voxelgrid.def("to", &TSDFVoxelGrid::To, "device"_a, "copy"_a = false);
     tsdf_voxelgrid.def("clone", &TSDFVoxelGrid::Clone);
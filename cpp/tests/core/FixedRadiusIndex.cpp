@@ -26,6 +26,7 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -34,12 +35,19 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+#include "tests/test_utility/Rand.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(FixedRadiusIndex, SearchRadius) {
-    core::Device device = core::Device("CUDA:0");
+class FixedRadiusIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FixedRadiusIndex,
+                         FixedRadiusIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadius) {
+    core::Device device = GetParam();
     std::vector<int> ref_indices = {1, 4};
     std::vector<float> ref_distance = {0.00626358, 0.00747938};
 
@@ -68,5 +76,59 @@ TEST(FixedRadiusIndex, SearchRadius) {
              std::vector<float>({0.00626358, 0.00747938}));
 }
 
+TEST(FixedRadiusIndex, SearchRadiusCPU) {
+    // Random points compared to a brute force search.
+    const int64_t num_points = 2000;
+    const int64_t num_queries = 300;
+    const double radius = 0.15;
+    std::vector<double> points_vec(num_points * 3);
+    std::vector<double> queries_vec(num_queries * 3);
+    Rand(points_vec.data(), points_vec.size(), 0.0, 1.0, 0);
+    Rand(queries_vec.data(), queries_vec.size(), -0.1, 1.1, 1);
+    core::Tensor points(points_vec, {num_points, 3}, core::Dtype::Float64);
+    core::Tensor queries(queries_vec, {num_queries, 3}, core::Dtype::Float64);
+
+    core::nns::FixedRadiusIndex index(points, radius);
+    for (double search_radius : {radius, radius / 3}) {
+        core::Tensor indices, distances, num_neighbors;
+        std::tie(indices, distances, num_neighbors) =
+                index.SearchRadius(queries, search_radius);
+        std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+        std::vector<double> distances_vec = distances.ToFlatVector<double>();
+        std::vector<int64_t> num_neighbors_vec =
+                num_neighbors.ToFlatVector<int64_t>();
+
+        int64_t offset = 0;
+        for (int64_t q = 0; q < num_queries; ++q) {
+            std::vector<std::pair<double, int64_t>> ref_neighbors;
+            for (int64_t i = 0; i < num_points; ++i) {
+                double dist = 0;
+                for (int d = 0; d < 3; ++d) {
+                    double diff =
+                            points_vec[i * 3 + d] - queries_vec[q * 3 + d];
+                    dist += diff * diff;
+                }
+                if (dist <= search_radius * search_radius) {
+                    ref_neighbors.emplace_back(dist, i);
+                }
+            }
+            std::sort(ref_neighbors.begin(), ref_neighbors.end());
+            ASSERT_EQ(num_neighbors_vec[q],
+                      static_cast<int64_t>(ref_neighbors.size()));
+            for (const auto& neighbor : ref_neighbors) {
+                EXPECT_EQ(indices_vec[offset], neighbor.second);
+                EXPECT_DOUBLE_EQ(distances_vec[offset], neighbor.first);
+                ++offset;
+            }
+        }
+        EXPECT_EQ(offset, indices.GetLength());
+    }
+
+    EXPECT_ANY_THROW(index.SearchRadius(queries, radius * 2));
+    EXPECT_ANY_THROW(index.SearchRadius(queries.To(core::Dtype::Float32),
+                                        radius));
+    EXPECT_ANY_THROW(core::nns::FixedRadiusIndex(points, 0));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #include "open3d/core/hashmap/Hashmap.h"
 
 #include <random>
+#include <thread>
 #include <unordered_map>
 
 #include "open3d/core/Device.h"
@@ -321,5 +322,291 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
     }
 }
 
+TEST_P(HashmapPermuteDevices, MultiValued) {
+    core::Device device = GetParam();
+    const int n = 100000;
+    const int slots = 1023;
+    int init_capacity = 64;
+
+    // Key -> (float value, uint8<3> color), stored in separate buffers.
+    core::Hashmap hashmap(init_capacity, core::Dtype::Int32, {1},
+                          {core::Dtype::Float32, core::Dtype::UInt8},
+                          {{1}, {3}}, device);
+    EXPECT_EQ(hashmap.GetValueBufferCount(), 2);
+    EXPECT_EQ(hashmap.GetValueBytesizes(), std::vector<int64_t>({4, 3}));
+
+    HashData<int, int> data(n, slots);
+    std::vector<float> vals_float(data.vals_.begin(), data.vals_.end());
+    std::vector<uint8_t> vals_color;
+    for (int v : data.vals_) {
+        for (int c = 0; c < 3; ++c) {
+            vals_color.push_back(static_cast<uint8_t>((v + c) % 256));
+        }
+    }
+    core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+    core::Tensor values_float(vals_float, {n, 1}, core::Dtype::Float32,
+                              device);
+    core::Tensor values_color(vals_color, {n, 3}, core::Dtype::UInt8, device);
+
+    // Insertion triggers rehashing, which must carry every buffer.
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, {values_float, values_color}, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), slots);
+    EXPECT_THROW(hashmap.Insert(keys, values_float, addrs, masks),
+                 std::runtime_error);
+
+    hashmap.Find(keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    std::vector<core::Tensor> ai({addrs.To(core::Dtype::Int64)});
+    EXPECT_TRUE(hashmap.GetValueTensor(0).IndexGet(ai).AllClose(values_float));
+    EXPECT_TRUE(hashmap.GetValueTensor(1).IndexGet(ai).AllClose(values_color));
+
+    // Activated entries are writable per buffer through the addresses.
+    core::Tensor new_keys(std::vector<int>{-1}, {1}, core::Dtype::Int32,
+                          device);
+    hashmap.Activate(new_keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    std::vector<core::Tensor> new_ai({addrs.To(core::Dtype::Int64)});
+    hashmap.GetValueTensor(1).IndexSet(
+            new_ai, core::Tensor::Ones({1, 3}, core::Dtype::UInt8, device));
+    EXPECT_TRUE(hashmap.GetValueTensor(1).IndexGet(new_ai).AllClose(
+            core::Tensor::Ones({1, 3}, core::Dtype::UInt8, device)));
+
+    core::Hashmap cloned = hashmap.Clone();
+    EXPECT_EQ(cloned.Size(), slots + 1);
+    cloned.Find(keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    ai = {addrs.To(core::Dtype::Int64)};
+    EXPECT_TRUE(cloned.GetValueTensor(1).IndexGet(ai).AllClose(values_color));
+}
+
+TEST_P(HashmapPermuteDevices, NamedValues) {
+    core::Device device = GetParam();
+    const int n = 1000;
+
+    core::Hashmap hashmap(n, core::Dtype::Int32, {1},
+                          {core::Dtype::Float32, core::Dtype::UInt8},
+                          {{1}, {3}}, {"tsdf", "color"}, device);
+    EXPECT_EQ(hashmap.GetValueNames(),
+              std::vector<std::string>({"tsdf", "color"}));
+    EXPECT_EQ(hashmap.GetValueBufferIndex("color"), size_t(1));
+    EXPECT_THROW(hashmap.GetValueBufferIndex("weight"), std::runtime_error);
+
+    std::vector<int> keys_val(n);
+    std::iota(keys_val.begin(), keys_val.end(), 0);
+    core::Tensor keys(keys_val, {n}, core::Dtype::Int32, device);
+    core::Tensor tsdf = keys.To(core::Dtype::Float32).View({n, 1});
+    core::Tensor color = core::Tensor::Ones({n, 3}, core::Dtype::UInt8, device);
+
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, {tsdf, color}, addrs, masks);
+    EXPECT_TRUE(masks.All());
+
+    // Named and indexed accessors refer to the same buffers.
+    std::vector<core::Tensor> ai({addrs.To(core::Dtype::Int64)});
+    EXPECT_TRUE(hashmap.GetValueTensor("tsdf").IndexGet(ai).AllClose(tsdf));
+    EXPECT_TRUE(hashmap.GetValueTensor("color").IndexGet(ai).AllClose(color));
+    EXPECT_EQ(hashmap.GetValueBuffer("color").GetDataPtr(),
+              hashmap.GetValueBuffer(1).GetDataPtr());
+
+    // Names are kept by copies.
+    core::Hashmap cloned = hashmap.Clone();
+    EXPECT_EQ(cloned.GetValueNames(), hashmap.GetValueNames());
+    cloned.Find(keys, addrs, masks);
+    ai = {addrs.To(core::Dtype::Int64)};
+    EXPECT_TRUE(cloned.GetValueTensor("tsdf").IndexGet(ai).AllClose(tsdf));
+
+    // Names must match the buffers.
+    EXPECT_THROW(core::Hashmap(n, core::Dtype::Int32, {1},
+                               {core::Dtype::Float32, core::Dtype::UInt8},
+                               {{1}, {3}}, {"tsdf", "tsdf"}, device),
+                 std::runtime_error);
+}
+
+TEST(Hashmap, CPUGrowthKeepsAddresses) {
+    core::Device device("CPU:0");
+    for (auto backend : {core::HashmapBackend::TBB,
+                         core::HashmapBackend::OpenAddressing}) {
+        const int n = 1000;
+        core::Hashmap hashmap(n, core::Dtype::Int32, core::Dtype::Int32, {1},
+                              {1}, device, backend);
+
+        std::vector<int> keys_val(n), values_val(n);
+        std::iota(keys_val.begin(), keys_val.end(), 0);
+        std::iota(values_val.begin(), values_val.end(), 0);
+        core::Tensor keys(keys_val, {n}, core::Dtype::Int32, device);
+        core::Tensor values(values_val, {n}, core::Dtype::Int32, device);
+
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        EXPECT_TRUE(masks.All());
+
+        // Erase a few keys, so that the free list is not trivially ordered.
+        core::Tensor erase_keys(std::vector<int>{3, 500, 999}, {3},
+                                core::Dtype::Int32, device);
+        core::Tensor erase_masks;
+        hashmap.Erase(erase_keys, erase_masks);
+        EXPECT_TRUE(erase_masks.All());
+
+        core::Tensor active_addrs;
+        hashmap.GetActiveIndices(active_addrs);
+        EXPECT_EQ(active_addrs.GetShape()[0], n - 3);
+
+        // Inserting beyond capacity grows the buffer.
+        std::vector<int> more_keys_val(4 * n);
+        std::iota(more_keys_val.begin(), more_keys_val.end(), n);
+        core::Tensor more_keys(more_keys_val, {4 * n}, core::Dtype::Int32,
+                               device);
+        core::Tensor more_addrs, more_masks;
+        hashmap.Activate(more_keys, more_addrs, more_masks);
+        EXPECT_TRUE(more_masks.All());
+        EXPECT_GE(hashmap.GetCapacity(), 5 * n - 3);
+        EXPECT_EQ(hashmap.Size(), 5 * n - 3);
+
+        // Old entries are found at their original addresses with values.
+        core::Tensor found_addrs, found_masks;
+        hashmap.Find(keys, found_addrs, found_masks);
+        std::vector<int> addrs_vec = addrs.ToFlatVector<int>();
+        std::vector<int> found_addrs_vec = found_addrs.ToFlatVector<int>();
+        std::vector<bool> found_masks_vec = found_masks.ToFlatVector<bool>();
+        for (int i = 0; i < n; ++i) {
+            bool erased = (i == 3 || i == 500 || i == 999);
+            EXPECT_EQ(found_masks_vec[i], !erased);
+            if (!erased) {
+                EXPECT_EQ(found_addrs_vec[i], addrs_vec[i]);
+            }
+        }
+        core::Tensor found_values = hashmap.GetValueTensor().IndexGet(
+                {found_addrs.IndexGet({found_masks}).To(core::Dtype::Int64)});
+        EXPECT_TRUE(found_values.View({n - 3}).AllClose(
+                keys.IndexGet({found_masks})));
+
+        hashmap.GetActiveIndices(active_addrs);
+        EXPECT_EQ(active_addrs.GetShape()[0], 5 * n - 3);
+    }
+}
+
+TEST(Hashmap, CPUConcurrentGetActiveIndices) {
+    core::Device device("CPU:0");
+    for (auto backend : {core::HashmapBackend::TBB,
+                         core::HashmapBackend::OpenAddressing}) {
+        const int n = 10000;
+        core::Hashmap hashmap(n, core::Dtype::Int32, core::Dtype::Int32, {1},
+                              {1}, device, backend);
+        std::vector<int> keys_val(n);
+        std::iota(keys_val.begin(), keys_val.end(), 0);
+        core::Tensor keys(keys_val, {n}, core::Dtype::Int32, device);
+        core::Tensor addrs, masks;
+        hashmap.Activate(keys, addrs, masks);
+
+        core::Tensor expected;
+        hashmap.GetActiveIndices(expected);
+
+        // Enumeration only reads the hashmap, so concurrent calls agree.
+        std::vector<core::Tensor> results(4);
+        std::vector<std::thread> threads;
+        for (auto &result : results) {
+            threads.emplace_back([&hashmap, &result]() {
+                hashmap.GetActiveIndices(result);
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        for (const auto &result : results) {
+            EXPECT_TRUE(result.AllClose(expected));
+        }
+    }
+}
+
+TEST(Hashmap, OpenAddressingInsertFindErase) {
+    core::Device device("CPU:0");
+    const int n = 100000;
+    const int slots = 1023;
+
+    // Small initial capacity to trigger growth during insertion.
+    core::Hashmap hashmap(10, core::Dtype::Int32, core::Dtype::Int32, {1}, {1},
+                          device, core::HashmapBackend::OpenAddressing);
+    EXPECT_EQ(hashmap.GetBackend(), core::HashmapBackend::OpenAddressing);
+
+    HashData<int, int> data(n, slots);
+    core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), slots);
+    EXPECT_EQ(hashmap.Size(), slots);
+    EXPECT_LE(hashmap.LoadFactor(), 0.5);
+
+    hashmap.Find(keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    core::Tensor indices = addrs.To(core::Dtype::Int64);
+    EXPECT_TRUE(hashmap.GetKeyTensor().IndexGet({indices}).AllClose(
+            hashmap.GetValueTensor().IndexGet({indices}) * data.k_factor_));
+
+    // Erase half of the keys, duplicates in the batch must only succeed once.
+    HashData<int, int> data_erase(n, slots / 2);
+    core::Tensor keys_erase(data_erase.keys_, {n}, core::Dtype::Int32, device);
+    core::Tensor masks_erase;
+    hashmap.Erase(keys_erase, masks_erase);
+    EXPECT_EQ(masks_erase.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+              slots / 2);
+    EXPECT_EQ(hashmap.Size(), slots - slots / 2);
+
+    hashmap.Find(keys_erase, addrs, masks);
+    EXPECT_FALSE(masks.Any());
+
+    // Re-insert erased keys over tombstones.
+    hashmap.Insert(keys, values, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+              slots / 2);
+    EXPECT_EQ(hashmap.Size(), slots);
+
+    core::Tensor active_addrs;
+    hashmap.GetActiveIndices(active_addrs);
+    EXPECT_EQ(active_addrs.GetShape()[0], slots);
+    std::vector<int> active_values_vec =
+            hashmap.GetValueTensor()
+                    .IndexGet({active_addrs.To(core::Dtype::Int64)})
+                    .ToFlatVector<int>();
+    std::sort(active_values_vec.begin(), active_values_vec.end());
+    for (int i = 0; i < slots; ++i) {
+        EXPECT_EQ(active_values_vec[i], i);
+    }
+
+    // Clone keeps the backend and the content.
+    core::Hashmap cloned = hashmap.Clone();
+    EXPECT_EQ(cloned.GetBackend(), core::HashmapBackend::OpenAddressing);
+    EXPECT_EQ(cloned.Size(), slots);
+}
+
+TEST(Hashmap, OpenAddressingComplexKeys) {
+    core::Device device("CPU:0");
+    const int n = 100000;
+    const int slots = 1023;
+    core::Hashmap hashmap(n, core::Dtype::Int32, core::Dtype::Int32, {3}, {1},
+                          device, core::HashmapBackend::OpenAddressing);
+
+    HashData<int3, int> data(n, slots);
+    std::vector<int> keys_int3;
+    keys_int3.assign(reinterpret_cast<int *>(data.keys_.data()),
+                     reinterpret_cast<int *>(data.keys_.data()) + 3 * n);
+    core::Tensor keys(keys_int3, {n, 3}, core::Dtype::Int32, device);
+
+    core::Tensor addrs, masks;
+    hashmap.Activate(keys, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), slots);
+
+    hashmap.Rehash(hashmap.GetBucketCount() * 2);
+    EXPECT_EQ(hashmap.Size(), slots);
+
+    hashmap.Find(keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    core::Tensor found_keys =
+            hashmap.GetKeyTensor().IndexGet({addrs.To(core::Dtype::Int64)});
+    EXPECT_TRUE(found_keys.AllClose(keys));
+}
+
 }  // namespace tests
 }  // namespace open3d
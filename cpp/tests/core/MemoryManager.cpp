@@ -26,6 +26,8 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <cstdint>
+#include <cstring>
 #include <vector>
 
 #include "open3d/core/Blob.h"
@@ -78,5 +80,54 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST(MemoryManager, CPUCachedMallocFree) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager mm;
+    core::CPUCachedMemoryManager::ReleaseCache();
+    core::CPUCachedMemoryManager::ResetStatistics();
+
+    // Returned memory is 64-byte aligned and writable.
+    void* ptr = mm.Malloc(1000, device);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0u);
+    std::memset(ptr, 0xff, 1000);
+    mm.Free(ptr, device);
+    EXPECT_EQ(core::CPUCachedMemoryManager::GetStatistics().num_misses_, 1);
+    EXPECT_GT(core::CPUCachedMemoryManager::GetStatistics().cached_bytes_, 0u);
+
+    // Same size class is served from the cache.
+    void* ptr2 = mm.Malloc(990, device);
+    EXPECT_EQ(ptr2, ptr);
+    EXPECT_EQ(core::CPUCachedMemoryManager::GetStatistics().num_hits_, 1);
+    mm.Free(ptr2, device);
+
+    // Large blocks go through the shared pool.
+    void* large = mm.Malloc(8 << 20, device);
+    mm.Free(large, device);
+    void* large2 = mm.Malloc((8 << 20) - 100, device);
+    EXPECT_EQ(large2, large);
+    mm.Free(large2, device);
+
+    core::CPUCachedMemoryManager::ReleaseCache();
+    EXPECT_EQ(core::CPUCachedMemoryManager::GetStatistics().cached_bytes_, 0u);
+    EXPECT_EQ(core::CPUCachedMemoryManager::GetStatistics().allocated_bytes_,
+              0u);
+
+    EXPECT_EQ(mm.Malloc(0, device), nullptr);
+}
+
+TEST(MemoryManager, CPUCachedMaxCacheSize) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager mm;
+    size_t max_cache_size = core::CPUCachedMemoryManager::GetMaxCacheSize();
+
+    core::CPUCachedMemoryManager::SetMaxCacheSize(0);
+    void* ptr = mm.Malloc(100, device);
+    mm.Free(ptr, device);
+    EXPECT_EQ(core::CPUCachedMemoryManager::GetStatistics().cached_bytes_, 0u);
+
+    core::CPUCachedMemoryManager::SetMaxCacheSize(max_cache_size);
+    EXPECT_EQ(core::CPUCachedMemoryManager::GetMaxCacheSize(), max_cache_size);
+}
+
 }  // namespace tests
 }  // namespace open3d
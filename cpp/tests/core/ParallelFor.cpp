@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/ParallelFor.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ParallelFor, CoversRangeOnce) {
+    const int64_t n = 1000003;
+    std::vector<std::atomic<int>> counts(n);
+    for (auto& count : counts) {
+        count = 0;
+    }
+    core::kernel::ParallelFor(n, 1000, [&](int64_t start, int64_t end) {
+        EXPECT_GE(end - start, 1000);
+        for (int64_t i = start; i < end; ++i) {
+            counts[i]++;
+        }
+    });
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(counts[i], 1);
+    }
+}
+
+TEST(ParallelFor, SerialCutoff) {
+    int num_calls = 0;
+    std::thread::id caller = std::this_thread::get_id();
+    core::kernel::ParallelFor(100, 1000, [&](int64_t start, int64_t end) {
+        EXPECT_EQ(start, 0);
+        EXPECT_EQ(end, 100);
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        num_calls++;
+    });
+    EXPECT_EQ(num_calls, 1);
+
+    core::kernel::ParallelFor(0, 1000,
+                              [&](int64_t start, int64_t end) { num_calls++; });
+    EXPECT_EQ(num_calls, 1);
+}
+
+TEST(ParallelFor, NestedCallsRunSerially) {
+    EXPECT_FALSE(core::kernel::InParallelRegion());
+    std::atomic<int> num_nested_calls(0);
+    core::kernel::ParallelFor(100, 1, [&](int64_t start, int64_t end) {
+        EXPECT_TRUE(core::kernel::InParallelRegion());
+        std::thread::id caller = std::this_thread::get_id();
+        core::kernel::ParallelFor(
+                100000, 1, [&](int64_t nested_start, int64_t nested_end) {
+                    EXPECT_EQ(nested_start, 0);
+                    EXPECT_EQ(nested_end, 100000);
+                    EXPECT_EQ(std::this_thread::get_id(), caller);
+                    num_nested_calls++;
+                });
+    });
+    EXPECT_GE(num_nested_calls.load(), 1);
+    EXPECT_FALSE(core::kernel::InParallelRegion());
+}
+
+TEST(ParallelFor, NumThreads) {
+    core::kernel::SetParallelForNumThreads(1);
+    EXPECT_EQ(core::kernel::GetParallelForNumThreads(), 1);
+    core::Tensor t = core::Tensor::Ones({100000, 2}, core::Dtype::Float32,
+                                        core::Device("CPU:0"));
+    EXPECT_EQ(t.Sum({0, 1}).Item<float>(), 200000.f);
+
+    core::kernel::SetParallelForNumThreads(0);
+    EXPECT_GE(core::kernel::GetParallelForNumThreads(), 1);
+    EXPECT_THROW(core::kernel::SetParallelForNumThreads(-1),
+                 std::runtime_error);
+}
+
+TEST(ParallelFor, ExternalThreadPool) {
+    // A "pool" that runs all ranges serially on the calling thread.
+    std::atomic<int64_t> num_ranges(0);
+    core::kernel::SetParallelForFunction(
+            [&](int64_t num_workloads, int64_t grain_size,
+                const std::function<void(int64_t, int64_t)>& range_func) {
+                for (int64_t start = 0; start < num_workloads;
+                     start += grain_size) {
+                    range_func(start,
+                               std::min(start + grain_size, num_workloads));
+                    num_ranges++;
+                }
+            },
+            4);
+    EXPECT_EQ(core::kernel::GetParallelForNumThreads(), 4);
+
+    const int64_t n = 1000000;
+    std::vector<int> values(n, 0);
+    core::kernel::ParallelFor(n, 1000, [&](int64_t start, int64_t end) {
+        for (int64_t i = start; i < end; ++i) {
+            values[i] = 1;
+        }
+    });
+    EXPECT_EQ(num_ranges.load(), 1000);
+    EXPECT_EQ(std::vector<int>(n, 1), values);
+
+    // Tensor kernels go through the external pool as well.
+    num_ranges = 0;
+    core::Tensor a = core::Tensor::Ones({n}, core::Dtype::Float32,
+                                        core::Device("CPU:0"));
+    core::Tensor b = a + a;
+    EXPECT_GT(num_ranges.load(), 0);
+    EXPECT_EQ(b.Sum({0}).Item<float>(), 2.f * n);
+
+    core::kernel::SetParallelForFunction(nullptr, 0);
+    EXPECT_THROW(core::kernel::SetParallelForFunction(
+                         [](int64_t, int64_t,
+                            const std::function<void(int64_t, int64_t)>&) {},
+                         0),
+                 std::runtime_error);
+}
+
+}  // namespace tests
+}  // namespace open3d
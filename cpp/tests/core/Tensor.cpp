@@ -26,13 +26,17 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/NumpyIO.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/CPUVectorization.h"
 #include "open3d/core/kernel/Kernel.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -2793,5 +2797,387 @@ TEST_P(TensorPermuteDevices, NumpyIO) {
     utility::filesystem::RemoveFile(file_name);
 }
 
+TEST_P(TensorPermuteDevices, NumpyIOMmap) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Init<double>({{1, 2, 3}, {4, 5, 6}}, device);
+    t.Save(file_name);
+
+    core::Tensor t_load = core::Tensor::LoadMmap(file_name);
+    EXPECT_EQ(t_load.GetDevice(), core::Device("CPU:0"));
+    EXPECT_TRUE(t_load.IsContiguous());
+    EXPECT_TRUE(t.AllClose(t_load.To(device)));
+
+    // Copy-on-write changes are not written back to the file.
+    core::Tensor t_cow = core::Tensor::LoadMmap(file_name, true);
+    t_cow.Fill(0);
+    EXPECT_TRUE(t_cow.AllClose(core::Tensor::Zeros({2, 3}, t.GetDtype())));
+    EXPECT_TRUE(t_load.AllClose(t.To(core::Device("CPU:0"))));
+    EXPECT_TRUE(core::Tensor::Load(file_name).AllClose(t_load));
+
+    // The mapping outlives the file name.
+    utility::filesystem::RemoveFile(file_name);
+    EXPECT_TRUE(t.AllClose(t_load.To(device)));
+
+    // {0} tensor.
+    t = core::Tensor::Ones({0}, core::Dtype::Int32, device);
+    t.Save(file_name);
+    EXPECT_TRUE(t.AllClose(core::Tensor::LoadMmap(file_name).To(device)));
+    utility::filesystem::RemoveFile(file_name);
+
+    EXPECT_ANY_THROW(core::Tensor::LoadMmap("does_not_exist.npy"));
+}
+
+TEST_P(TensorPermuteDevices, NumpyIONpz) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "tensors.npz";
+
+    std::unordered_map<std::string, core::Tensor> tensor_map = {
+            {"points", core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}},
+                                                 device)},
+            {"labels", core::Tensor::Init<int64_t>({7, 8, 9}, device)},
+            {"mask", core::Tensor::Init<bool>({true, false}, device)},
+            {"scalar", core::Tensor::Init<uint8_t>(42, device)},
+            {"empty", core::Tensor({0, 3}, core::Dtype::Float64, device)}};
+    core::WriteNpz(file_name, tensor_map);
+
+    for (bool mmap : {false, true}) {
+        std::unordered_map<std::string, core::Tensor> tensor_map_load =
+                mmap ? core::ReadNpzMmap(file_name)
+                     : core::ReadNpz(file_name);
+        EXPECT_EQ(tensor_map_load.size(), tensor_map.size());
+        for (const auto &kv : tensor_map) {
+            const core::Tensor &t_load = tensor_map_load.at(kv.first);
+            EXPECT_EQ(t_load.GetDtype(), kv.second.GetDtype());
+            EXPECT_EQ(t_load.GetShape(), kv.second.GetShape());
+            EXPECT_TRUE(t_load.To(device).AllClose(kv.second));
+            // Arrays written by WriteNpz are mapped without copies.
+            if (mmap) {
+                EXPECT_EQ(reinterpret_cast<uintptr_t>(t_load.GetDataPtr()) %
+                                  t_load.GetDtype().ByteSize(),
+                          0u);
+            }
+        }
+    }
+    utility::filesystem::RemoveFile(file_name);
+
+    // Compressed archive, as written by numpy.savez_compressed().
+    tensor_map = core::ReadNpz(std::string(TEST_DATA_DIR) +
+                               "/tensors_compressed.npz");
+    EXPECT_EQ(tensor_map.size(), 2);
+    EXPECT_TRUE(tensor_map.at("a").AllClose(
+            core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}})));
+    EXPECT_TRUE(tensor_map.at("b").AllClose(
+            core::Tensor::Init<int64_t>({1, -2, 3, -4})));
+
+    EXPECT_ANY_THROW(core::ReadNpz(std::string(TEST_DATA_DIR) + "/knot.ply"));
+}
+
+TEST(Tensor, VectorizedCPUKernels) {
+    core::Device device("CPU:0");
+    // Large enough to be split across threads, with an odd remainder.
+    const int64_t n = 100003;
+    std::vector<double> lhs_vals(n * 2);
+    std::vector<double> rhs_vals(n * 2);
+    for (int64_t i = 0; i < n * 2; ++i) {
+        lhs_vals[i] = static_cast<double>(i % 97) - 48;
+        rhs_vals[i] = static_cast<double>(i % 13) + 1;
+    }
+    core::Tensor lhs_base(lhs_vals, {n, 2}, core::Dtype::Float64, device);
+    core::Tensor rhs_base(rhs_vals, {n, 2}, core::Dtype::Float64, device);
+
+    const core::kernel::CPUInstructionSet supported_isa =
+            core::kernel::GetSupportedCPUInstructionSet();
+    for (core::kernel::CPUInstructionSet isa :
+         {core::kernel::CPUInstructionSet::Generic, supported_isa}) {
+        core::kernel::SetCPUInstructionSet(isa);
+        EXPECT_EQ(core::kernel::GetCPUInstructionSet(), isa);
+        for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64,
+                                  core::Dtype::Int32, core::Dtype::Int64}) {
+            // Strided views go through the Indexer, their contiguous copies
+            // through the vectorized fast paths.
+            core::Tensor lhs = lhs_base.To(dtype).Slice(1, 0, 1);
+            core::Tensor rhs = rhs_base.To(dtype).Slice(1, 1, 2);
+            core::Tensor lhs_c = lhs.Contiguous();
+            core::Tensor rhs_c = rhs.Contiguous();
+            EXPECT_FALSE(lhs.IsContiguous());
+
+            EXPECT_TRUE((lhs_c + rhs_c).AllClose(lhs + rhs));
+            EXPECT_TRUE((lhs_c - rhs_c).AllClose(lhs - rhs));
+            EXPECT_TRUE((lhs_c * rhs_c).AllClose(lhs * rhs));
+            EXPECT_TRUE((lhs_c / rhs_c).AllClose(lhs / rhs));
+            EXPECT_TRUE((lhs_c * 3).AllClose(lhs * 3));
+            EXPECT_TRUE((lhs_c - 3).AllClose(lhs - 3));
+            EXPECT_TRUE(lhs_c.Neg().AllClose(lhs.Neg()));
+            EXPECT_TRUE(lhs_c.Abs().AllClose(lhs.Abs()));
+            if (dtype == core::Dtype::Float32 ||
+                dtype == core::Dtype::Float64) {
+                EXPECT_TRUE(lhs_c.Abs().Sqrt().AllClose(lhs.Abs().Sqrt()));
+                EXPECT_TRUE((lhs_c / 7).Floor().AllClose((lhs / 7).Floor()));
+            }
+
+            EXPECT_TRUE(lhs_c.Sum({0}).AllClose(lhs.Sum({0})));
+            EXPECT_TRUE(lhs_c.Sum({0, 1}).AllClose(lhs.Sum({0, 1})));
+            EXPECT_TRUE(lhs_c.Sum({1}).AllClose(lhs.Sum({1})));
+            EXPECT_TRUE(lhs_c.Min({0}).AllClose(lhs.Min({0})));
+            EXPECT_TRUE(lhs_c.Max({0}).AllClose(lhs.Max({0})));
+            EXPECT_TRUE(rhs_c.Slice(0, 0, 10).Prod({0}).AllClose(
+                    rhs.Slice(0, 0, 10).Prod({0})));
+
+            // Few long rows, reduced in chunks.
+            core::Tensor rows = lhs_base.To(dtype).T();
+            core::Tensor rows_c = rows.Contiguous();
+            EXPECT_TRUE(rows_c.Sum({1}).AllClose(rows.Sum({1})));
+            EXPECT_TRUE(rows_c.Max({1}, true).AllClose(rows.Max({1}, true)));
+        }
+    }
+    core::kernel::SetCPUInstructionSet(supported_isa);
+}
+
+TEST_P(TensorPermuteDevices, ArgSortSort) {
+    core::Device device = GetParam();
+
+    core::Tensor t = core::Tensor::Init<float>(
+            {3.5f, -1.f, 0.f, -0.f, 2.f, -1.f, 100.f, -7.25f}, device);
+    EXPECT_EQ(t.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({7, 1, 5, 2, 3, 4, 0, 6}));
+    EXPECT_EQ(t.Sort().ToFlatVector<float>(),
+              std::vector<float>(
+                      {-7.25f, -1.f, -1.f, 0.f, 0.f, 2.f, 3.5f, 100.f}));
+
+    // Multiple radix passes and chunks, stable for equal keys.
+    const int64_t n = 100000;
+    std::vector<int64_t> vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = ((i * 7919) % 1009 - 500) * 1000003;
+    }
+    core::Tensor t_int64(vals, {n}, core::Dtype::Int64, device);
+    std::vector<int64_t> indices = t_int64.ArgSort().ToFlatVector<int64_t>();
+    std::vector<int64_t> indices_ref(n);
+    std::iota(indices_ref.begin(), indices_ref.end(), 0);
+    std::stable_sort(
+            indices_ref.begin(), indices_ref.end(),
+            [&](int64_t a, int64_t b) { return vals[a] < vals[b]; });
+    EXPECT_EQ(indices, indices_ref);
+
+    core::Tensor t_uint8 =
+            core::Tensor::Init<uint8_t>({{3, 255}, {0, 3}}, device);
+    EXPECT_EQ(t_uint8.Sort().ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({0, 3, 3, 255}));
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+
+    core::Tensor t =
+            core::Tensor::Init<int32_t>({{5, -2, 5}, {0, -2, 5}}, device);
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = t.Unique(true, true);
+    EXPECT_EQ(unique.ToFlatVector<int32_t>(), std::vector<int32_t>({-2, 0, 5}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 1, 0, 2}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 1, 3}));
+    EXPECT_TRUE(unique.IndexGet({inverse}).AllClose(t));
+
+    std::tie(unique, inverse, counts) = t.Unique();
+    EXPECT_EQ(unique.ToFlatVector<int32_t>(), std::vector<int32_t>({-2, 0, 5}));
+    EXPECT_EQ(inverse.NumElements(), 0);
+    EXPECT_EQ(counts.NumElements(), 0);
+
+    std::tie(unique, inverse, counts) =
+            core::Tensor::Init<bool>({true, false, true}, device)
+                    .Unique(false, true);
+    EXPECT_EQ(unique.ToFlatVector<bool>(), std::vector<bool>({false, true}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 2}));
+
+    std::tie(unique, inverse, counts) =
+            core::Tensor({0}, core::Dtype::Float32, device).Unique(true, true);
+    EXPECT_EQ(unique.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(counts.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, CumSum) {
+    core::Device device = GetParam();
+
+    core::Tensor t = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    EXPECT_EQ(t.CumSum(0).ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3, 5, 7, 9}));
+    EXPECT_EQ(t.CumSum(1).ToFlatVector<float>(),
+              std::vector<float>({1, 3, 6, 4, 9, 15}));
+    EXPECT_EQ(t.T().CumSum(-1).ToFlatVector<float>(),
+              std::vector<float>({1, 5, 2, 7, 3, 9}));
+
+    // Long 1-D scan.
+    const int64_t n = 200003;
+    core::Tensor ones = core::Tensor::Ones({n}, core::Dtype::Int64, device);
+    core::Tensor cumsum = ones.CumSum(0);
+    EXPECT_EQ(cumsum[0].Item<int64_t>(), 1);
+    EXPECT_EQ(cumsum[n - 1].Item<int64_t>(), n);
+    EXPECT_TRUE(cumsum.AllClose(
+            core::Tensor::Arange(1, n + 1, 1, core::Dtype::Int64, device)));
+
+    EXPECT_ANY_THROW(core::Tensor::Init<bool>({true}, device).CumSum(0));
+}
+
+TEST_P(TensorPermuteDevices, SegmentReduce) {
+    core::Device device = GetParam();
+
+    core::Tensor values = core::Tensor::Init<float>(
+            {{1, 10}, {2, 20}, {3, 30}, {4, 40}, {6, 60}}, device);
+    core::Tensor segment_ids =
+            core::Tensor::Init<int64_t>({0, 0, 2, 2, 2}, device);
+    EXPECT_EQ(values.SegmentSum(segment_ids).ToFlatVector<float>(),
+              std::vector<float>({3, 30, 0, 0, 13, 130}));
+    EXPECT_EQ(values.SegmentMean(segment_ids).ToFlatVector<float>(),
+              std::vector<float>({1.5, 15, 0, 0, 13.f / 3, 130.f / 3}));
+    EXPECT_EQ(values.SegmentMax(segment_ids, 4).ToFlatVector<float>(),
+              std::vector<float>({2, 20, 0, 0, 6, 60, 0, 0}));
+
+    // Grouping by key: sort the keys, then reduce the rows of each key.
+    core::Tensor keys = core::Tensor::Init<int64_t>({7, 3, 7, 3, 9}, device);
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = keys.Unique(true, true);
+    core::Tensor order = keys.ArgSort();
+    core::Tensor sums = values.IndexGet({order}).SegmentSum(
+            inverse.IndexGet({order}), unique.GetLength());
+    EXPECT_EQ(sums.ToFlatVector<float>(),
+              std::vector<float>({6, 60, 4, 40, 6, 60}));
+
+    EXPECT_ANY_THROW(values.SegmentSum(
+            core::Tensor::Init<int64_t>({0, 2, 1, 2, 2}, device)));
+    EXPECT_ANY_THROW(values.SegmentSum(segment_ids, 2));
+    EXPECT_ANY_THROW(values.SegmentSum(
+            core::Tensor::Init<int32_t>({0, 0, 2, 2, 2}, device)));
+}
+
+TEST_P(TensorPermuteDevices, Concatenate) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{0, 1}, {2, 3}}, device);
+    core::Tensor b = core::Tensor::Init<float>({{4, 5}}, device);
+    core::Tensor c = core::Tensor::Concatenate({a, b});
+    EXPECT_EQ(c.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(c.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3, 4, 5}));
+
+    c = core::Tensor::Concatenate({a, b.T(), a.T()}, -1);
+    EXPECT_EQ(c.GetShape(), core::SizeVector({2, 5}));
+    EXPECT_EQ(c.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 4, 0, 2, 2, 3, 5, 1, 3}));
+
+    c = core::Tensor::Concatenate(
+            {a, core::Tensor({0, 2}, core::Dtype::Float32, device)});
+    EXPECT_TRUE(c.AllClose(a));
+
+    EXPECT_ANY_THROW(core::Tensor::Concatenate({}));
+    EXPECT_ANY_THROW(core::Tensor::Concatenate({a, b}, 1));
+    EXPECT_ANY_THROW(core::Tensor::Concatenate({a, b.To(core::Dtype::Int32)}));
+}
+
+TEST_P(TensorPermuteDevices, Gather) {
+    core::Device device = GetParam();
+
+    core::Tensor src =
+            core::Tensor::Init<int32_t>({{0, 1}, {2, 3}, {4, 5}}, device);
+    core::Tensor indices = core::Tensor::Init<int64_t>({2, 0, 2}, device);
+    core::Tensor dst = src.Gather(indices);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(dst.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({4, 5, 0, 1, 4, 5}));
+    core::Tensor src_t_indices = core::Tensor::Init<int64_t>({1, 0, 1}, device);
+    EXPECT_TRUE(src.T().Gather(src_t_indices)
+                        .AllClose(src.T().IndexGet({src_t_indices})));
+    EXPECT_EQ(src.Gather(core::Tensor({0}, core::Dtype::Int64, device))
+                      .GetShape(),
+              core::SizeVector({0, 2}));
+
+    EXPECT_ANY_THROW(src.Gather(core::Tensor::Init<int64_t>({3}, device)));
+    EXPECT_ANY_THROW(src.Gather(core::Tensor::Init<int32_t>({0}, device)));
+}
+
+TEST_P(TensorPermuteDevices, ScatterAddMax) {
+    core::Device device = GetParam();
+
+    core::Tensor src = core::Tensor::Init<float>(
+            {{1, -1}, {2, -2}, {3, -3}, {4, -4}}, device);
+    core::Tensor indices = core::Tensor::Init<int64_t>({2, 0, 2, 2}, device);
+    core::Tensor dst = core::Tensor::Ones({3, 2}, core::Dtype::Float32, device);
+    dst.ScatterAdd_(indices, src);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({3, -1, 1, 1, 9, -7}));
+
+    dst = core::Tensor::Zeros({3, 2}, core::Dtype::Float32, device);
+    dst.ScatterMax_(indices, src);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({2, 0, 0, 0, 4, 0}));
+
+    // Strided destination.
+    dst = core::Tensor::Zeros({2, 3}, core::Dtype::Float32, device);
+    core::Tensor dst_t = dst.T();
+    dst_t.ScatterAdd_(indices, src);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({2, 0, 8, -2, 0, -8}));
+
+    // Many source rows into few destination rows, and the other way round,
+    // compared to a serial reference.
+    for (int64_t num_dst : {int64_t(7), int64_t(1000000)}) {
+        const int64_t num_src = 300000;
+        std::vector<int64_t> idx(num_src);
+        std::vector<int64_t> vals(num_src);
+        std::vector<int64_t> sum_ref(num_dst, 0);
+        std::vector<int64_t> max_ref(num_dst, 0);
+        for (int64_t i = 0; i < num_src; ++i) {
+            idx[i] = (i * 7919) % num_dst;
+            vals[i] = (i * 104729) % 1000 - 500;
+            sum_ref[idx[i]] += vals[i];
+            max_ref[idx[i]] = std::max(max_ref[idx[i]], vals[i]);
+        }
+        core::Tensor t_idx(idx, {num_src}, core::Dtype::Int64, device);
+        core::Tensor t_vals(vals, {num_src}, core::Dtype::Int64, device);
+        core::Tensor t_sum =
+                core::Tensor::Zeros({num_dst}, core::Dtype::Int64, device);
+        core::Tensor t_max =
+                core::Tensor::Zeros({num_dst}, core::Dtype::Int64, device);
+        EXPECT_EQ(t_sum.ScatterAdd_(t_idx, t_vals).ToFlatVector<int64_t>(),
+                  sum_ref);
+        EXPECT_EQ(t_max.ScatterMax_(t_idx, t_vals).ToFlatVector<int64_t>(),
+                  max_ref);
+    }
+
+    EXPECT_ANY_THROW(dst.ScatterAdd_(
+            core::Tensor::Init<int64_t>({0, 0, 3, 0}, device), src));
+    EXPECT_ANY_THROW(dst.ScatterAdd_(indices.Slice(0, 0, 2), src));
+    EXPECT_ANY_THROW(dst.ScatterAdd_(indices, src.To(core::Dtype::Float64)));
+}
+
+TEST_P(TensorPermuteDevices, MaskedFill) {
+    core::Device device = GetParam();
+
+    core::Tensor t = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor mask = t.Gt(2.5);
+    t.MaskedFill_(mask, 10);
+    EXPECT_EQ(t.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 10, 10, 10}));
+
+    // Broadcast mask.
+    t.MaskedFill_(core::Tensor::Init<bool>({true, false, true}, device),
+                  core::Tensor::Init<int32_t>({-1}, device));
+    EXPECT_EQ(t.ToFlatVector<float>(),
+              std::vector<float>({-1, 1, -1, -1, 10, -1}));
+
+    // Strided destination through SetItem.
+    core::Tensor u = core::Tensor::Zeros({3, 2}, core::Dtype::Int32, device);
+    core::Tensor u_t = u.T();
+    u_t.SetItem(core::TensorKey::IndexTensor(mask),
+                core::Tensor::Init<int32_t>({7}, device));
+    EXPECT_EQ(u.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 7, 0, 7, 0, 7}));
+
+    EXPECT_ANY_THROW(t.MaskedFill_(mask.To(core::Dtype::Int32), 1));
+    EXPECT_ANY_THROW(t.MaskedFill_(mask, core::Tensor::Init<float>({1, 2})));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <cmath>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TensorExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpr,
+                         TensorExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TensorExprPermuteDevices, Eval) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor b = core::Tensor::Init<float>({{6, 5, 4}, {3, 2, 1}}, device);
+    core::Tensor c = core::Tensor::Init<float>({1, 2, 3}, device);
+
+    // Broadcasting and scalars.
+    core::Tensor fused = ((core::TensorExpr(a) - b) * c + 1.f).Eval();
+    core::Tensor eager = (a - b) * c + 1.f;
+    EXPECT_EQ(fused.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_TRUE(fused.AllClose(eager));
+
+    // Unary ops. The repeated input is shared.
+    fused = (core::TensorExpr(a).Sqrt() / a).Square().Neg().Eval();
+    eager = (a.Sqrt() / a);
+    eager = (eager * eager).Neg();
+    EXPECT_TRUE(fused.AllClose(eager));
+
+    fused = (core::TensorExpr(a).Sin() * a.Cos() - b.Exp()).Abs().Eval();
+    eager = (a.Sin() * a.Cos() - b.Exp()).Abs();
+    EXPECT_TRUE(fused.AllClose(eager));
+
+    // Non-contiguous input.
+    core::Tensor a_t = a.T();
+    fused = (core::TensorExpr(a_t) * 2.f).Eval();
+    EXPECT_TRUE(fused.AllClose(a_t * 2.f));
+
+    // Mismatched dtypes are rejected.
+    EXPECT_ANY_THROW(core::TensorExpr(a) + a.To(core::Dtype::Float64));
+}
+
+TEST_P(TensorExprPermuteDevices, Reduction) {
+    core::Device device = GetParam();
+    const int64_t n = 100003;
+    core::Tensor a = core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device)
+                             .Reshape({n, 1});
+    core::Tensor b = core::Tensor::Init<int64_t>({1, 2, 3}, device);
+
+    // sum_i sum_j (a_i - b_j)^2
+    core::Tensor fused = (core::TensorExpr(a) - b).Square().Sum();
+    core::Tensor eager = ((a - b) * (a - b)).Sum({0, 1});
+    EXPECT_EQ(fused.NumDims(), 0);
+    EXPECT_EQ(fused.Item<int64_t>(), eager.Item<int64_t>());
+
+    EXPECT_EQ((core::TensorExpr(a) - b).Min().Item<int64_t>(), -3);
+    EXPECT_EQ((core::TensorExpr(a) - b).Max().Item<int64_t>(), n - 2);
+    EXPECT_EQ((core::TensorExpr(b) + 1).Prod().Item<int64_t>(), 24);
+
+    core::Tensor x = core::Tensor::Init<float>({0.5, 1.5, -2}, device);
+    EXPECT_NEAR((core::TensorExpr(x) * x).Sum().Item<float>(), 6.5, 1e-6);
+
+    core::Tensor empty = core::Tensor::Empty({0, 3}, core::Dtype::Float32,
+                                             device);
+    EXPECT_EQ(core::TensorExpr(empty).Sum().Item<float>(), 0);
+    EXPECT_ANY_THROW(core::TensorExpr(empty).Max());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -27,6 +27,8 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <algorithm>
+#include <iterator>
+#include <random>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/BoundingVolume.h"
@@ -594,6 +596,47 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ApplyIndices(pc_down->colors_, sort_indices), colors_down);
 }
 
+TEST(PointCloud, VoxelDownSampleModes) {
+    // voxel_size: 1, voxel_min_bound: (0, 0, 0)
+    geometry::PointCloud pcd;
+    pcd.points_ = {// voxel_{1, 0, 0}
+                   {1.9, 0.9, 0.9},
+                   // voxel_{0, 0, 0}
+                   {0.9, 0.9, 0.9},
+                   {0.5, 0.5, 0.5},
+                   // voxel_{1, 0, 0}
+                   {1.4, 0.6, 0.5},
+                   // voxel_{0, 0, 0}
+                   {0.6, 0.55, 0.5}};
+    pcd.colors_ = {{0.0, 0.0, 0.0},
+                   {0.1, 0.1, 0.1},
+                   {0.2, 0.2, 0.2},
+                   {0.3, 0.3, 0.3},
+                   {0.4, 0.4, 0.4}};
+
+    // The voxels are sorted.
+    std::shared_ptr<geometry::PointCloud> pc_down =
+            pcd.VoxelDownSample(1.0, geometry::VoxelDownSampleMode::Mean);
+    ExpectEQ(pc_down->points_,
+             std::vector<Eigen::Vector3d>{{2.0 / 3, 0.65, 1.9 / 3},
+                                          {1.65, 0.75, 0.7}});
+    ExpectEQ(pc_down->colors_,
+             std::vector<Eigen::Vector3d>{{0.7 / 3, 0.7 / 3, 0.7 / 3},
+                                          {0.15, 0.15, 0.15}});
+
+    pc_down = pcd.VoxelDownSample(1.0, geometry::VoxelDownSampleMode::First);
+    ExpectEQ(pc_down->points_,
+             std::vector<Eigen::Vector3d>{pcd.points_[1], pcd.points_[0]});
+    ExpectEQ(pc_down->colors_,
+             std::vector<Eigen::Vector3d>{pcd.colors_[1], pcd.colors_[0]});
+
+    pc_down = pcd.VoxelDownSample(1.0, geometry::VoxelDownSampleMode::Center);
+    ExpectEQ(pc_down->points_,
+             std::vector<Eigen::Vector3d>{{0.5, 0.5, 0.5}, {1.5, 0.5, 0.5}});
+    ExpectEQ(pc_down->colors_,
+             std::vector<Eigen::Vector3d>{pcd.colors_[2], pcd.colors_[3]});
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -1021,6 +1064,20 @@ TEST(PointCloud, ClusterDBSCAN) {
     EXPECT_EQ(cluster_sum, 398580);
 }
 
+TEST(PointCloud, ClusterDBSCANLowMemory) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    EXPECT_EQ(pcd.points_.size(), 196133);
+
+    // Same labels as the default mode.
+    std::vector<int> cluster = pcd.ClusterDBSCAN(0.02, 10, false, true);
+    EXPECT_EQ(cluster, pcd.ClusterDBSCAN(0.02, 10, false, false));
+    std::unordered_set<int> cluster_set(cluster.begin(), cluster.end());
+    EXPECT_EQ(cluster_set.size(), 11);
+    int cluster_sum = std::accumulate(cluster.begin(), cluster.end(), 0);
+    EXPECT_EQ(cluster_sum, 398580);
+}
+
 TEST(PointCloud, SegmentPlane) {
     geometry::PointCloud pcd;
     io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.pcd", pcd);
@@ -1050,6 +1107,65 @@ TEST(PointCloud, SegmentPlaneKnownPlane) {
     ExpectEQ(pcd.SelectByIndex(inliers)->points_, ref);
 }
 
+TEST(PointCloud, SegmentPlanes) {
+    // Three planes of decreasing size, z = 0, x = 0 and y = 1, and noise.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 3000; ++i) {
+        pcd.points_.emplace_back(uniform(rng), uniform(rng), 0);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        pcd.points_.emplace_back(0, uniform(rng), 0.1 + uniform(rng));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        pcd.points_.emplace_back(0.1 + uniform(rng), 1, 0.1 + uniform(rng));
+    }
+    for (int i = 0; i < 200; ++i) {
+        pcd.points_.emplace_back(0.2 + 0.6 * uniform(rng),
+                                 0.2 + 0.6 * uniform(rng),
+                                 0.2 + 0.6 * uniform(rng));
+    }
+
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes =
+            pcd.SegmentPlanes(0.01, 3, 1000, 10, 500);
+    ASSERT_EQ(planes.size(), 3);
+    const std::vector<Eigen::Vector4d> ref_models = {
+            {0, 0, 1, 0}, {1, 0, 0, 0}, {0, 1, 0, -1}};
+    const std::vector<size_t> ref_begins = {0, 3000, 5000, 6000};
+    for (size_t i = 0; i < planes.size(); ++i) {
+        Eigen::Vector4d plane_model = std::get<0>(planes[i]);
+        if (plane_model.head<3>().dot(ref_models[i].head<3>()) < 0) {
+            plane_model = -plane_model;
+        }
+        ExpectEQ(plane_model, ref_models[i], 1e-6);
+
+        // The noise and the other planes are farther than the threshold.
+        std::vector<size_t> inliers = std::get<1>(planes[i]);
+        std::vector<size_t> own;
+        std::copy_if(inliers.begin(), inliers.end(), std::back_inserter(own),
+                     [&](size_t idx) {
+                         return idx >= ref_begins[i] &&
+                                idx < ref_begins[i + 1];
+                     });
+        EXPECT_EQ(own.size(), ref_begins[i + 1] - ref_begins[i]);
+        EXPECT_EQ(inliers.size(), own.size());
+    }
+
+    // At most max_num_planes planes.
+    EXPECT_EQ(pcd.SegmentPlanes(0.01, 3, 1000, 2, 500).size(), 2);
+}
+
+TEST(PointCloud, SegmentPlanesCollinear) {
+    // No sample of collinear points spans a plane, so no round may take all
+    // the points.
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 100; ++i) {
+        pcd.points_.emplace_back(i, 0, 0);
+    }
+    EXPECT_TRUE(pcd.SegmentPlanes(0.01, 3, 100, 3, 10).empty());
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     const std::string trajectory_path =
             std::string(TEST_DATA_DIR) + "/RGBD/trajectory.log";
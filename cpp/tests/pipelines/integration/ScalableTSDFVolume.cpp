@@ -24,11 +24,44 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include <map>
+#include <tuple>
+
+#include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
+// A fronto-parallel wall at 1m, seen by a small pinhole camera at the origin.
+static geometry::RGBDImage CreateWallImage(
+        const camera::PinholeCameraIntrinsic& intrinsic) {
+    geometry::RGBDImage image;
+    image.depth_.Prepare(intrinsic.width_, intrinsic.height_, 1, 4);
+    for (int v = 0; v < intrinsic.height_; ++v) {
+        for (int u = 0; u < intrinsic.width_; ++u) {
+            *image.depth_.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+    return image;
+}
+
+// Maps the grid index of each extracted voxel to its color.
+static std::map<std::tuple<int, int, int>, double> VoxelMap(
+        const geometry::PointCloud& voxel_pcd, double voxel_length) {
+    std::map<std::tuple<int, int, int>, double> voxels;
+    for (size_t i = 0; i < voxel_pcd.points_.size(); ++i) {
+        Eigen::Vector3d grid = voxel_pcd.points_[i] / voxel_length;
+        voxels[std::make_tuple(int(std::floor(grid(0))),
+                               int(std::floor(grid(1))),
+                               int(std::floor(grid(2))))] =
+                voxel_pcd.colors_[i](0);
+    }
+    return voxels;
+}
+
 TEST(ScalableTSDFVolume, DISABLED_VolumeUnit) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Constructor) { NotImplemented(); }
@@ -37,9 +70,75 @@ TEST(ScalableTSDFVolume, DISABLED_Destructor) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_Reset) { NotImplemented(); }
-
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { NotImplemented(); }
+TEST(ScalableTSDFVolume, Reset) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 64.0, 64.0, 31.5, 23.5);
+    geometry::RGBDImage image = CreateWallImage(intrinsic);
+    pipelines::integration::ScalableTSDFVolume volume(
+            0.01, 0.04, pipelines::integration::TSDFVolumeColorType::NoColor);
+
+    volume.Integrate(image, intrinsic, Eigen::Matrix4d::Identity());
+    size_t num_units = volume.volume_units_.size();
+    size_t num_voxels = volume.ExtractVoxelPointCloud()->points_.size();
+    EXPECT_GT(num_units, 0u);
+    EXPECT_GT(num_voxels, 0u);
+
+    volume.Reset();
+    EXPECT_EQ(volume.volume_units_.size(), 0u);
+    EXPECT_EQ(volume.ExtractVoxelPointCloud()->points_.size(), 0u);
+
+    volume.Integrate(image, intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_EQ(volume.volume_units_.size(), num_units);
+    EXPECT_EQ(volume.ExtractVoxelPointCloud()->points_.size(), num_voxels);
+}
+
+TEST(ScalableTSDFVolume, Integrate) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 64.0, 64.0, 31.5, 23.5);
+    geometry::RGBDImage image = CreateWallImage(intrinsic);
+    const double voxel_length = 0.01;
+    const double sdf_trunc = 0.04;
+    pipelines::integration::ScalableTSDFVolume scalable(
+            voxel_length, sdf_trunc,
+            pipelines::integration::TSDFVolumeColorType::NoColor);
+    // Covers the frustum around the wall, aligned with the 16^3 units.
+    pipelines::integration::UniformTSDFVolume uniform(
+            1.28, 128, sdf_trunc,
+            pipelines::integration::TSDFVolumeColorType::NoColor,
+            Eigen::Vector3d(-0.64, -0.64, 0.48));
+    for (int i = 0; i < 2; ++i) {
+        scalable.Integrate(image, intrinsic, Eigen::Matrix4d::Identity());
+        uniform.Integrate(image, intrinsic, Eigen::Matrix4d::Identity());
+    }
+
+    // Every voxel near the wall lies in a touched unit and matches the
+    // uniform volume.
+    auto scalable_voxels =
+            VoxelMap(*scalable.ExtractVoxelPointCloud(), voxel_length);
+    auto uniform_voxels =
+            VoxelMap(*uniform.ExtractVoxelPointCloud(), voxel_length);
+    EXPECT_GT(scalable_voxels.size(), 0u);
+    EXPECT_EQ(scalable_voxels.size(), uniform_voxels.size());
+    for (const auto& it : scalable_voxels) {
+        auto uniform_it = uniform_voxels.find(it.first);
+        ASSERT_TRUE(uniform_it != uniform_voxels.end());
+        EXPECT_NEAR(it.second, uniform_it->second, 1e-5);
+    }
+
+    // The surface is extracted on the wall, with normals facing the camera.
+    auto pcd = scalable.ExtractPointCloud();
+    EXPECT_GT(pcd->points_.size(), 0u);
+    Eigen::Vector3d normal_sum(0, 0, 0);
+    for (size_t i = 0; i < pcd->points_.size(); ++i) {
+        EXPECT_NEAR(pcd->points_[i](2), 1.0, 1e-3);
+        normal_sum += pcd->normals_[i];
+    }
+    EXPECT_LT(normal_sum.normalized()(2), -0.99);
+
+    // Copies own their voxels.
+    pipelines::integration::ScalableTSDFVolume copy = scalable;
+    scalable.Reset();
+    EXPECT_EQ(VoxelMap(*copy.ExtractVoxelPointCloud(), voxel_length),
+              scalable_voxels);
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) { NotImplemented(); }
 
@@ -24,6 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Feature.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -39,5 +45,104 @@ TEST(Feature, DISABLED_ComputeFPFHFeature) { NotImplemented(); }
 
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { NotImplemented(); }
 
+// Uniformly distributed features. tests::Rand repeats itself too early for
+// features to be distinct.
+static pipelines::registration::Feature RandomFeature(int dim,
+                                                      int n,
+                                                      unsigned seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 100.0);
+    pipelines::registration::Feature feature;
+    feature.Resize(dim, n);
+    for (int k = 0; k < feature.data_.size(); k++) {
+        feature.data_.data()[k] = distribution(generator);
+    }
+    return feature;
+}
+
+// Index of the nearest column of dataset to the i-th column of queries.
+static int BruteForceNearest(const Eigen::MatrixXd &queries,
+                             int i,
+                             const Eigen::MatrixXd &dataset) {
+    Eigen::Index nearest;
+    (dataset.colwise() - queries.col(i)).colwise().squaredNorm().minCoeff(
+            &nearest);
+    return int(nearest);
+}
+
+TEST(Feature, CorrespondencesFromFeatures) {
+    using pipelines::registration::CorrespondenceSet;
+    using pipelines::registration::CorrespondencesFromFeatures;
+    using pipelines::registration::Feature;
+    using pipelines::registration::FeatureMatchingOption;
+    const int dim = 33;
+    const int num_tgt = 2000;
+    const int num_src = 1500;
+
+    // The source features are copies of a shuffled subset of the target
+    // features, plus noise in [-0.1, 0.1].
+    Feature target = RandomFeature(dim, num_tgt, 0);
+    std::vector<int> permutation(num_tgt);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), std::mt19937(0));
+    Feature source = RandomFeature(dim, num_src, 1);
+    for (int i = 0; i < num_src; i++) {
+        source.data_.col(i) = target.data_.col(permutation[i]) +
+                              (source.data_.col(i).array() - 50.0).matrix() *
+                                      0.002;
+    }
+
+    // Exact matching recovers the permutation, with or without mutual filter.
+    for (bool mutual_filter : {false, true}) {
+        CorrespondenceSet corres =
+                CorrespondencesFromFeatures(source, target, mutual_filter);
+        ASSERT_EQ(int(corres.size()), num_src);
+        for (int i = 0; i < num_src; i++) {
+            EXPECT_EQ(corres[i], Eigen::Vector2i(i, permutation[i]));
+        }
+    }
+
+    // The kd-forest finds nearly all of them.
+    FeatureMatchingOption option(FeatureMatchingOption::Method::KDForest);
+    CorrespondenceSet corres =
+            CorrespondencesFromFeatures(source, target, false, option);
+    ASSERT_EQ(int(corres.size()), num_src);
+    int num_correct = 0;
+    for (int i = 0; i < num_src; i++) {
+        EXPECT_EQ(corres[i](0), i);
+        num_correct += corres[i](1) == permutation[i];
+    }
+    EXPECT_GE(num_correct, 0.95 * num_src);
+
+    // Unrelated features: the exact matches and the mutual filter agree with
+    // a brute force search.
+    Feature queries = RandomFeature(dim, 300, 2);
+    Feature dataset = RandomFeature(dim, 200, 3);
+    CorrespondenceSet corres_ij = CorrespondencesFromFeatures(queries, dataset);
+    CorrespondenceSet corres_mutual =
+            CorrespondencesFromFeatures(queries, dataset, true);
+    CorrespondenceSet corres_mutual_gt;
+    for (int i = 0; i < 300; i++) {
+        int j = BruteForceNearest(queries.data_, i, dataset.data_);
+        EXPECT_EQ(corres_ij[i], Eigen::Vector2i(i, j));
+        if (BruteForceNearest(dataset.data_, j, queries.data_) == i) {
+            corres_mutual_gt.emplace_back(i, j);
+        }
+    }
+    EXPECT_FALSE(corres_mutual_gt.empty());
+    EXPECT_EQ(corres_mutual, corres_mutual_gt);
+
+    // One search returns both sets.
+    std::pair<CorrespondenceSet, CorrespondenceSet> corres_both =
+            pipelines::registration::MutualCorrespondencesFromFeatures(
+                    queries, dataset);
+    EXPECT_EQ(corres_both.first, corres_ij);
+    EXPECT_EQ(corres_both.second, corres_mutual);
+
+    Feature other;
+    other.Resize(dim + 1, 10);
+    EXPECT_ANY_THROW(CorrespondencesFromFeatures(source, other));
+}
+
 }  // namespace tests
 }  // namespace open3d
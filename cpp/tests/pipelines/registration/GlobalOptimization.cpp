@@ -24,17 +24,90 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <Eigen/Geometry>
+
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
+// Poses along a spiral, and a pose graph with exact odometry and loop closure
+// edges whose nodes start off the poses.
+static pipelines::registration::PoseGraph CreatePoseGraph(
+        std::vector<Eigen::Matrix4d> &poses) {
+    using namespace pipelines::registration;
+    const int n_nodes = 30;
+    poses.clear();
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose.block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(0.2 * i, Eigen::Vector3d::UnitZ())
+                        .toRotationMatrix();
+        pose.block<3, 1>(0, 3) =
+                Eigen::Vector3d(std::cos(0.2 * i), std::sin(0.2 * i), 0.05 * i);
+        poses.push_back(pose);
+    }
+
+    PoseGraph pose_graph;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Matrix4d offset = Eigen::Matrix4d::Identity();
+        if (i > 0) {
+            offset.block<3, 3>(0, 0) =
+                    Eigen::AngleAxisd(0.01 * (i % 3), Eigen::Vector3d::UnitX())
+                            .toRotationMatrix();
+            offset(1, 3) = 0.02 * ((i % 5) - 2);
+        }
+        pose_graph.nodes_.push_back(PoseGraphNode(offset * poses[i]));
+    }
+    Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 100.0;
+    for (int i = 0; i + 1 < n_nodes; i++) {
+        pose_graph.edges_.push_back(PoseGraphEdge(
+                i, i + 1, poses[i + 1].inverse() * poses[i], information,
+                false));
+    }
+    for (int i = 0; i + 7 < n_nodes; i += 4) {
+        pose_graph.edges_.push_back(PoseGraphEdge(
+                i + 7, i, poses[i].inverse() * poses[i + 7], information,
+                true));
+    }
+    return pose_graph;
+}
+
 TEST(GlobalOptimization, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    NotImplemented();
+TEST(GlobalOptimization, GlobalOptimizationGaussNewton) {
+    using namespace pipelines::registration;
+    std::vector<Eigen::Matrix4d> poses;
+    PoseGraph pose_graph = CreatePoseGraph(poses);
+
+    GlobalOptimization(pose_graph, GlobalOptimizationGaussNewton(),
+                       GlobalOptimizationConvergenceCriteria(),
+                       GlobalOptimizationOption(0.03, 0.25, 1.0, 0));
+
+    for (size_t i = 0; i < poses.size(); i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses[i], 1e-4);
+    }
+}
+
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    using namespace pipelines::registration;
+    std::vector<Eigen::Matrix4d> poses;
+    PoseGraph pose_graph = CreatePoseGraph(poses);
+
+    GlobalOptimization(pose_graph, GlobalOptimizationLevenbergMarquardt(),
+                       GlobalOptimizationConvergenceCriteria(),
+                       GlobalOptimizationOption(0.03, 0.25, 1.0, 0));
+
+    for (size_t i = 0; i < poses.size(); i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses[i], 1e-4);
+    }
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
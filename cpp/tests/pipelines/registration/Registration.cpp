@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Registration.h"
+
+#include <Eigen/Geometry>
+
+#include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -45,12 +50,179 @@ TEST(Registration, DISABLED_EvaluateRegistration) { NotImplemented(); }
 
 TEST(Registration, DISABLED_RegistrationICP) { NotImplemented(); }
 
+// A grid on each face of the unit cube, with the face normals.
+static std::shared_ptr<geometry::PointCloud> CreateCubePointCloud() {
+    auto cube = std::make_shared<geometry::PointCloud>();
+    const int grid_size = 20;
+    for (int face = 0; face < 6; face++) {
+        int axis = face / 2;
+        for (int u = 0; u < grid_size; u++) {
+            for (int v = 0; v < grid_size; v++) {
+                Eigen::Vector3d point, normal = Eigen::Vector3d::Zero();
+                point(axis) = face % 2;
+                point((axis + 1) % 3) = (u + 0.5) / grid_size;
+                point((axis + 2) % 3) = (v + 0.5) / grid_size;
+                normal(axis) = face % 2 == 0 ? -1 : 1;
+                cube->points_.push_back(point);
+                cube->normals_.push_back(normal);
+            }
+        }
+    }
+    return cube;
+}
+
+TEST(Registration, RegistrationICPBatch) {
+    std::shared_ptr<geometry::PointCloud> target = CreateCubePointCloud();
+    pipelines::registration::RegistrationTarget registration_target(target);
+
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+            transformations_gt;
+    std::vector<std::shared_ptr<const geometry::PointCloud>> sources;
+    for (int i = 0; i < 8; i++) {
+        Eigen::Matrix4d transformation_gt = Eigen::Matrix4d::Identity();
+        transformation_gt.block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(0.02 * i, Eigen::Vector3d::UnitZ())
+                        .toRotationMatrix();
+        transformation_gt.block<3, 1>(0, 3) =
+                Eigen::Vector3d(0.01 * i, -0.01, 0.02);
+        transformations_gt.push_back(transformation_gt);
+        auto source = std::make_shared<geometry::PointCloud>(*target);
+        source->Transform(transformation_gt.inverse());
+        sources.push_back(source);
+    }
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> inits(
+            sources.size(), Eigen::Matrix4d::Identity());
+    pipelines::registration::TransformationEstimationPointToPlane estimation;
+    pipelines::registration::ICPConvergenceCriteria criteria(1e-6, 1e-6, 30);
+    double max_correspondence_distance = 0.2;
+
+    // Many sources.
+    std::vector<pipelines::registration::RegistrationResult> results =
+            pipelines::registration::RegistrationICPBatch(
+                    sources, registration_target, max_correspondence_distance,
+                    inits, estimation, criteria);
+    ASSERT_EQ(results.size(), sources.size());
+    for (size_t i = 0; i < sources.size(); i++) {
+        pipelines::registration::RegistrationResult result =
+                pipelines::registration::RegistrationICP(
+                        *sources[i], registration_target,
+                        max_correspondence_distance, inits[i], estimation,
+                        criteria);
+        ExpectEQ(Eigen::Matrix4d(results[i].transformation_),
+                 Eigen::Matrix4d(result.transformation_));
+        EXPECT_EQ(results[i].fitness_, result.fitness_);
+        EXPECT_NEAR(results[i].inlier_rmse_, result.inlier_rmse_, 1e-9);
+        EXPECT_TRUE(Eigen::Matrix4d(results[i].transformation_)
+                            .isApprox(transformations_gt[i], 1e-4));
+    }
+
+    // Many initial transformations of one source.
+    results = pipelines::registration::RegistrationICPBatch(
+            *sources[0], registration_target, max_correspondence_distance,
+            transformations_gt, estimation, criteria);
+    ASSERT_EQ(results.size(), transformations_gt.size());
+    for (size_t i = 0; i < transformations_gt.size(); i++) {
+        pipelines::registration::RegistrationResult result =
+                pipelines::registration::RegistrationICP(
+                        *sources[0], registration_target,
+                        max_correspondence_distance, transformations_gt[i],
+                        estimation, criteria);
+        ExpectEQ(Eigen::Matrix4d(results[i].transformation_),
+                 Eigen::Matrix4d(result.transformation_));
+        EXPECT_EQ(results[i].fitness_, result.fitness_);
+    }
+}
+
+// Point-to-point estimation that throws for source clouds above a height.
+class ThrowingEstimation
+    : public pipelines::registration::TransformationEstimationPointToPoint {
+public:
+    Eigen::Matrix4d ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const pipelines::registration::CorrespondenceSet &corres)
+            const override {
+        if (source.GetMinBound()(2) > 0.5) {
+            utility::LogError("Estimation failed.");
+        }
+        return TransformationEstimationPointToPoint::ComputeTransformation(
+                source, target, corres);
+    }
+};
+
+TEST(Registration, RegistrationICPBatchThrows) {
+    std::shared_ptr<geometry::PointCloud> target = CreateCubePointCloud();
+    pipelines::registration::RegistrationTarget registration_target(target);
+
+    // Only the last initial transformation lifts the source above the target.
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> inits(
+            8, Eigen::Matrix4d::Identity());
+    inits.back()(2, 3) = 1.0;
+    std::vector<std::shared_ptr<const geometry::PointCloud>> sources(
+            inits.size(), target);
+    ThrowingEstimation estimation;
+
+    EXPECT_THROW(pipelines::registration::RegistrationICPBatch(
+                         *target, registration_target, 0.2, inits, estimation),
+                 std::runtime_error);
+    EXPECT_THROW(pipelines::registration::RegistrationICPBatch(
+                         sources, registration_target, 0.2, inits, estimation),
+                 std::runtime_error);
+
+    inits.pop_back();
+    EXPECT_EQ(pipelines::registration::RegistrationICPBatch(
+                      *target, registration_target, 0.2, inits, estimation)
+                      .size(),
+              inits.size());
+}
+
 TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     NotImplemented();
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
-    NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnCorrespondence) {
+    std::shared_ptr<geometry::PointCloud> target = CreateCubePointCloud();
+    Eigen::Matrix4d transformation_gt = Eigen::Matrix4d::Identity();
+    transformation_gt.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.5, Eigen::Vector3d(1, 2, 3).normalized())
+                    .toRotationMatrix();
+    transformation_gt.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.1);
+    geometry::PointCloud source = *target;
+    source.Transform(transformation_gt.inverse());
+
+    // Half of the correspondences are outliers.
+    int num_points = static_cast<int>(target->points_.size());
+    pipelines::registration::CorrespondenceSet corres;
+    for (int i = 0; i < num_points; i++) {
+        int j = i % 2 == 0 ? i : (i * 7919 + 13) % num_points;
+        corres.push_back(Eigen::Vector2i(i, j));
+    }
+    int num_inliers = 0;
+    for (const Eigen::Vector2i &c : corres) {
+        num_inliers += (transformation_gt * source.points_[c(0)].homogeneous())
+                               .head<3>()
+                               .isApprox(target->points_[c(1)]);
+    }
+
+    for (double early_rejection_sigma : {0.0, 3.0}) {
+        pipelines::registration::RegistrationResult result =
+                pipelines::registration::
+                        RegistrationRANSACBasedOnCorrespondence(
+                                source, *target, corres, 0.01,
+                                pipelines::registration::
+                                        TransformationEstimationPointToPoint(),
+                                3, {},
+                                pipelines::registration::
+                                        RANSACConvergenceCriteria(
+                                                100000, 0.999,
+                                                early_rejection_sigma));
+        EXPECT_TRUE(Eigen::Matrix4d(result.transformation_)
+                            .isApprox(transformation_gt, 1e-6));
+        EXPECT_EQ(static_cast<int>(result.correspondence_set_.size()),
+                  num_inliers);
+        EXPECT_NEAR(result.fitness_, (double)num_inliers / corres.size(),
+                    1e-12);
+    }
 }
 
 TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
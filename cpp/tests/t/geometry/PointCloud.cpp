@@ -26,6 +26,9 @@
 
 #include "open3d/t/geometry/PointCloud.h"
 
+#include <numeric>
+#include <random>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
 #include "tests/UnitTest.h"
@@ -247,6 +250,94 @@ TEST_P(PointCloudPermuteDevices, Rotate) {
               std::vector<float>({2, 2, 1}));
 }
 
+TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
+    core::Device device = GetParam();
+
+    // Three blobs of different densities, touching chains and sparse noise.
+    geometry::PointCloud legacy_pcd;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const std::vector<std::pair<Eigen::Vector3d, double>> blobs = {
+            {Eigen::Vector3d(0.2, 0.2, 0.2), 0.1},
+            {Eigen::Vector3d(0.5, 0.25, 0.2), 0.15},
+            {Eigen::Vector3d(0.7, 0.7, 0.7), 0.2}};
+    for (const auto &blob : blobs) {
+        for (int i = 0; i < 2000; ++i) {
+            Eigen::Vector3d offset(uniform(rng), uniform(rng), uniform(rng));
+            offset = offset * 2.0 - Eigen::Vector3d::Ones();
+            legacy_pcd.points_.push_back(blob.first + blob.second * offset);
+        }
+    }
+    for (int i = 0; i < 1000; ++i) {
+        legacy_pcd.points_.emplace_back(uniform(rng), uniform(rng),
+                                        uniform(rng));
+    }
+    std::vector<int> labels_legacy = legacy_pcd.ClusterDBSCAN(0.03, 8);
+    EXPECT_GT(*std::max_element(labels_legacy.begin(), labels_legacy.end()),
+              0);
+
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+        t::geometry::PointCloud pcd =
+                t::geometry::PointCloud::FromLegacyPointCloud(legacy_pcd,
+                                                              dtype, device);
+        if (device.GetType() == core::Device::DeviceType::CUDA) {
+            EXPECT_ANY_THROW(pcd.ClusterDBSCAN(0.03, 8));
+            continue;
+        }
+        core::Tensor labels = pcd.ClusterDBSCAN(0.03, 8);
+        EXPECT_EQ(labels.GetDtype(), core::Dtype::Int32);
+        EXPECT_EQ(labels.ToFlatVector<int>(), labels_legacy);
+    }
+}
+
+TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud legacy_pcd;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    for (int i = 0; i < 1000; ++i) {
+        legacy_pcd.points_.emplace_back(uniform(rng), uniform(rng),
+                                        uniform(rng));
+        legacy_pcd.normals_.emplace_back(uniform(rng), uniform(rng),
+                                         uniform(rng));
+        legacy_pcd.colors_.emplace_back(uniform(rng), uniform(rng),
+                                        uniform(rng));
+    }
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            legacy_pcd, core::Dtype::Float64, device);
+    std::vector<int64_t> labels(1000);
+    std::iota(labels.begin(), labels.end(), 0);
+    pcd.SetPointAttr("labels", core::Tensor(labels, {1000, 1},
+                                            core::Dtype::Int64, device));
+
+    // Same voxels and order as the legacy point cloud.
+    for (auto mode : {geometry::VoxelDownSampleMode::Mean,
+                      geometry::VoxelDownSampleMode::First,
+                      geometry::VoxelDownSampleMode::Center}) {
+        t::geometry::PointCloud pcd_down = pcd.VoxelDownSample(0.2, mode);
+        std::shared_ptr<geometry::PointCloud> legacy_down =
+                legacy_pcd.VoxelDownSample(0.2, mode);
+        geometry::PointCloud pcd_down_legacy = pcd_down.ToLegacyPointCloud();
+        ExpectEQ(pcd_down_legacy.points_, legacy_down->points_);
+        ExpectEQ(pcd_down_legacy.normals_, legacy_down->normals_);
+        ExpectEQ(pcd_down_legacy.colors_, legacy_down->colors_);
+        EXPECT_EQ(pcd_down.GetPointAttr("labels").GetDtype(),
+                  core::Dtype::Int64);
+        EXPECT_EQ(pcd_down.GetPointAttr("labels").GetShape(),
+                  core::SizeVector({int64_t(legacy_down->points_.size()), 1}));
+    }
+
+    // First keeps the point with the smallest index of each voxel.
+    t::geometry::PointCloud pcd_first =
+            pcd.VoxelDownSample(0.2, geometry::VoxelDownSampleMode::First);
+    core::Tensor first_labels = pcd_first.GetPointAttr("labels").Reshape({-1});
+    EXPECT_TRUE(pcd_first.GetPoints().AllClose(
+            pcd.GetPoints().IndexGet({first_labels})));
+
+    EXPECT_ANY_THROW(pcd.VoxelDownSample(0));
+}
+
 TEST_P(PointCloudPermuteDevices, FromLegacyPointCloud) {
     core::Device device = GetParam();
     geometry::PointCloud legacy_pcd;
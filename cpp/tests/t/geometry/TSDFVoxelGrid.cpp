@@ -107,5 +107,77 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     EXPECT_NEAR(result.fitness_, 1.0, 1e-5);
     EXPECT_NEAR(result.inlier_rmse_, 0, 1e-5);
 }
+
+TEST_P(TSDFVoxelGridPermuteDevices, RayCast) {
+    core::Device device = GetParam();
+
+    // A fronto-parallel wall 1m in front of the camera.
+    int64_t width = 64, height = 48;
+    core::Tensor intrinsic_t(
+            std::vector<float>({64, 0, 31.5, 0, 64, 23.5, 0, 0, 1}), {3, 3},
+            core::Dtype::Float32);
+    core::Tensor extrinsic_t =
+            core::Tensor::Eye(4, core::Dtype::Float32, core::Device("CPU:0"));
+    t::geometry::Image depth(
+            core::Tensor(std::vector<uint16_t>(width * height, 1000),
+                         {height, width, 1}, core::Dtype::UInt16, device));
+
+    t::geometry::TSDFVoxelGrid voxel_grid(
+            {{"tsdf", core::Dtype::Float32}, {"weight", core::Dtype::Float32}},
+            0.01f, 0.04f, 16, 1000, device);
+    // Integrate enough times to pass the default weight threshold.
+    for (int i = 0; i < 5; ++i) {
+        voxel_grid.Integrate(depth, intrinsic_t, extrinsic_t.To(device));
+    }
+
+    // Move the camera 5cm to the left and 10cm closer to the wall.
+    core::Tensor extrinsic_moved = extrinsic_t.Clone();
+    extrinsic_moved[0][3] = 0.05f;
+    extrinsic_moved[2][3] = -0.1f;
+    for (const auto &extrinsic : {extrinsic_t, extrinsic_moved}) {
+        float z = 1.0f + extrinsic[2][3].Item<float>();
+        auto images = voxel_grid.RayCast(intrinsic_t, extrinsic, width, height);
+        EXPECT_EQ(images.count("color"), 0);
+
+        core::Tensor depth_map = images.at("depth").AsTensor().To(
+                core::Device("CPU:0"));
+        core::Tensor vertex_map = images.at("vertex").AsTensor().To(
+                core::Device("CPU:0"));
+        core::Tensor normal_map = images.at("normal").AsTensor().To(
+                core::Device("CPU:0"));
+        EXPECT_EQ(depth_map.GetShape(), core::SizeVector({height, width, 1}));
+        EXPECT_EQ(vertex_map.GetShape(), core::SizeVector({height, width, 3}));
+        EXPECT_EQ(normal_map.GetShape(), core::SizeVector({height, width, 3}));
+
+        // Central pixels see the inside of the integrated wall.
+        for (int64_t v = 16; v < 32; ++v) {
+            for (int64_t u = 16; u < 48; ++u) {
+                EXPECT_NEAR(depth_map[v][u][0].Item<float>(), z * 1000, 5);
+                EXPECT_NEAR(vertex_map[v][u][0].Item<float>(),
+                            (u - 31.5) / 64 * z, 5e-3);
+                EXPECT_NEAR(vertex_map[v][u][1].Item<float>(),
+                            (v - 23.5) / 64 * z, 5e-3);
+                EXPECT_NEAR(vertex_map[v][u][2].Item<float>(), z, 5e-3);
+                EXPECT_NEAR(normal_map[v][u][0].Item<float>(), 0, 1e-2);
+                EXPECT_NEAR(normal_map[v][u][1].Item<float>(), 0, 1e-2);
+                EXPECT_NEAR(normal_map[v][u][2].Item<float>(), -1, 1e-2);
+            }
+        }
+    }
+
+    // Blocks allocated after a RayCast are seen by the next one.
+    t::geometry::Image near_depth(
+            core::Tensor(std::vector<uint16_t>(width * height, 500),
+                         {height, width, 1}, core::Dtype::UInt16, device));
+    for (int i = 0; i < 5; ++i) {
+        voxel_grid.Integrate(near_depth, intrinsic_t, extrinsic_t.To(device));
+    }
+    core::Tensor near_depth_map =
+            voxel_grid.RayCast(intrinsic_t, extrinsic_t, width, height)
+                    .at("depth")
+                    .AsTensor()
+                    .To(core::Device("CPU:0"));
+    EXPECT_NEAR(near_depth_map[24][32][0].Item<float>(), 500, 5);
+}
 }  // namespace tests
 }  // namespace open3d
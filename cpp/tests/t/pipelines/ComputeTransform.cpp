@@ -0,0 +1,221 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/ComputeTransform.h"
+
+#include <cmath>
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ComputeTransform, ComputePosePointToPlane) {
+    core::Device device("CPU:0");
+    core::Dtype dtype = core::Dtype::Float32;
+    const int64_t num_points = 5000;
+
+    std::vector<float> source_vec(num_points * 3);
+    std::vector<float> target_vec(num_points * 3);
+    std::vector<float> normals_vec(num_points * 3);
+    Rand(source_vec.data(), source_vec.size(), -1.0, 1.0, 0);
+    Rand(target_vec.data(), target_vec.size(), -1.0, 1.0, 1);
+    Rand(normals_vec.data(), normals_vec.size(), -1.0, 1.0, 2);
+    core::Tensor source_points(source_vec, {num_points, 3}, dtype, device);
+    core::Tensor target_points(target_vec, {num_points, 3}, dtype, device);
+    core::Tensor target_normals(normals_vec, {num_points, 3}, dtype, device);
+
+    // Every second source point corresponds to a shuffled target point.
+    std::vector<int64_t> source_indices_vec;
+    std::vector<int64_t> target_indices_vec;
+    for (int64_t i = 0; i < num_points; i += 2) {
+        source_indices_vec.push_back(i);
+        target_indices_vec.push_back((i * 7919) % num_points);
+    }
+    const int64_t num_corres = static_cast<int64_t>(source_indices_vec.size());
+    core::Tensor source_indices(source_indices_vec, {num_corres},
+                                core::Dtype::Int64, device);
+    core::Tensor target_indices(target_indices_vec, {num_corres},
+                                core::Dtype::Int64, device);
+
+    // Reference: least squares of the stacked rows [s x n, n] . x = (t - s).n.
+    std::vector<double> A_vec;
+    std::vector<double> B_vec;
+    double gt_residual = 0;
+    for (int64_t c = 0; c < num_corres; ++c) {
+        const float *s = &source_vec[3 * source_indices_vec[c]];
+        const float *t = &target_vec[3 * target_indices_vec[c]];
+        const float *n = &normals_vec[3 * target_indices_vec[c]];
+        A_vec.insert(A_vec.end(), {double(s[1]) * n[2] - double(s[2]) * n[1],
+                                   double(s[2]) * n[0] - double(s[0]) * n[2],
+                                   double(s[0]) * n[1] - double(s[1]) * n[0],
+                                   n[0], n[1], n[2]});
+        double r = 0;
+        for (int k = 0; k < 3; ++k) {
+            r += (double(t[k]) - s[k]) * n[k];
+        }
+        B_vec.push_back(r);
+        gt_residual += r * r;
+    }
+    core::Tensor A(A_vec, {num_corres, 6}, core::Dtype::Float64, device);
+    core::Tensor B(B_vec, {num_corres, 1}, core::Dtype::Float64, device);
+    core::Tensor gt_pose = A.LeastSquares(B).Reshape({6}).To(dtype);
+
+    double residual = 0;
+    core::Tensor pose = t::pipelines::kernel::ComputePosePointToPlane(
+            source_points, target_points, target_normals, source_indices,
+            target_indices, residual);
+    EXPECT_EQ(pose.GetShape(), core::SizeVector({6}));
+    EXPECT_TRUE(pose.AllClose(gt_pose, 1e-4, 1e-4));
+    EXPECT_NEAR(residual, gt_residual, 1e-6 * gt_residual);
+}
+
+TEST(ComputeTransform, ComputeRtPointToPoint) {
+    core::Device device("CPU:0");
+    core::Dtype dtype = core::Dtype::Float32;
+    const int64_t num_points = 5000;
+
+    std::vector<float> source_vec(num_points * 3);
+    Rand(source_vec.data(), source_vec.size(), -1.0, 1.0, 0);
+
+    // Target points are the source points under a rigid transformation,
+    // stored in reverse order.
+    const float angle = 0.3f;
+    std::vector<float> R_vec{std::cos(angle), -std::sin(angle), 0,
+                             std::sin(angle), std::cos(angle),  0,
+                             0,               0,                1};
+    std::vector<float> t_vec{0.5f, -0.25f, 1.0f};
+    std::vector<float> target_vec(num_points * 3);
+    std::vector<int64_t> source_indices_vec(num_points);
+    std::vector<int64_t> target_indices_vec(num_points);
+    double gt_residual = 0;
+    for (int64_t i = 0; i < num_points; ++i) {
+        const int64_t j = num_points - 1 - i;
+        for (int a = 0; a < 3; ++a) {
+            float value = t_vec[a];
+            for (int b = 0; b < 3; ++b) {
+                value += R_vec[a * 3 + b] * source_vec[3 * i + b];
+            }
+            target_vec[3 * j + a] = value;
+            const double d = double(value) - source_vec[3 * i + a];
+            gt_residual += d * d;
+        }
+        source_indices_vec[i] = i;
+        target_indices_vec[i] = j;
+    }
+    core::Tensor source_points(source_vec, {num_points, 3}, dtype, device);
+    core::Tensor target_points(target_vec, {num_points, 3}, dtype, device);
+    core::Tensor source_indices(source_indices_vec, {num_points},
+                                core::Dtype::Int64, device);
+    core::Tensor target_indices(target_indices_vec, {num_points},
+                                core::Dtype::Int64, device);
+
+    double residual = 0;
+    core::Tensor R, t;
+    std::tie(R, t) = t::pipelines::kernel::ComputeRtPointToPoint(
+            source_points, target_points, source_indices, target_indices,
+            residual);
+    EXPECT_TRUE(R.AllClose(core::Tensor(R_vec, {3, 3}, dtype, device), 1e-4,
+                           1e-4));
+    EXPECT_TRUE(t.AllClose(core::Tensor(t_vec, {3}, dtype, device), 1e-4,
+                           1e-4));
+    EXPECT_NEAR(residual, gt_residual, 1e-6 * gt_residual);
+}
+
+TEST(ComputeTransform, ComputeRtPointToPointFarFromOrigin) {
+    core::Device device("CPU:0");
+    core::Dtype dtype = core::Dtype::Float64;
+    const int64_t num_points = 1000;
+    const double offset = 1e7;
+
+    // The point spread is tiny compared to the distance to the origin, where
+    // E[target * source^T] - muy * mux^T cancels.
+    std::vector<double> source_vec(num_points * 3);
+    Rand(source_vec.data(), source_vec.size(), -1.0, 1.0, 0);
+    for (double &value : source_vec) {
+        value += offset;
+    }
+    const double angle = 0.3;
+    std::vector<double> R_vec{std::cos(angle), -std::sin(angle), 0,
+                              std::sin(angle), std::cos(angle),  0,
+                              0,               0,                1};
+    std::vector<double> t_vec{0.5, -0.25, 1.0};
+    std::vector<double> target_vec(num_points * 3);
+    std::vector<int64_t> indices_vec(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int a = 0; a < 3; ++a) {
+            double value = t_vec[a];
+            for (int b = 0; b < 3; ++b) {
+                value += R_vec[a * 3 + b] * source_vec[3 * i + b];
+            }
+            target_vec[3 * i + a] = value;
+        }
+        indices_vec[i] = i;
+    }
+    core::Tensor source_points(source_vec, {num_points, 3}, dtype, device);
+    core::Tensor target_points(target_vec, {num_points, 3}, dtype, device);
+    core::Tensor indices(indices_vec, {num_points}, core::Dtype::Int64,
+                         device);
+
+    double residual = 0;
+    core::Tensor R, t;
+    std::tie(R, t) = t::pipelines::kernel::ComputeRtPointToPoint(
+            source_points, target_points, indices, indices, residual);
+    EXPECT_TRUE(R.AllClose(core::Tensor(R_vec, {3, 3}, dtype, device), 1e-6,
+                           1e-6));
+    // The translation error is scaled by the distance to the origin.
+    EXPECT_TRUE(t.AllClose(core::Tensor(t_vec, {3}, dtype, device), 1e-6,
+                           1e-6 * offset));
+}
+
+TEST(ComputeTransform, OutOfRangeCorrespondences) {
+    core::Device device("CPU:0");
+    core::Tensor points =
+            core::Tensor::Zeros({10, 3}, core::Dtype::Float32, device);
+    core::Tensor valid(std::vector<int64_t>{0, 5, 9}, {3}, core::Dtype::Int64,
+                       device);
+    core::Tensor too_large(std::vector<int64_t>{0, 10, 9}, {3},
+                           core::Dtype::Int64, device);
+    core::Tensor negative(std::vector<int64_t>{0, -1, 9}, {3},
+                          core::Dtype::Int64, device);
+
+    double residual = 0;
+    EXPECT_THROW(t::pipelines::kernel::ComputeRtPointToPoint(
+                         points, points, too_large, valid, residual),
+                 std::runtime_error);
+    EXPECT_THROW(t::pipelines::kernel::ComputeRtPointToPoint(
+                         points, points, valid, negative, residual),
+                 std::runtime_error);
+    EXPECT_THROW(t::pipelines::kernel::ComputePosePointToPlane(
+                         points, points, points, valid, too_large, residual),
+                 std::runtime_error);
+}
+
+}  // namespace tests
+}  // namespace open3d
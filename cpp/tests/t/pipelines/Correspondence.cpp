@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/Correspondence.h"
+
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Correspondence, ComputeCorrespondencesCPU) {
+    core::Device device("CPU:0");
+    core::Dtype dtype = core::Dtype::Float32;
+    const int64_t num_source = 3000;
+    const int64_t num_target = 500;
+    const double max_distance = 0.05;
+
+    std::vector<float> source_vec(num_source * 3);
+    std::vector<float> target_vec(num_target * 3);
+    Rand(source_vec.data(), source_vec.size(), -0.1, 1.1, 0);
+    Rand(target_vec.data(), target_vec.size(), 0.0, 1.0, 1);
+    core::Tensor source_points(source_vec, {num_source, 3}, dtype, device);
+    core::Tensor target_points(target_vec, {num_target, 3}, dtype, device);
+
+    // Brute-force nearest neighbors.
+    std::vector<int64_t> gt_source_indices;
+    std::vector<int64_t> gt_target_indices;
+    std::vector<float> gt_distances;
+    for (int64_t i = 0; i < num_source; ++i) {
+        float best_distance = 0;
+        int64_t best_index = -1;
+        for (int64_t j = 0; j < num_target; ++j) {
+            float distance = 0;
+            for (int64_t k = 0; k < 3; ++k) {
+                float diff = source_vec[3 * i + k] - target_vec[3 * j + k];
+                distance += diff * diff;
+            }
+            if (best_index < 0 || distance < best_distance) {
+                best_distance = distance;
+                best_index = j;
+            }
+        }
+        if (best_distance < max_distance * max_distance) {
+            gt_source_indices.push_back(i);
+            gt_target_indices.push_back(best_index);
+            gt_distances.push_back(best_distance);
+        }
+    }
+
+    core::nns::FixedRadiusIndex target_index(target_points, max_distance);
+    core::Tensor source_indices;
+    core::Tensor target_indices;
+    core::Tensor distances;
+    int64_t num_correspondences = 0;
+    double squared_error = 0;
+    t::pipelines::kernel::ComputeCorrespondences(
+            source_points, target_index, max_distance, source_indices,
+            target_indices, distances, num_correspondences, squared_error);
+
+    ASSERT_EQ(num_correspondences,
+              static_cast<int64_t>(gt_source_indices.size()));
+    EXPECT_EQ(source_indices.GetShape(), core::SizeVector({num_source}));
+    EXPECT_EQ(source_indices.Slice(0, 0, num_correspondences)
+                      .ToFlatVector<int64_t>(),
+              gt_source_indices);
+    EXPECT_EQ(target_indices.Slice(0, 0, num_correspondences)
+                      .ToFlatVector<int64_t>(),
+              gt_target_indices);
+    EXPECT_TRUE(distances.Slice(0, 0, num_correspondences)
+                        .AllClose(core::Tensor(gt_distances,
+                                               {num_correspondences}, dtype,
+                                               device)));
+    double gt_squared_error = 0;
+    for (float distance : gt_distances) {
+        gt_squared_error += distance;
+    }
+    EXPECT_NEAR(squared_error, gt_squared_error, 1e-5);
+
+    // The buffers are reused.
+    void *source_indices_ptr = source_indices.GetDataPtr();
+    t::pipelines::kernel::ComputeCorrespondences(
+            source_points, target_index, max_distance, source_indices,
+            target_indices, distances, num_correspondences, squared_error);
+    EXPECT_EQ(source_indices.GetDataPtr(), source_indices_ptr);
+    EXPECT_EQ(num_correspondences,
+              static_cast<int64_t>(gt_source_indices.size()));
+}
+
+}  // namespace tests
+}  // namespace open3d
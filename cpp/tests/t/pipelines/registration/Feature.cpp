@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Feature,
+                         FeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Compares the FPFH features of the tensor and the legacy implementations.
+// Only a small fraction of the histogram bins may differ, when a pair feature
+// falls on a bin boundary.
+static void ExpectFPFHFeatureClose(const core::Tensor &fpfhs,
+                                   const Eigen::MatrixXd &fpfhs_legacy) {
+    ASSERT_EQ(fpfhs.GetShape(), core::SizeVector({fpfhs_legacy.cols(), 33}));
+    std::vector<float> values = fpfhs.ToFlatVector<float>();
+    int64_t num_different = 0;
+    for (int64_t i = 0; i < fpfhs_legacy.cols(); ++i) {
+        for (int j = 0; j < 33; ++j) {
+            num_different += std::abs(values[i * 33 + j] -
+                                      fpfhs_legacy(j, i)) > 1e-2;
+        }
+    }
+    EXPECT_LT(num_different, fpfhs_legacy.size() / 100);
+}
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeature) {
+    core::Device device = GetParam();
+
+    // Points on the unit sphere, with their normals.
+    const int64_t num_points = 2000;
+    std::vector<float> points_vec(num_points * 3);
+    Rand(points_vec.data(), points_vec.size(), -1.0, 1.0, 0);
+    for (int64_t i = 0; i < num_points; ++i) {
+        Eigen::Map<Eigen::Vector3f> point(points_vec.data() + 3 * i);
+        point.normalize();
+    }
+    core::Tensor points(points_vec, {num_points, 3}, core::Dtype::Float32,
+                        device);
+    t::geometry::PointCloud pcd(points);
+    pcd.SetPointNormals(points.Clone());
+
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        EXPECT_ANY_THROW(t::pipelines::registration::ComputeFPFHFeature(
+                pcd, utility::nullopt, 0.2));
+        return;
+    }
+
+    open3d::geometry::PointCloud pcd_legacy = pcd.ToLegacyPointCloud();
+    ExpectFPFHFeatureClose(
+            t::pipelines::registration::ComputeFPFHFeature(
+                    pcd, utility::nullopt, 0.2),
+            pipelines::registration::ComputeFPFHFeature(
+                    pcd_legacy, open3d::geometry::KDTreeSearchParamRadius(0.2))
+                    ->data_);
+    ExpectFPFHFeatureClose(
+            t::pipelines::registration::ComputeFPFHFeature(pcd, 30, 0.2),
+            pipelines::registration::ComputeFPFHFeature(
+                    pcd_legacy,
+                    open3d::geometry::KDTreeSearchParamHybrid(0.2, 30))
+                    ->data_);
+    ExpectFPFHFeatureClose(
+            t::pipelines::registration::ComputeFPFHFeature(pcd, 30),
+            pipelines::registration::ComputeFPFHFeature(
+                    pcd_legacy, open3d::geometry::KDTreeSearchParamKNN(30))
+                    ->data_);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,8 +26,11 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <thread>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/ColoredICP.h"
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "tests/UnitTest.h"
@@ -281,5 +284,247 @@ TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPlane) {
     EXPECT_NEAR(reg_p2plane_t.inlier_rmse_, reg_p2plane_l.inlier_rmse_, 0.0005);
 }
 
+// Target: a grid on each face of the unit cube, with the face normals.
+// Source: the target moved by the inverse of transformation_gt.
+static void CreateCubePointClouds(const core::Device &device,
+                                  t::geometry::PointCloud &source,
+                                  t::geometry::PointCloud &target,
+                                  core::Tensor &transformation_gt) {
+    core::Dtype dtype = core::Dtype::Float32;
+    const int grid_size = 20;
+    std::vector<float> target_points_vec, target_normals_vec;
+    for (int face = 0; face < 6; face++) {
+        int axis = face / 2;
+        for (int u = 0; u < grid_size; u++) {
+            for (int v = 0; v < grid_size; v++) {
+                float point[3], normal[3] = {0, 0, 0};
+                point[axis] = static_cast<float>(face % 2);
+                point[(axis + 1) % 3] = (u + 0.5f) / grid_size;
+                point[(axis + 2) % 3] = (v + 0.5f) / grid_size;
+                normal[axis] = face % 2 == 0 ? -1.f : 1.f;
+                target_points_vec.insert(target_points_vec.end(), point,
+                                         point + 3);
+                target_normals_vec.insert(target_normals_vec.end(), normal,
+                                          normal + 3);
+            }
+        }
+    }
+    int64_t num_points = 6 * grid_size * grid_size;
+    target = t::geometry::PointCloud(device);
+    target.SetPoints(
+            core::Tensor(target_points_vec, {num_points, 3}, dtype, device));
+    target.SetPointNormals(
+            core::Tensor(target_normals_vec, {num_points, 3}, dtype, device));
+
+    float c = std::cos(0.1f), s = std::sin(0.1f);
+    transformation_gt = core::Tensor(
+            std::vector<float>{c, -s, 0, 0.05f, s, c, 0, -0.04f, 0, 0, 1,
+                               0.03f, 0, 0, 0, 1},
+            {4, 4}, dtype, device);
+    source = target.Clone();
+    source.Transform(transformation_gt.Inverse());
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationMultiScaleICP) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    t::geometry::PointCloud source_device, target_device;
+    core::Tensor transformation_gt;
+    CreateCubePointClouds(device, source_device, target_device,
+                          transformation_gt);
+    float c = std::cos(0.1f), s = std::sin(0.1f);
+
+    std::vector<double> voxel_sizes{0.2, 0.1, 0.0};
+    std::vector<double> max_correspondence_distances{0.3, 0.15, 0.05};
+
+    // Tensor.
+    std::vector<t::pipelines::registration::ICPConvergenceCriteria>
+            criteria_list_t(3, t::pipelines::registration::
+                                       ICPConvergenceCriteria(1e-6, 1e-6, 30));
+    std::vector<t::pipelines::registration::ICPLevelStatistics>
+            level_statistics_t;
+    t::pipelines::registration::RegistrationResult reg_t =
+            t::pipelines::registration::RegistrationMultiScaleICP(
+                    source_device, target_device, voxel_sizes,
+                    criteria_list_t, max_correspondence_distances,
+                    core::Tensor::Eye(4, dtype, device),
+                    t::pipelines::registration::
+                            TransformationEstimationPointToPlane(),
+                    &level_statistics_t);
+
+    EXPECT_TRUE(reg_t.transformation_.AllClose(transformation_gt, 1e-3, 1e-3));
+    EXPECT_NEAR(reg_t.fitness_, 1.0, 1e-6);
+    ASSERT_EQ(level_statistics_t.size(), 3);
+    for (size_t i = 0; i < voxel_sizes.size(); i++) {
+        EXPECT_EQ(level_statistics_t[i].voxel_size_, voxel_sizes[i]);
+        EXPECT_GT(level_statistics_t[i].num_iterations_, 0);
+    }
+    EXPECT_EQ(level_statistics_t[2].fitness_, reg_t.fitness_);
+
+    // Legacy.
+    open3d::geometry::PointCloud source_l = source_device.ToLegacyPointCloud();
+    open3d::geometry::PointCloud target_l = target_device.ToLegacyPointCloud();
+    std::vector<pipelines::registration::ICPConvergenceCriteria>
+            criteria_list_l(3, pipelines::registration::ICPConvergenceCriteria(
+                                       1e-6, 1e-6, 30));
+    std::vector<pipelines::registration::ICPLevelStatistics>
+            level_statistics_l;
+    pipelines::registration::RegistrationResult reg_l =
+            pipelines::registration::RegistrationMultiScaleICP(
+                    source_l, target_l, voxel_sizes, criteria_list_l,
+                    max_correspondence_distances, Eigen::Matrix4d::Identity(),
+                    pipelines::registration::
+                            TransformationEstimationPointToPlane(),
+                    &level_statistics_l);
+
+    Eigen::Matrix4d transformation_gt_l;
+    transformation_gt_l << c, -s, 0, 0.05, s, c, 0, -0.04, 0, 0, 1, 0.03, 0, 0,
+            0, 1;
+    EXPECT_TRUE(Eigen::Matrix4d(reg_l.transformation_)
+                        .isApprox(transformation_gt_l, 1e-3));
+    EXPECT_NEAR(reg_l.fitness_, 1.0, 1e-6);
+    ASSERT_EQ(level_statistics_l.size(), 3);
+    EXPECT_GT(level_statistics_l[0].num_iterations_, 0);
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationTarget) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    t::geometry::PointCloud source_device, target_device;
+    core::Tensor transformation_gt;
+    CreateCubePointClouds(device, source_device, target_device,
+                          transformation_gt);
+    core::Tensor init = core::Tensor::Eye(4, dtype, device);
+    double max_correspondence_dist = 0.2;
+    t::pipelines::registration::ICPConvergenceCriteria criteria(1e-6, 1e-6,
+                                                                30);
+
+    // Tensor: registrations sharing one target match the plain ones.
+    t::pipelines::registration::RegistrationResult reg_t =
+            t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, max_correspondence_dist,
+                    init,
+                    t::pipelines::registration::
+                            TransformationEstimationPointToPlane(),
+                    criteria);
+    t::pipelines::registration::RegistrationTarget registration_target(
+            target_device, max_correspondence_dist);
+    std::vector<t::pipelines::registration::RegistrationResult> results_t(
+            4, t::pipelines::registration::RegistrationResult(init));
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results_t.size(); i++) {
+        threads.emplace_back([&, i]() {
+            results_t[i] = t::pipelines::registration::RegistrationICP(
+                    source_device, registration_target,
+                    max_correspondence_dist, init,
+                    t::pipelines::registration::
+                            TransformationEstimationPointToPlane(),
+                    criteria);
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (const auto &result : results_t) {
+        EXPECT_TRUE(result.transformation_.AllClose(reg_t.transformation_));
+        EXPECT_EQ(result.fitness_, reg_t.fitness_);
+        EXPECT_EQ(result.inlier_rmse_, reg_t.inlier_rmse_);
+    }
+    EXPECT_TRUE(reg_t.transformation_.AllClose(transformation_gt, 1e-3, 1e-3));
+
+    t::pipelines::registration::RegistrationResult evaluation_t =
+            t::pipelines::registration::EvaluateRegistration(
+                    source_device, registration_target, 0.1,
+                    reg_t.transformation_);
+    EXPECT_NEAR(evaluation_t.fitness_, 1.0, 1e-6);
+
+    // Legacy.
+    open3d::geometry::PointCloud source_l = source_device.ToLegacyPointCloud();
+    open3d::geometry::PointCloud target_l = target_device.ToLegacyPointCloud();
+    pipelines::registration::ICPConvergenceCriteria criteria_l(1e-6, 1e-6,
+                                                               30);
+    pipelines::registration::RegistrationResult reg_l =
+            pipelines::registration::RegistrationICP(
+                    source_l, target_l, max_correspondence_dist,
+                    Eigen::Matrix4d::Identity(),
+                    pipelines::registration::
+                            TransformationEstimationPointToPlane(),
+                    criteria_l);
+    pipelines::registration::RegistrationTarget registration_target_l(
+            target_l);
+    pipelines::registration::RegistrationResult reg_target_l =
+            pipelines::registration::RegistrationICP(
+                    source_l, registration_target_l, max_correspondence_dist,
+                    Eigen::Matrix4d::Identity(),
+                    pipelines::registration::
+                            TransformationEstimationPointToPlane(),
+                    criteria_l);
+    EXPECT_TRUE(Eigen::Matrix4d(reg_target_l.transformation_)
+                        .isApprox(Eigen::Matrix4d(reg_l.transformation_)));
+    EXPECT_EQ(reg_target_l.fitness_, reg_l.fitness_);
+
+    // Legacy Colored ICP.
+    target_l.PaintUniformColor(Eigen::Vector3d(0.5, 0.5, 0.5));
+    source_l.PaintUniformColor(Eigen::Vector3d(0.5, 0.5, 0.5));
+    pipelines::registration::RegistrationResult reg_colored_l =
+            pipelines::registration::RegistrationColoredICP(
+                    source_l, target_l, max_correspondence_dist);
+    pipelines::registration::ColoredICPTarget colored_icp_target_l(
+            target_l, max_correspondence_dist);
+    pipelines::registration::RegistrationResult reg_colored_target_l =
+            pipelines::registration::RegistrationColoredICP(
+                    source_l, colored_icp_target_l, max_correspondence_dist);
+    EXPECT_TRUE(Eigen::Matrix4d(reg_colored_target_l.transformation_)
+                        .isApprox(Eigen::Matrix4d(
+                                reg_colored_l.transformation_)));
+    EXPECT_EQ(reg_colored_target_l.fitness_, reg_colored_l.fitness_);
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationTargetLargeDistance) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    t::geometry::PointCloud source_device, target_device;
+    core::Tensor transformation_gt;
+    CreateCubePointClouds(device, source_device, target_device,
+                          transformation_gt);
+    core::Tensor init = core::Tensor::Eye(4, dtype, device);
+
+    // The unit cube fills a few 2 * 1.0 voxels of the FixedRadiusIndex, so
+    // the large target falls back to the hybrid search.
+    t::pipelines::registration::RegistrationTarget small_target(target_device,
+                                                                0.05);
+    t::pipelines::registration::RegistrationTarget large_target(target_device,
+                                                                1.0);
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        EXPECT_NE(small_target.GetFixedRadiusIndex(), nullptr);
+    }
+    EXPECT_EQ(large_target.GetFixedRadiusIndex(), nullptr);
+    EXPECT_NE(large_target.GetNearestNeighborSearch(), nullptr);
+
+    t::pipelines::registration::RegistrationResult evaluation_small =
+            t::pipelines::registration::EvaluateRegistration(
+                    source_device, small_target, 0.05, init);
+    t::pipelines::registration::RegistrationResult evaluation_large =
+            t::pipelines::registration::EvaluateRegistration(
+                    source_device, large_target, 0.05, init);
+    EXPECT_GT(evaluation_small.fitness_, 0.0);
+    EXPECT_EQ(evaluation_large.fitness_, evaluation_small.fitness_);
+    EXPECT_NEAR(evaluation_large.inlier_rmse_, evaluation_small.inlier_rmse_,
+                1e-6);
+    EXPECT_TRUE(evaluation_large.correspondence_set_.AllClose(
+            evaluation_small.correspondence_set_));
+
+    // The deprecated correspondence_select_bool_ is still filled.
+    EXPECT_EQ(evaluation_small.correspondence_select_bool_.GetShape(),
+              core::SizeVector({source_device.GetPoints().GetLength()}));
+    EXPECT_TRUE(evaluation_small.correspondence_select_bool_.NonZero()
+                        .Reshape({-1})
+                        .AllClose(evaluation_small
+                                          .correspondence_source_indices_));
+}
+
 }  // namespace tests
 }  // namespace open3d